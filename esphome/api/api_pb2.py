@@ -22,254 +22,705 @@ DESCRIPTOR = _descriptor.FileDescriptor(
     syntax="proto3",
     serialized_options=None,
     serialized_pb=_b(
-        '\n\tapi.proto"#\n\x0cHelloRequest\x12\x13\n\x0b\x63lient_info\x18\x01 \x01(\t"Z\n\rHelloResponse\x12\x19\n\x11\x61pi_version_major\x18\x01 \x01(\r\x12\x19\n\x11\x61pi_version_minor\x18\x02 \x01(\r\x12\x13\n\x0bserver_info\x18\x03 \x01(\t""\n\x0e\x43onnectRequest\x12\x10\n\x08password\x18\x01 \x01(\t"+\n\x0f\x43onnectResponse\x12\x18\n\x10invalid_password\x18\x01 \x01(\x08"\x13\n\x11\x44isconnectRequest"\x14\n\x12\x44isconnectResponse"\r\n\x0bPingRequest"\x0e\n\x0cPingResponse"\x13\n\x11\x44\x65viceInfoRequest"\xad\x01\n\x12\x44\x65viceInfoResponse\x12\x15\n\ruses_password\x18\x01 \x01(\x08\x12\x0c\n\x04name\x18\x02 \x01(\t\x12\x13\n\x0bmac_address\x18\x03 \x01(\t\x12\x1c\n\x14\x65sphome_core_version\x18\x04 \x01(\t\x12\x18\n\x10\x63ompilation_time\x18\x05 \x01(\t\x12\r\n\x05model\x18\x06 \x01(\t\x12\x16\n\x0ehas_deep_sleep\x18\x07 \x01(\x08"\x15\n\x13ListEntitiesRequest"\x9a\x01\n ListEntitiesBinarySensorResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t\x12\x14\n\x0c\x64\x65vice_class\x18\x05 \x01(\t\x12\x1f\n\x17is_status_binary_sensor\x18\x06 \x01(\x08"s\n\x19ListEntitiesCoverResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t\x12\x15\n\ris_optimistic\x18\x05 \x01(\x08"\x90\x01\n\x17ListEntitiesFanResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t\x12\x1c\n\x14supports_oscillation\x18\x05 \x01(\x08\x12\x16\n\x0esupports_speed\x18\x06 \x01(\x08"\x8a\x02\n\x19ListEntitiesLightResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t\x12\x1b\n\x13supports_brightness\x18\x05 \x01(\x08\x12\x14\n\x0csupports_rgb\x18\x06 \x01(\x08\x12\x1c\n\x14supports_white_value\x18\x07 \x01(\x08\x12"\n\x1asupports_color_temperature\x18\x08 \x01(\x08\x12\x12\n\nmin_mireds\x18\t \x01(\x02\x12\x12\n\nmax_mireds\x18\n \x01(\x02\x12\x0f\n\x07\x65\x66\x66\x65\x63ts\x18\x0b \x03(\t"\xa3\x01\n\x1aListEntitiesSensorResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t\x12\x0c\n\x04icon\x18\x05 \x01(\t\x12\x1b\n\x13unit_of_measurement\x18\x06 \x01(\t\x12\x19\n\x11\x61\x63\x63uracy_decimals\x18\x07 \x01(\x05"\x7f\n\x1aListEntitiesSwitchResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t\x12\x0c\n\x04icon\x18\x05 \x01(\t\x12\x12\n\noptimistic\x18\x06 \x01(\x08"o\n\x1eListEntitiesTextSensorResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t\x12\x0c\n\x04icon\x18\x05 \x01(\t"\x1a\n\x18ListEntitiesDoneResponse"\x18\n\x16SubscribeStatesRequest"7\n\x19\x42inarySensorStateResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\r\n\x05state\x18\x02 \x01(\x08"t\n\x12\x43overStateResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12-\n\x05state\x18\x02 \x01(\x0e\x32\x1e.CoverStateResponse.CoverState""\n\nCoverState\x12\x08\n\x04OPEN\x10\x00\x12\n\n\x06\x43LOSED\x10\x01"]\n\x10\x46\x61nStateResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\r\n\x05state\x18\x02 \x01(\x08\x12\x13\n\x0boscillating\x18\x03 \x01(\x08\x12\x18\n\x05speed\x18\x04 \x01(\x0e\x32\t.FanSpeed"\xa8\x01\n\x12LightStateResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\r\n\x05state\x18\x02 \x01(\x08\x12\x12\n\nbrightness\x18\x03 \x01(\x02\x12\x0b\n\x03red\x18\x04 \x01(\x02\x12\r\n\x05green\x18\x05 \x01(\x02\x12\x0c\n\x04\x62lue\x18\x06 \x01(\x02\x12\r\n\x05white\x18\x07 \x01(\x02\x12\x19\n\x11\x63olor_temperature\x18\x08 \x01(\x02\x12\x0e\n\x06\x65\x66\x66\x65\x63t\x18\t \x01(\t"1\n\x13SensorStateResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\r\n\x05state\x18\x02 \x01(\x02"1\n\x13SwitchStateResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\r\n\x05state\x18\x02 \x01(\x08"5\n\x17TextSensorStateResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\r\n\x05state\x18\x02 \x01(\t"\x98\x01\n\x13\x43overCommandRequest\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\x11\n\thas_state\x18\x02 \x01(\x08\x12\x32\n\x07\x63ommand\x18\x03 \x01(\x0e\x32!.CoverCommandRequest.CoverCommand"-\n\x0c\x43overCommand\x12\x08\n\x04OPEN\x10\x00\x12\t\n\x05\x43LOSE\x10\x01\x12\x08\n\x04STOP\x10\x02"\x9d\x01\n\x11\x46\x61nCommandRequest\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\x11\n\thas_state\x18\x02 \x01(\x08\x12\r\n\x05state\x18\x03 \x01(\x08\x12\x11\n\thas_speed\x18\x04 \x01(\x08\x12\x18\n\x05speed\x18\x05 \x01(\x0e\x32\t.FanSpeed\x12\x17\n\x0fhas_oscillating\x18\x06 \x01(\x08\x12\x13\n\x0boscillating\x18\x07 \x01(\x08"\x95\x03\n\x13LightCommandRequest\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\x11\n\thas_state\x18\x02 \x01(\x08\x12\r\n\x05state\x18\x03 \x01(\x08\x12\x16\n\x0ehas_brightness\x18\x04 \x01(\x08\x12\x12\n\nbrightness\x18\x05 \x01(\x02\x12\x0f\n\x07has_rgb\x18\x06 \x01(\x08\x12\x0b\n\x03red\x18\x07 \x01(\x02\x12\r\n\x05green\x18\x08 \x01(\x02\x12\x0c\n\x04\x62lue\x18\t \x01(\x02\x12\x11\n\thas_white\x18\n \x01(\x08\x12\r\n\x05white\x18\x0b \x01(\x02\x12\x1d\n\x15has_color_temperature\x18\x0c \x01(\x08\x12\x19\n\x11\x63olor_temperature\x18\r \x01(\x02\x12\x1d\n\x15has_transition_length\x18\x0e \x01(\x08\x12\x19\n\x11transition_length\x18\x0f \x01(\r\x12\x18\n\x10has_flash_length\x18\x10 \x01(\x08\x12\x14\n\x0c\x66lash_length\x18\x11 \x01(\r\x12\x12\n\nhas_effect\x18\x12 \x01(\x08\x12\x0e\n\x06\x65\x66\x66\x65\x63t\x18\x13 \x01(\t"2\n\x14SwitchCommandRequest\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\r\n\x05state\x18\x02 \x01(\x08"E\n\x14SubscribeLogsRequest\x12\x18\n\x05level\x18\x01 \x01(\x0e\x32\t.LogLevel\x12\x13\n\x0b\x64ump_config\x18\x02 \x01(\x08"d\n\x15SubscribeLogsResponse\x12\x18\n\x05level\x18\x01 \x01(\x0e\x32\t.LogLevel\x12\x0b\n\x03tag\x18\x02 \x01(\t\x12\x0f\n\x07message\x18\x03 \x01(\t\x12\x13\n\x0bsend_failed\x18\x04 \x01(\x08"\x1e\n\x1cSubscribeServiceCallsRequest"\xdf\x02\n\x13ServiceCallResponse\x12\x0f\n\x07service\x18\x01 \x01(\t\x12,\n\x04\x64\x61ta\x18\x02 \x03(\x0b\x32\x1e.ServiceCallResponse.DataEntry\x12=\n\rdata_template\x18\x03 \x03(\x0b\x32&.ServiceCallResponse.DataTemplateEntry\x12\x36\n\tvariables\x18\x04 \x03(\x0b\x32#.ServiceCallResponse.VariablesEntry\x1a+\n\tDataEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\x1a\x33\n\x11\x44\x61taTemplateEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01\x1a\x30\n\x0eVariablesEntry\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t:\x02\x38\x01"%\n#SubscribeHomeAssistantStatesRequest"8\n#SubscribeHomeAssistantStateResponse\x12\x11\n\tentity_id\x18\x01 \x01(\t">\n\x1aHomeAssistantStateResponse\x12\x11\n\tentity_id\x18\x01 \x01(\t\x12\r\n\x05state\x18\x02 \x01(\t"\x10\n\x0eGetTimeRequest"(\n\x0fGetTimeResponse\x12\x15\n\repoch_seconds\x18\x01 \x01(\x07*)\n\x08\x46\x61nSpeed\x12\x07\n\x03LOW\x10\x00\x12\n\n\x06MEDIUM\x10\x01\x12\x08\n\x04HIGH\x10\x02*]\n\x08LogLevel\x12\x08\n\x04NONE\x10\x00\x12\t\n\x05\x45RROR\x10\x01\x12\x08\n\x04WARN\x10\x02\x12\x08\n\x04INFO\x10\x03\x12\t\n\x05\x44\x45\x42UG\x10\x04\x12\x0b\n\x07VERBOSE\x10\x05\x12\x10\n\x0cVERY_VERBOSE\x10\x06\x62\x06proto3'
+        '\n\tapi.proto"#\n\x0cHelloRequest\x12\x13\n\x0b\x63lient_info\x18\x01 \x01(\t"Z\n\rHelloResponse\x12\x19\n\x11\x61pi_version_major\x18\x01 \x01(\r\x12\x19\n\x11\x61pi_version_minor\x18\x02 \x01(\r\x12\x13\n\x0bserver_info\x18\x03 \x01(\t""\n\x0e\x43onnectRequest\x12\x10\n\x08password\x18\x01 \x01(\t"+\n\x0f\x43onnectResponse\x12\x18\n\x10invalid_password\x18\x01 \x01(\x08"\x13\n\x11\x44isconnectRequest"\x14\n\x12\x44isconnectResponse"\r\n\x0bPingRequest"\x0e\n\x0cPingResponse"\x13\n\x11\x44\x65viceInfoRequest"\xa8\x01\n\x12\x44\x65viceInfoResponse\x12\x15\n\ruses_password\x18\x01 \x01(\x08\x12\x0c\n\x04name\x18\x02 \x01(\t\x12\x13\n\x0bmac_address\x18\x03 \x01(\t\x12\x17\n\x0f\x65sphome_version\x18\x04 \x01(\t\x12\x18\n\x10\x63ompilation_time\x18\x05 \x01(\t\x12\r\n\x05model\x18\x06 \x01(\t\x12\x16\n\x0ehas_deep_sleep\x18\x07 \x01(\x08"\x15\n\x13ListEntitiesRequest"\x1a\n\x18ListEntitiesDoneResponse"\x18\n\x16SubscribeStatesRequest"\x9a\x01\n ListEntitiesBinarySensorResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t\x12\x14\n\x0c\x64\x65vice_class\x18\x05 \x01(\t\x12\x1f\n\x17is_status_binary_sensor\x18\x06 \x01(\x08"N\n\x19\x42inarySensorStateResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\r\n\x05state\x18\x02 \x01(\x08\x12\x15\n\rmissing_state\x18\x03 \x01(\x08"\xbb\x01\n\x19ListEntitiesCoverResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t\x12\x15\n\rassumed_state\x18\x05 \x01(\x08\x12\x19\n\x11supports_position\x18\x06 \x01(\x08\x12\x15\n\rsupports_tilt\x18\x07 \x01(\x08\x12\x14\n\x0c\x64\x65vice_class\x18\x08 \x01(\t"\x96\x01\n\x12\x43overStateResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\'\n\x0clegacy_state\x18\x02 \x01(\x0e\x32\x11.LegacyCoverState\x12\x10\n\x08position\x18\x03 \x01(\x02\x12\x0c\n\x04tilt\x18\x04 \x01(\x02\x12*\n\x11\x63urrent_operation\x18\x05 \x01(\x0e\x32\x0f.CoverOperation"\xc1\x01\n\x13\x43overCommandRequest\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\x1a\n\x12has_legacy_command\x18\x02 \x01(\x08\x12+\n\x0elegacy_command\x18\x03 \x01(\x0e\x32\x13.LegacyCoverCommand\x12\x14\n\x0chas_position\x18\x04 \x01(\x08\x12\x10\n\x08position\x18\x05 \x01(\x02\x12\x10\n\x08has_tilt\x18\x06 \x01(\x08\x12\x0c\n\x04tilt\x18\x07 \x01(\x02\x12\x0c\n\x04stop\x18\x08 \x01(\x08"\xcb\x01\n\x17ListEntitiesFanResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t\x12\x1c\n\x14supports_oscillation\x18\x05 \x01(\x08\x12\x16\n\x0esupports_speed\x18\x06 \x01(\x08\x12\x1a\n\x12supports_direction\x18\x07 \x01(\x08\x12\x1d\n\x15supported_speed_count\x18\x08 \x01(\x05"\x94\x01\n\x10\x46\x61nStateResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\r\n\x05state\x18\x02 \x01(\x08\x12\x13\n\x0boscillating\x18\x03 \x01(\x08\x12\x18\n\x05speed\x18\x04 \x01(\x0e\x32\t.FanSpeed\x12 \n\tdirection\x18\x05 \x01(\x0e\x32\r.FanDirection\x12\x13\n\x0bspeed_level\x18\x06 \x01(\x05"\x84\x02\n\x11\x46\x61nCommandRequest\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\x11\n\thas_state\x18\x02 \x01(\x08\x12\r\n\x05state\x18\x03 \x01(\x08\x12\x11\n\thas_speed\x18\x04 \x01(\x08\x12\x18\n\x05speed\x18\x05 \x01(\x0e\x32\t.FanSpeed\x12\x17\n\x0fhas_oscillating\x18\x06 \x01(\x08\x12\x13\n\x0boscillating\x18\x07 \x01(\x08\x12\x15\n\rhas_direction\x18\x08 \x01(\x08\x12 \n\tdirection\x18\t \x01(\x0e\x32\r.FanDirection\x12\x17\n\x0fhas_speed_level\x18\n \x01(\x08\x12\x13\n\x0bspeed_level\x18\x0b \x01(\x05"\x8a\x02\n\x19ListEntitiesLightResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t\x12\x1b\n\x13supports_brightness\x18\x05 \x01(\x08\x12\x14\n\x0csupports_rgb\x18\x06 \x01(\x08\x12\x1c\n\x14supports_white_value\x18\x07 \x01(\x08\x12"\n\x1asupports_color_temperature\x18\x08 \x01(\x08\x12\x12\n\nmin_mireds\x18\t \x01(\x02\x12\x12\n\nmax_mireds\x18\n \x01(\x02\x12\x0f\n\x07\x65\x66\x66\x65\x63ts\x18\x0b \x03(\t"\xa8\x01\n\x12LightStateResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\r\n\x05state\x18\x02 \x01(\x08\x12\x12\n\nbrightness\x18\x03 \x01(\x02\x12\x0b\n\x03red\x18\x04 \x01(\x02\x12\r\n\x05green\x18\x05 \x01(\x02\x12\x0c\n\x04\x62lue\x18\x06 \x01(\x02\x12\r\n\x05white\x18\x07 \x01(\x02\x12\x19\n\x11\x63olor_temperature\x18\x08 \x01(\x02\x12\x0e\n\x06\x65\x66\x66\x65\x63t\x18\t \x01(\t"\x95\x03\n\x13LightCommandRequest\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\x11\n\thas_state\x18\x02 \x01(\x08\x12\r\n\x05state\x18\x03 \x01(\x08\x12\x16\n\x0ehas_brightness\x18\x04 \x01(\x08\x12\x12\n\nbrightness\x18\x05 \x01(\x02\x12\x0f\n\x07has_rgb\x18\x06 \x01(\x08\x12\x0b\n\x03red\x18\x07 \x01(\x02\x12\r\n\x05green\x18\x08 \x01(\x02\x12\x0c\n\x04\x62lue\x18\t \x01(\x02\x12\x11\n\thas_white\x18\n \x01(\x08\x12\r\n\x05white\x18\x0b \x01(\x02\x12\x1d\n\x15has_color_temperature\x18\x0c \x01(\x08\x12\x19\n\x11\x63olor_temperature\x18\r \x01(\x02\x12\x1d\n\x15has_transition_length\x18\x0e \x01(\x08\x12\x19\n\x11transition_length\x18\x0f \x01(\r\x12\x18\n\x10has_flash_length\x18\x10 \x01(\x08\x12\x14\n\x0c\x66lash_length\x18\x11 \x01(\r\x12\x12\n\nhas_effect\x18\x12 \x01(\x08\x12\x0e\n\x06\x65\x66\x66\x65\x63t\x18\x13 \x01(\t"\xcf\x01\n\x1aListEntitiesSensorResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t\x12\x0c\n\x04icon\x18\x05 \x01(\t\x12\x1b\n\x13unit_of_measurement\x18\x06 \x01(\t\x12\x19\n\x11\x61\x63\x63uracy_decimals\x18\x07 \x01(\x05\x12\x14\n\x0c\x66orce_update\x18\x08 \x01(\x08\x12\x14\n\x0c\x64\x65vice_class\x18\t \x01(\t"H\n\x13SensorStateResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\r\n\x05state\x18\x02 \x01(\x02\x12\x15\n\rmissing_state\x18\x03 \x01(\x08"\x82\x01\n\x1aListEntitiesSwitchResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t\x12\x0c\n\x04icon\x18\x05 \x01(\t\x12\x15\n\rassumed_state\x18\x06 \x01(\x08"1\n\x13SwitchStateResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\r\n\x05state\x18\x02 \x01(\x08"2\n\x14SwitchCommandRequest\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\r\n\x05state\x18\x02 \x01(\x08"o\n\x1eListEntitiesTextSensorResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t\x12\x0c\n\x04icon\x18\x05 \x01(\t"L\n\x17TextSensorStateResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\r\n\x05state\x18\x02 \x01(\t\x12\x15\n\rmissing_state\x18\x03 \x01(\x08"U\n\x14SubscribeLogsRequest\x12\x18\n\x05level\x18\x01 \x01(\x0e\x32\t.LogLevel\x12\x13\n\x0b\x64ump_config\x18\x02 \x01(\x08\x12\x0e\n\x06\x62inary\x18\x03 \x01(\x08"d\n\x15SubscribeLogsResponse\x12\x18\n\x05level\x18\x01 \x01(\x0e\x32\t.LogLevel\x12\x0b\n\x03tag\x18\x02 \x01(\t\x12\x0f\n\x07message\x18\x03 \x01(\t\x12\x13\n\x0bsend_failed\x18\x04 \x01(\x08"R\n\x1bSubscribeLogsBinaryResponse\x12\x18\n\x05level\x18\x01 \x01(\x0e\x32\t.LogLevel\x12\x0b\n\x03tag\x18\x02 \x01(\t\x12\x0c\n\x04\x64\x61ta\x18\x03 \x01(\x0c"\'\n%SubscribeHomeassistantServicesRequest"5\n\x17HomeassistantServiceMap\x12\x0b\n\x03key\x18\x01 \x01(\t\x12\r\n\x05value\x18\x02 \x01(\t"\xc7\x01\n\x1cHomeassistantServiceResponse\x12\x0f\n\x07service\x18\x01 \x01(\t\x12&\n\x04\x64\x61ta\x18\x02 \x03(\x0b\x32\x18.HomeassistantServiceMap\x12/\n\rdata_template\x18\x03 \x03(\x0b\x32\x18.HomeassistantServiceMap\x12+\n\tvariables\x18\x04 \x03(\x0b\x32\x18.HomeassistantServiceMap\x12\x10\n\x08is_event\x18\x05 \x01(\x08"%\n#SubscribeHomeAssistantStatesRequest"8\n#SubscribeHomeAssistantStateResponse\x12\x11\n\tentity_id\x18\x01 \x01(\t">\n\x1aHomeAssistantStateResponse\x12\x11\n\tentity_id\x18\x01 \x01(\t\x12\r\n\x05state\x18\x02 \x01(\t"\x10\n\x0eGetTimeRequest"(\n\x0fGetTimeResponse\x12\x15\n\repoch_seconds\x18\x01 \x01(\x07"K\n\x1cListEntitiesServicesArgument\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x1d\n\x04type\x18\x02 \x01(\x0e\x32\x0f.ServiceArgType"f\n\x1cListEntitiesServicesResponse\x12\x0c\n\x04name\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12+\n\x04\x61rgs\x18\x03 \x03(\x0b\x32\x1d.ListEntitiesServicesArgument"\xbc\x01\n\x16\x45xecuteServiceArgument\x12\r\n\x05\x62ool_\x18\x01 \x01(\x08\x12\x12\n\nlegacy_int\x18\x02 \x01(\x05\x12\x0e\n\x06\x66loat_\x18\x03 \x01(\x02\x12\x0f\n\x07string_\x18\x04 \x01(\t\x12\x0c\n\x04int_\x18\x05 \x01(\x11\x12\x12\n\nbool_array\x18\x06 \x03(\x08\x12\x11\n\tint_array\x18\x07 \x03(\x11\x12\x13\n\x0b\x66loat_array\x18\x08 \x03(\x02\x12\x14\n\x0cstring_array\x18\t \x03(\t"K\n\x15\x45xecuteServiceRequest\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12%\n\x04\x61rgs\x18\x02 \x03(\x0b\x32\x17.ExecuteServiceArgument"]\n\x1aListEntitiesCameraResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t">\n\x13\x43\x61meraImageResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\x0c\n\x04\x64\x61ta\x18\x02 \x01(\x0c\x12\x0c\n\x04\x64one\x18\x03 \x01(\x08"4\n\x12\x43\x61meraImageRequest\x12\x0e\n\x06single\x18\x01 \x01(\x08\x12\x0e\n\x06stream\x18\x02 \x01(\x08"\xcb\x03\n\x1bListEntitiesClimateResponse\x12\x11\n\tobject_id\x18\x01 \x01(\t\x12\x0b\n\x03key\x18\x02 \x01(\x07\x12\x0c\n\x04name\x18\x03 \x01(\t\x12\x11\n\tunique_id\x18\x04 \x01(\t\x12$\n\x1csupports_current_temperature\x18\x05 \x01(\x08\x12-\n%supports_two_point_target_temperature\x18\x06 \x01(\x08\x12%\n\x0fsupported_modes\x18\x07 \x03(\x0e\x32\x0c.ClimateMode\x12\x1e\n\x16visual_min_temperature\x18\x08 \x01(\x02\x12\x1e\n\x16visual_max_temperature\x18\t \x01(\x02\x12\x1f\n\x17visual_temperature_step\x18\n \x01(\x02\x12\x15\n\rsupports_away\x18\x0b \x01(\x08\x12\x17\n\x0fsupports_action\x18\x0c \x01(\x08\x12,\n\x13supported_fan_modes\x18\r \x03(\x0e\x32\x0f.ClimateFanMode\x12\x30\n\x15supported_swing_modes\x18\x0e \x03(\x0e\x32\x11.ClimateSwingMode"\xb1\x02\n\x14\x43limateStateResponse\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\x1a\n\x04mode\x18\x02 \x01(\x0e\x32\x0c.ClimateMode\x12\x1b\n\x13\x63urrent_temperature\x18\x03 \x01(\x02\x12\x1a\n\x12target_temperature\x18\x04 \x01(\x02\x12\x1e\n\x16target_temperature_low\x18\x05 \x01(\x02\x12\x1f\n\x17target_temperature_high\x18\x06 \x01(\x02\x12\x0c\n\x04\x61way\x18\x07 \x01(\x08\x12\x1e\n\x06\x61\x63tion\x18\x08 \x01(\x0e\x32\x0e.ClimateAction\x12!\n\x08\x66\x61n_mode\x18\t \x01(\x0e\x32\x0f.ClimateFanMode\x12%\n\nswing_mode\x18\n \x01(\x0e\x32\x11.ClimateSwingMode"\xb0\x03\n\x15\x43limateCommandRequest\x12\x0b\n\x03key\x18\x01 \x01(\x07\x12\x10\n\x08has_mode\x18\x02 \x01(\x08\x12\x1a\n\x04mode\x18\x03 \x01(\x0e\x32\x0c.ClimateMode\x12\x1e\n\x16has_target_temperature\x18\x04 \x01(\x08\x12\x1a\n\x12target_temperature\x18\x05 \x01(\x02\x12"\n\x1ahas_target_temperature_low\x18\x06 \x01(\x08\x12\x1e\n\x16target_temperature_low\x18\x07 \x01(\x02\x12#\n\x1bhas_target_temperature_high\x18\x08 \x01(\x08\x12\x1f\n\x17target_temperature_high\x18\t \x01(\x02\x12\x10\n\x08has_away\x18\n \x01(\x08\x12\x0c\n\x04\x61way\x18\x0b \x01(\x08\x12\x14\n\x0chas_fan_mode\x18\x0c \x01(\x08\x12!\n\x08\x66\x61n_mode\x18\r \x01(\x0e\x32\x0f.ClimateFanMode\x12\x16\n\x0ehas_swing_mode\x18\x0e \x01(\x08\x12%\n\nswing_mode\x18\x0f \x01(\x0e\x32\x11.ClimateSwingMode"%\n\x14ProfilerStatsRequest\x12\r\n\x05reset\x18\x01 \x01(\x08"d\n\x13ProfilerTimingStats\x12\r\n\x05\x63ount\x18\x01 \x01(\r\x12\x0e\n\x06min_us\x18\x02 \x01(\r\x12\x0e\n\x06\x61vg_us\x18\x03 \x01(\r\x12\x0e\n\x06max_us\x18\x04 \x01(\r\x12\x0e\n\x06p99_us\x18\x05 \x01(\r"\x9a\x01\n\x15ProfilerStatsResponse\x12\x0e\n\x06source\x18\x01 \x01(\t\x12"\n\x04loop\x18\x02 \x01(\x0b\x32\x14.ProfilerTimingStats\x12$\n\x06update\x18\x03 \x01(\x0b\x32\x14.ProfilerTimingStats\x12\'\n\tscheduler\x18\x04 \x01(\x0b\x32\x14.ProfilerTimingStats"\x1b\n\x19ProfilerStatsDoneResponse*N\n\x10LegacyCoverState\x12\x1b\n\x17LEGACY_COVER_STATE_OPEN\x10\x00\x12\x1d\n\x19LEGACY_COVER_STATE_CLOSED\x10\x01*j\n\x0e\x43overOperation\x12\x18\n\x14\x43OVER_OPERATION_IDLE\x10\x00\x12\x1e\n\x1a\x43OVER_OPERATION_IS_OPENING\x10\x01\x12\x1e\n\x1a\x43OVER_OPERATION_IS_CLOSING\x10\x02*r\n\x12LegacyCoverCommand\x12\x1d\n\x19LEGACY_COVER_COMMAND_OPEN\x10\x00\x12\x1e\n\x1aLEGACY_COVER_COMMAND_CLOSE\x10\x01\x12\x1d\n\x19LEGACY_COVER_COMMAND_STOP\x10\x02*G\n\x08\x46\x61nSpeed\x12\x11\n\rFAN_SPEED_LOW\x10\x00\x12\x14\n\x10\x46\x41N_SPEED_MEDIUM\x10\x01\x12\x12\n\x0e\x46\x41N_SPEED_HIGH\x10\x02*D\n\x0c\x46\x61nDirection\x12\x19\n\x15\x46\x41N_DIRECTION_FORWARD\x10\x00\x12\x19\n\x15\x46\x41N_DIRECTION_REVERSE\x10\x01*\xa3\x01\n\x08LogLevel\x12\x12\n\x0eLOG_LEVEL_NONE\x10\x00\x12\x13\n\x0fLOG_LEVEL_ERROR\x10\x01\x12\x12\n\x0eLOG_LEVEL_WARN\x10\x02\x12\x12\n\x0eLOG_LEVEL_INFO\x10\x03\x12\x13\n\x0fLOG_LEVEL_DEBUG\x10\x04\x12\x15\n\x11LOG_LEVEL_VERBOSE\x10\x05\x12\x1a\n\x16LOG_LEVEL_VERY_VERBOSE\x10\x06*\x84\x02\n\x0eServiceArgType\x12\x19\n\x15SERVICE_ARG_TYPE_BOOL\x10\x00\x12\x18\n\x14SERVICE_ARG_TYPE_INT\x10\x01\x12\x1a\n\x16SERVICE_ARG_TYPE_FLOAT\x10\x02\x12\x1b\n\x17SERVICE_ARG_TYPE_STRING\x10\x03\x12\x1f\n\x1bSERVICE_ARG_TYPE_BOOL_ARRAY\x10\x04\x12\x1e\n\x1aSERVICE_ARG_TYPE_INT_ARRAY\x10\x05\x12 \n\x1cSERVICE_ARG_TYPE_FLOAT_ARRAY\x10\x06\x12!\n\x1dSERVICE_ARG_TYPE_STRING_ARRAY\x10\x07*\x99\x01\n\x0b\x43limateMode\x12\x14\n\x10\x43LIMATE_MODE_OFF\x10\x00\x12\x15\n\x11\x43LIMATE_MODE_AUTO\x10\x01\x12\x15\n\x11\x43LIMATE_MODE_COOL\x10\x02\x12\x15\n\x11\x43LIMATE_MODE_HEAT\x10\x03\x12\x19\n\x15\x43LIMATE_MODE_FAN_ONLY\x10\x04\x12\x14\n\x10\x43LIMATE_MODE_DRY\x10\x05*\xda\x01\n\x0e\x43limateFanMode\x12\x12\n\x0e\x43LIMATE_FAN_ON\x10\x00\x12\x13\n\x0f\x43LIMATE_FAN_OFF\x10\x01\x12\x14\n\x10\x43LIMATE_FAN_AUTO\x10\x02\x12\x13\n\x0f\x43LIMATE_FAN_LOW\x10\x03\x12\x16\n\x12\x43LIMATE_FAN_MEDIUM\x10\x04\x12\x14\n\x10\x43LIMATE_FAN_HIGH\x10\x05\x12\x16\n\x12\x43LIMATE_FAN_MIDDLE\x10\x06\x12\x15\n\x11\x43LIMATE_FAN_FOCUS\x10\x07\x12\x17\n\x13\x43LIMATE_FAN_DIFFUSE\x10\x08*{\n\x10\x43limateSwingMode\x12\x15\n\x11\x43LIMATE_SWING_OFF\x10\x00\x12\x16\n\x12\x43LIMATE_SWING_BOTH\x10\x01\x12\x1a\n\x16\x43LIMATE_SWING_VERTICAL\x10\x02\x12\x1c\n\x18\x43LIMATE_SWING_HORIZONTAL\x10\x03*\xab\x01\n\rClimateAction\x12\x16\n\x12\x43LIMATE_ACTION_OFF\x10\x00\x12\x1a\n\x16\x43LIMATE_ACTION_COOLING\x10\x02\x12\x1a\n\x16\x43LIMATE_ACTION_HEATING\x10\x03\x12\x17\n\x13\x43LIMATE_ACTION_IDLE\x10\x04\x12\x19\n\x15\x43LIMATE_ACTION_DRYING\x10\x05\x12\x16\n\x12\x43LIMATE_ACTION_FAN\x10\x06\x62\x06proto3'
     ),
 )
 
-_FANSPEED = _descriptor.EnumDescriptor(
-    name="FanSpeed",
-    full_name="FanSpeed",
+_LEGACYCOVERSTATE = _descriptor.EnumDescriptor(
+    name="LegacyCoverState",
+    full_name="LegacyCoverState",
     filename=None,
     file=DESCRIPTOR,
     values=[
         _descriptor.EnumValueDescriptor(
-            name="LOW", index=0, number=0, serialized_options=None, type=None
-        ),
-        _descriptor.EnumValueDescriptor(
-            name="MEDIUM", index=1, number=1, serialized_options=None, type=None
+            name="LEGACY_COVER_STATE_OPEN",
+            index=0,
+            number=0,
+            serialized_options=None,
+            type=None,
         ),
         _descriptor.EnumValueDescriptor(
-            name="HIGH", index=2, number=2, serialized_options=None, type=None
+            name="LEGACY_COVER_STATE_CLOSED",
+            index=1,
+            number=1,
+            serialized_options=None,
+            type=None,
         ),
     ],
     containing_type=None,
     serialized_options=None,
-    serialized_start=3822,
-    serialized_end=3863,
+    serialized_start=6507,
+    serialized_end=6585,
 )
-_sym_db.RegisterEnumDescriptor(_FANSPEED)
+_sym_db.RegisterEnumDescriptor(_LEGACYCOVERSTATE)
 
-FanSpeed = enum_type_wrapper.EnumTypeWrapper(_FANSPEED)
-_LOGLEVEL = _descriptor.EnumDescriptor(
-    name="LogLevel",
-    full_name="LogLevel",
+LegacyCoverState = enum_type_wrapper.EnumTypeWrapper(_LEGACYCOVERSTATE)
+_COVEROPERATION = _descriptor.EnumDescriptor(
+    name="CoverOperation",
+    full_name="CoverOperation",
     filename=None,
     file=DESCRIPTOR,
     values=[
         _descriptor.EnumValueDescriptor(
-            name="NONE", index=0, number=0, serialized_options=None, type=None
+            name="COVER_OPERATION_IDLE",
+            index=0,
+            number=0,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="COVER_OPERATION_IS_OPENING",
+            index=1,
+            number=1,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="COVER_OPERATION_IS_CLOSING",
+            index=2,
+            number=2,
+            serialized_options=None,
+            type=None,
         ),
+    ],
+    containing_type=None,
+    serialized_options=None,
+    serialized_start=6587,
+    serialized_end=6693,
+)
+_sym_db.RegisterEnumDescriptor(_COVEROPERATION)
+
+CoverOperation = enum_type_wrapper.EnumTypeWrapper(_COVEROPERATION)
+_LEGACYCOVERCOMMAND = _descriptor.EnumDescriptor(
+    name="LegacyCoverCommand",
+    full_name="LegacyCoverCommand",
+    filename=None,
+    file=DESCRIPTOR,
+    values=[
         _descriptor.EnumValueDescriptor(
-            name="ERROR", index=1, number=1, serialized_options=None, type=None
+            name="LEGACY_COVER_COMMAND_OPEN",
+            index=0,
+            number=0,
+            serialized_options=None,
+            type=None,
         ),
         _descriptor.EnumValueDescriptor(
-            name="WARN", index=2, number=2, serialized_options=None, type=None
+            name="LEGACY_COVER_COMMAND_CLOSE",
+            index=1,
+            number=1,
+            serialized_options=None,
+            type=None,
         ),
         _descriptor.EnumValueDescriptor(
-            name="INFO", index=3, number=3, serialized_options=None, type=None
+            name="LEGACY_COVER_COMMAND_STOP",
+            index=2,
+            number=2,
+            serialized_options=None,
+            type=None,
         ),
+    ],
+    containing_type=None,
+    serialized_options=None,
+    serialized_start=6695,
+    serialized_end=6809,
+)
+_sym_db.RegisterEnumDescriptor(_LEGACYCOVERCOMMAND)
+
+LegacyCoverCommand = enum_type_wrapper.EnumTypeWrapper(_LEGACYCOVERCOMMAND)
+_FANSPEED = _descriptor.EnumDescriptor(
+    name="FanSpeed",
+    full_name="FanSpeed",
+    filename=None,
+    file=DESCRIPTOR,
+    values=[
         _descriptor.EnumValueDescriptor(
-            name="DEBUG", index=4, number=4, serialized_options=None, type=None
+            name="FAN_SPEED_LOW", index=0, number=0, serialized_options=None, type=None
         ),
         _descriptor.EnumValueDescriptor(
-            name="VERBOSE", index=5, number=5, serialized_options=None, type=None
+            name="FAN_SPEED_MEDIUM",
+            index=1,
+            number=1,
+            serialized_options=None,
+            type=None,
         ),
         _descriptor.EnumValueDescriptor(
-            name="VERY_VERBOSE", index=6, number=6, serialized_options=None, type=None
+            name="FAN_SPEED_HIGH", index=2, number=2, serialized_options=None, type=None
         ),
     ],
     containing_type=None,
     serialized_options=None,
-    serialized_start=3865,
-    serialized_end=3958,
+    serialized_start=6811,
+    serialized_end=6882,
 )
-_sym_db.RegisterEnumDescriptor(_LOGLEVEL)
-
-LogLevel = enum_type_wrapper.EnumTypeWrapper(_LOGLEVEL)
-LOW = 0
-MEDIUM = 1
-HIGH = 2
-NONE = 0
-ERROR = 1
-WARN = 2
-INFO = 3
-DEBUG = 4
-VERBOSE = 5
-VERY_VERBOSE = 6
-
+_sym_db.RegisterEnumDescriptor(_FANSPEED)
 
-_COVERSTATERESPONSE_COVERSTATE = _descriptor.EnumDescriptor(
-    name="CoverState",
-    full_name="CoverStateResponse.CoverState",
+FanSpeed = enum_type_wrapper.EnumTypeWrapper(_FANSPEED)
+_FANDIRECTION = _descriptor.EnumDescriptor(
+    name="FanDirection",
+    full_name="FanDirection",
     filename=None,
     file=DESCRIPTOR,
     values=[
         _descriptor.EnumValueDescriptor(
-            name="OPEN", index=0, number=0, serialized_options=None, type=None
+            name="FAN_DIRECTION_FORWARD",
+            index=0,
+            number=0,
+            serialized_options=None,
+            type=None,
         ),
         _descriptor.EnumValueDescriptor(
-            name="CLOSED", index=1, number=1, serialized_options=None, type=None
+            name="FAN_DIRECTION_REVERSE",
+            index=1,
+            number=1,
+            serialized_options=None,
+            type=None,
         ),
     ],
     containing_type=None,
     serialized_options=None,
-    serialized_start=1808,
-    serialized_end=1842,
+    serialized_start=6884,
+    serialized_end=6952,
 )
-_sym_db.RegisterEnumDescriptor(_COVERSTATERESPONSE_COVERSTATE)
+_sym_db.RegisterEnumDescriptor(_FANDIRECTION)
 
-_COVERCOMMANDREQUEST_COVERCOMMAND = _descriptor.EnumDescriptor(
-    name="CoverCommand",
-    full_name="CoverCommandRequest.CoverCommand",
+FanDirection = enum_type_wrapper.EnumTypeWrapper(_FANDIRECTION)
+_LOGLEVEL = _descriptor.EnumDescriptor(
+    name="LogLevel",
+    full_name="LogLevel",
     filename=None,
     file=DESCRIPTOR,
     values=[
         _descriptor.EnumValueDescriptor(
-            name="OPEN", index=0, number=0, serialized_options=None, type=None
+            name="LOG_LEVEL_NONE", index=0, number=0, serialized_options=None, type=None
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="LOG_LEVEL_ERROR",
+            index=1,
+            number=1,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="LOG_LEVEL_WARN", index=2, number=2, serialized_options=None, type=None
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="LOG_LEVEL_INFO", index=3, number=3, serialized_options=None, type=None
         ),
         _descriptor.EnumValueDescriptor(
-            name="CLOSE", index=1, number=1, serialized_options=None, type=None
+            name="LOG_LEVEL_DEBUG",
+            index=4,
+            number=4,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="LOG_LEVEL_VERBOSE",
+            index=5,
+            number=5,
+            serialized_options=None,
+            type=None,
         ),
         _descriptor.EnumValueDescriptor(
-            name="STOP", index=2, number=2, serialized_options=None, type=None
+            name="LOG_LEVEL_VERY_VERBOSE",
+            index=6,
+            number=6,
+            serialized_options=None,
+            type=None,
         ),
     ],
     containing_type=None,
     serialized_options=None,
-    serialized_start=2375,
-    serialized_end=2420,
+    serialized_start=6955,
+    serialized_end=7118,
 )
-_sym_db.RegisterEnumDescriptor(_COVERCOMMANDREQUEST_COVERCOMMAND)
-
+_sym_db.RegisterEnumDescriptor(_LOGLEVEL)
 
-_HELLOREQUEST = _descriptor.Descriptor(
-    name="HelloRequest",
-    full_name="HelloRequest",
+LogLevel = enum_type_wrapper.EnumTypeWrapper(_LOGLEVEL)
+_SERVICEARGTYPE = _descriptor.EnumDescriptor(
+    name="ServiceArgType",
+    full_name="ServiceArgType",
     filename=None,
     file=DESCRIPTOR,
-    containing_type=None,
-    fields=[
-        _descriptor.FieldDescriptor(
-            name="client_info",
-            full_name="HelloRequest.client_info",
+    values=[
+        _descriptor.EnumValueDescriptor(
+            name="SERVICE_ARG_TYPE_BOOL",
             index=0,
+            number=0,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="SERVICE_ARG_TYPE_INT",
+            index=1,
             number=1,
-            type=9,
-            cpp_type=9,
-            label=1,
-            has_default_value=False,
-            default_value=_b("").decode("utf-8"),
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
             serialized_options=None,
-            file=DESCRIPTOR,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="SERVICE_ARG_TYPE_FLOAT",
+            index=2,
+            number=2,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="SERVICE_ARG_TYPE_STRING",
+            index=3,
+            number=3,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="SERVICE_ARG_TYPE_BOOL_ARRAY",
+            index=4,
+            number=4,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="SERVICE_ARG_TYPE_INT_ARRAY",
+            index=5,
+            number=5,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="SERVICE_ARG_TYPE_FLOAT_ARRAY",
+            index=6,
+            number=6,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="SERVICE_ARG_TYPE_STRING_ARRAY",
+            index=7,
+            number=7,
+            serialized_options=None,
+            type=None,
         ),
     ],
-    extensions=[],
-    nested_types=[],
-    enum_types=[],
+    containing_type=None,
     serialized_options=None,
-    is_extendable=False,
-    syntax="proto3",
-    extension_ranges=[],
-    oneofs=[],
-    serialized_start=13,
-    serialized_end=48,
+    serialized_start=7121,
+    serialized_end=7381,
 )
+_sym_db.RegisterEnumDescriptor(_SERVICEARGTYPE)
 
-
-_HELLORESPONSE = _descriptor.Descriptor(
-    name="HelloResponse",
-    full_name="HelloResponse",
+ServiceArgType = enum_type_wrapper.EnumTypeWrapper(_SERVICEARGTYPE)
+_CLIMATEMODE = _descriptor.EnumDescriptor(
+    name="ClimateMode",
+    full_name="ClimateMode",
     filename=None,
     file=DESCRIPTOR,
-    containing_type=None,
-    fields=[
-        _descriptor.FieldDescriptor(
-            name="api_version_major",
-            full_name="HelloResponse.api_version_major",
+    values=[
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_MODE_OFF",
             index=0,
-            number=1,
-            type=13,
-            cpp_type=3,
-            label=1,
-            has_default_value=False,
-            default_value=0,
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
+            number=0,
             serialized_options=None,
-            file=DESCRIPTOR,
+            type=None,
         ),
-        _descriptor.FieldDescriptor(
-            name="api_version_minor",
-            full_name="HelloResponse.api_version_minor",
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_MODE_AUTO",
             index=1,
-            number=2,
-            type=13,
-            cpp_type=3,
-            label=1,
-            has_default_value=False,
-            default_value=0,
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
+            number=1,
             serialized_options=None,
-            file=DESCRIPTOR,
+            type=None,
         ),
-        _descriptor.FieldDescriptor(
-            name="server_info",
-            full_name="HelloResponse.server_info",
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_MODE_COOL",
             index=2,
+            number=2,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_MODE_HEAT",
+            index=3,
             number=3,
-            type=9,
-            cpp_type=9,
-            label=1,
-            has_default_value=False,
-            default_value=_b("").decode("utf-8"),
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
             serialized_options=None,
-            file=DESCRIPTOR,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_MODE_FAN_ONLY",
+            index=4,
+            number=4,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_MODE_DRY",
+            index=5,
+            number=5,
+            serialized_options=None,
+            type=None,
         ),
     ],
-    extensions=[],
-    nested_types=[],
-    enum_types=[],
+    containing_type=None,
     serialized_options=None,
-    is_extendable=False,
-    syntax="proto3",
-    extension_ranges=[],
-    oneofs=[],
-    serialized_start=50,
-    serialized_end=140,
+    serialized_start=7384,
+    serialized_end=7537,
 )
+_sym_db.RegisterEnumDescriptor(_CLIMATEMODE)
 
-
-_CONNECTREQUEST = _descriptor.Descriptor(
-    name="ConnectRequest",
-    full_name="ConnectRequest",
+ClimateMode = enum_type_wrapper.EnumTypeWrapper(_CLIMATEMODE)
+_CLIMATEFANMODE = _descriptor.EnumDescriptor(
+    name="ClimateFanMode",
+    full_name="ClimateFanMode",
     filename=None,
     file=DESCRIPTOR,
-    containing_type=None,
-    fields=[
-        _descriptor.FieldDescriptor(
-            name="password",
-            full_name="ConnectRequest.password",
-            index=0,
+    values=[
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_FAN_ON", index=0, number=0, serialized_options=None, type=None
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_FAN_OFF",
+            index=1,
             number=1,
-            type=9,
-            cpp_type=9,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_FAN_AUTO",
+            index=2,
+            number=2,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_FAN_LOW",
+            index=3,
+            number=3,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_FAN_MEDIUM",
+            index=4,
+            number=4,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_FAN_HIGH",
+            index=5,
+            number=5,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_FAN_MIDDLE",
+            index=6,
+            number=6,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_FAN_FOCUS",
+            index=7,
+            number=7,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_FAN_DIFFUSE",
+            index=8,
+            number=8,
+            serialized_options=None,
+            type=None,
+        ),
+    ],
+    containing_type=None,
+    serialized_options=None,
+    serialized_start=7540,
+    serialized_end=7758,
+)
+_sym_db.RegisterEnumDescriptor(_CLIMATEFANMODE)
+
+ClimateFanMode = enum_type_wrapper.EnumTypeWrapper(_CLIMATEFANMODE)
+_CLIMATESWINGMODE = _descriptor.EnumDescriptor(
+    name="ClimateSwingMode",
+    full_name="ClimateSwingMode",
+    filename=None,
+    file=DESCRIPTOR,
+    values=[
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_SWING_OFF",
+            index=0,
+            number=0,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_SWING_BOTH",
+            index=1,
+            number=1,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_SWING_VERTICAL",
+            index=2,
+            number=2,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_SWING_HORIZONTAL",
+            index=3,
+            number=3,
+            serialized_options=None,
+            type=None,
+        ),
+    ],
+    containing_type=None,
+    serialized_options=None,
+    serialized_start=7760,
+    serialized_end=7883,
+)
+_sym_db.RegisterEnumDescriptor(_CLIMATESWINGMODE)
+
+ClimateSwingMode = enum_type_wrapper.EnumTypeWrapper(_CLIMATESWINGMODE)
+_CLIMATEACTION = _descriptor.EnumDescriptor(
+    name="ClimateAction",
+    full_name="ClimateAction",
+    filename=None,
+    file=DESCRIPTOR,
+    values=[
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_ACTION_OFF",
+            index=0,
+            number=0,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_ACTION_COOLING",
+            index=1,
+            number=2,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_ACTION_HEATING",
+            index=2,
+            number=3,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_ACTION_IDLE",
+            index=3,
+            number=4,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_ACTION_DRYING",
+            index=4,
+            number=5,
+            serialized_options=None,
+            type=None,
+        ),
+        _descriptor.EnumValueDescriptor(
+            name="CLIMATE_ACTION_FAN",
+            index=5,
+            number=6,
+            serialized_options=None,
+            type=None,
+        ),
+    ],
+    containing_type=None,
+    serialized_options=None,
+    serialized_start=7886,
+    serialized_end=8057,
+)
+_sym_db.RegisterEnumDescriptor(_CLIMATEACTION)
+
+ClimateAction = enum_type_wrapper.EnumTypeWrapper(_CLIMATEACTION)
+LEGACY_COVER_STATE_OPEN = 0
+LEGACY_COVER_STATE_CLOSED = 1
+COVER_OPERATION_IDLE = 0
+COVER_OPERATION_IS_OPENING = 1
+COVER_OPERATION_IS_CLOSING = 2
+LEGACY_COVER_COMMAND_OPEN = 0
+LEGACY_COVER_COMMAND_CLOSE = 1
+LEGACY_COVER_COMMAND_STOP = 2
+FAN_SPEED_LOW = 0
+FAN_SPEED_MEDIUM = 1
+FAN_SPEED_HIGH = 2
+FAN_DIRECTION_FORWARD = 0
+FAN_DIRECTION_REVERSE = 1
+LOG_LEVEL_NONE = 0
+LOG_LEVEL_ERROR = 1
+LOG_LEVEL_WARN = 2
+LOG_LEVEL_INFO = 3
+LOG_LEVEL_DEBUG = 4
+LOG_LEVEL_VERBOSE = 5
+LOG_LEVEL_VERY_VERBOSE = 6
+SERVICE_ARG_TYPE_BOOL = 0
+SERVICE_ARG_TYPE_INT = 1
+SERVICE_ARG_TYPE_FLOAT = 2
+SERVICE_ARG_TYPE_STRING = 3
+SERVICE_ARG_TYPE_BOOL_ARRAY = 4
+SERVICE_ARG_TYPE_INT_ARRAY = 5
+SERVICE_ARG_TYPE_FLOAT_ARRAY = 6
+SERVICE_ARG_TYPE_STRING_ARRAY = 7
+CLIMATE_MODE_OFF = 0
+CLIMATE_MODE_AUTO = 1
+CLIMATE_MODE_COOL = 2
+CLIMATE_MODE_HEAT = 3
+CLIMATE_MODE_FAN_ONLY = 4
+CLIMATE_MODE_DRY = 5
+CLIMATE_FAN_ON = 0
+CLIMATE_FAN_OFF = 1
+CLIMATE_FAN_AUTO = 2
+CLIMATE_FAN_LOW = 3
+CLIMATE_FAN_MEDIUM = 4
+CLIMATE_FAN_HIGH = 5
+CLIMATE_FAN_MIDDLE = 6
+CLIMATE_FAN_FOCUS = 7
+CLIMATE_FAN_DIFFUSE = 8
+CLIMATE_SWING_OFF = 0
+CLIMATE_SWING_BOTH = 1
+CLIMATE_SWING_VERTICAL = 2
+CLIMATE_SWING_HORIZONTAL = 3
+CLIMATE_ACTION_OFF = 0
+CLIMATE_ACTION_COOLING = 2
+CLIMATE_ACTION_HEATING = 3
+CLIMATE_ACTION_IDLE = 4
+CLIMATE_ACTION_DRYING = 5
+CLIMATE_ACTION_FAN = 6
+
+
+_HELLOREQUEST = _descriptor.Descriptor(
+    name="HelloRequest",
+    full_name="HelloRequest",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="client_info",
+            full_name="HelloRequest.client_info",
+            index=0,
+            number=1,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=13,
+    serialized_end=48,
+)
+
+
+_HELLORESPONSE = _descriptor.Descriptor(
+    name="HelloResponse",
+    full_name="HelloResponse",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="api_version_major",
+            full_name="HelloResponse.api_version_major",
+            index=0,
+            number=1,
+            type=13,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="api_version_minor",
+            full_name="HelloResponse.api_version_minor",
+            index=1,
+            number=2,
+            type=13,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="server_info",
+            full_name="HelloResponse.server_info",
+            index=2,
+            number=3,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=50,
+    serialized_end=140,
+)
+
+
+_CONNECTREQUEST = _descriptor.Descriptor(
+    name="ConnectRequest",
+    full_name="ConnectRequest",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="password",
+            full_name="ConnectRequest.password",
+            index=0,
+            number=1,
+            type=9,
+            cpp_type=9,
             label=1,
             has_default_value=False,
             default_value=_b("").decode("utf-8"),
@@ -429,28 +880,2158 @@ _DEVICEINFOREQUEST = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=297,
-    serialized_end=316,
+    serialized_start=297,
+    serialized_end=316,
+)
+
+
+_DEVICEINFORESPONSE = _descriptor.Descriptor(
+    name="DeviceInfoResponse",
+    full_name="DeviceInfoResponse",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="uses_password",
+            full_name="DeviceInfoResponse.uses_password",
+            index=0,
+            number=1,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="name",
+            full_name="DeviceInfoResponse.name",
+            index=1,
+            number=2,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="mac_address",
+            full_name="DeviceInfoResponse.mac_address",
+            index=2,
+            number=3,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="esphome_version",
+            full_name="DeviceInfoResponse.esphome_version",
+            index=3,
+            number=4,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="compilation_time",
+            full_name="DeviceInfoResponse.compilation_time",
+            index=4,
+            number=5,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="model",
+            full_name="DeviceInfoResponse.model",
+            index=5,
+            number=6,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_deep_sleep",
+            full_name="DeviceInfoResponse.has_deep_sleep",
+            index=6,
+            number=7,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=319,
+    serialized_end=487,
+)
+
+
+_LISTENTITIESREQUEST = _descriptor.Descriptor(
+    name="ListEntitiesRequest",
+    full_name="ListEntitiesRequest",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=489,
+    serialized_end=510,
+)
+
+
+_LISTENTITIESDONERESPONSE = _descriptor.Descriptor(
+    name="ListEntitiesDoneResponse",
+    full_name="ListEntitiesDoneResponse",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=512,
+    serialized_end=538,
+)
+
+
+_SUBSCRIBESTATESREQUEST = _descriptor.Descriptor(
+    name="SubscribeStatesRequest",
+    full_name="SubscribeStatesRequest",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=540,
+    serialized_end=564,
+)
+
+
+_LISTENTITIESBINARYSENSORRESPONSE = _descriptor.Descriptor(
+    name="ListEntitiesBinarySensorResponse",
+    full_name="ListEntitiesBinarySensorResponse",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="object_id",
+            full_name="ListEntitiesBinarySensorResponse.object_id",
+            index=0,
+            number=1,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="key",
+            full_name="ListEntitiesBinarySensorResponse.key",
+            index=1,
+            number=2,
+            type=7,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="name",
+            full_name="ListEntitiesBinarySensorResponse.name",
+            index=2,
+            number=3,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="unique_id",
+            full_name="ListEntitiesBinarySensorResponse.unique_id",
+            index=3,
+            number=4,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="device_class",
+            full_name="ListEntitiesBinarySensorResponse.device_class",
+            index=4,
+            number=5,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="is_status_binary_sensor",
+            full_name="ListEntitiesBinarySensorResponse.is_status_binary_sensor",
+            index=5,
+            number=6,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=567,
+    serialized_end=721,
+)
+
+
+_BINARYSENSORSTATERESPONSE = _descriptor.Descriptor(
+    name="BinarySensorStateResponse",
+    full_name="BinarySensorStateResponse",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="key",
+            full_name="BinarySensorStateResponse.key",
+            index=0,
+            number=1,
+            type=7,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="state",
+            full_name="BinarySensorStateResponse.state",
+            index=1,
+            number=2,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="missing_state",
+            full_name="BinarySensorStateResponse.missing_state",
+            index=2,
+            number=3,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=723,
+    serialized_end=801,
+)
+
+
+_LISTENTITIESCOVERRESPONSE = _descriptor.Descriptor(
+    name="ListEntitiesCoverResponse",
+    full_name="ListEntitiesCoverResponse",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="object_id",
+            full_name="ListEntitiesCoverResponse.object_id",
+            index=0,
+            number=1,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="key",
+            full_name="ListEntitiesCoverResponse.key",
+            index=1,
+            number=2,
+            type=7,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="name",
+            full_name="ListEntitiesCoverResponse.name",
+            index=2,
+            number=3,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="unique_id",
+            full_name="ListEntitiesCoverResponse.unique_id",
+            index=3,
+            number=4,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="assumed_state",
+            full_name="ListEntitiesCoverResponse.assumed_state",
+            index=4,
+            number=5,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="supports_position",
+            full_name="ListEntitiesCoverResponse.supports_position",
+            index=5,
+            number=6,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="supports_tilt",
+            full_name="ListEntitiesCoverResponse.supports_tilt",
+            index=6,
+            number=7,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="device_class",
+            full_name="ListEntitiesCoverResponse.device_class",
+            index=7,
+            number=8,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=804,
+    serialized_end=991,
+)
+
+
+_COVERSTATERESPONSE = _descriptor.Descriptor(
+    name="CoverStateResponse",
+    full_name="CoverStateResponse",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="key",
+            full_name="CoverStateResponse.key",
+            index=0,
+            number=1,
+            type=7,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="legacy_state",
+            full_name="CoverStateResponse.legacy_state",
+            index=1,
+            number=2,
+            type=14,
+            cpp_type=8,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="position",
+            full_name="CoverStateResponse.position",
+            index=2,
+            number=3,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="tilt",
+            full_name="CoverStateResponse.tilt",
+            index=3,
+            number=4,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="current_operation",
+            full_name="CoverStateResponse.current_operation",
+            index=4,
+            number=5,
+            type=14,
+            cpp_type=8,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=994,
+    serialized_end=1144,
+)
+
+
+_COVERCOMMANDREQUEST = _descriptor.Descriptor(
+    name="CoverCommandRequest",
+    full_name="CoverCommandRequest",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="key",
+            full_name="CoverCommandRequest.key",
+            index=0,
+            number=1,
+            type=7,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_legacy_command",
+            full_name="CoverCommandRequest.has_legacy_command",
+            index=1,
+            number=2,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="legacy_command",
+            full_name="CoverCommandRequest.legacy_command",
+            index=2,
+            number=3,
+            type=14,
+            cpp_type=8,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_position",
+            full_name="CoverCommandRequest.has_position",
+            index=3,
+            number=4,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="position",
+            full_name="CoverCommandRequest.position",
+            index=4,
+            number=5,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_tilt",
+            full_name="CoverCommandRequest.has_tilt",
+            index=5,
+            number=6,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="tilt",
+            full_name="CoverCommandRequest.tilt",
+            index=6,
+            number=7,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="stop",
+            full_name="CoverCommandRequest.stop",
+            index=7,
+            number=8,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=1147,
+    serialized_end=1340,
+)
+
+
+_LISTENTITIESFANRESPONSE = _descriptor.Descriptor(
+    name="ListEntitiesFanResponse",
+    full_name="ListEntitiesFanResponse",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="object_id",
+            full_name="ListEntitiesFanResponse.object_id",
+            index=0,
+            number=1,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="key",
+            full_name="ListEntitiesFanResponse.key",
+            index=1,
+            number=2,
+            type=7,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="name",
+            full_name="ListEntitiesFanResponse.name",
+            index=2,
+            number=3,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="unique_id",
+            full_name="ListEntitiesFanResponse.unique_id",
+            index=3,
+            number=4,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="supports_oscillation",
+            full_name="ListEntitiesFanResponse.supports_oscillation",
+            index=4,
+            number=5,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="supports_speed",
+            full_name="ListEntitiesFanResponse.supports_speed",
+            index=5,
+            number=6,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="supports_direction",
+            full_name="ListEntitiesFanResponse.supports_direction",
+            index=6,
+            number=7,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="supported_speed_count",
+            full_name="ListEntitiesFanResponse.supported_speed_count",
+            index=7,
+            number=8,
+            type=5,
+            cpp_type=1,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=1343,
+    serialized_end=1546,
+)
+
+
+_FANSTATERESPONSE = _descriptor.Descriptor(
+    name="FanStateResponse",
+    full_name="FanStateResponse",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="key",
+            full_name="FanStateResponse.key",
+            index=0,
+            number=1,
+            type=7,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="state",
+            full_name="FanStateResponse.state",
+            index=1,
+            number=2,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="oscillating",
+            full_name="FanStateResponse.oscillating",
+            index=2,
+            number=3,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="speed",
+            full_name="FanStateResponse.speed",
+            index=3,
+            number=4,
+            type=14,
+            cpp_type=8,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="direction",
+            full_name="FanStateResponse.direction",
+            index=4,
+            number=5,
+            type=14,
+            cpp_type=8,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="speed_level",
+            full_name="FanStateResponse.speed_level",
+            index=5,
+            number=6,
+            type=5,
+            cpp_type=1,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=1549,
+    serialized_end=1697,
+)
+
+
+_FANCOMMANDREQUEST = _descriptor.Descriptor(
+    name="FanCommandRequest",
+    full_name="FanCommandRequest",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="key",
+            full_name="FanCommandRequest.key",
+            index=0,
+            number=1,
+            type=7,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_state",
+            full_name="FanCommandRequest.has_state",
+            index=1,
+            number=2,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="state",
+            full_name="FanCommandRequest.state",
+            index=2,
+            number=3,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_speed",
+            full_name="FanCommandRequest.has_speed",
+            index=3,
+            number=4,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="speed",
+            full_name="FanCommandRequest.speed",
+            index=4,
+            number=5,
+            type=14,
+            cpp_type=8,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_oscillating",
+            full_name="FanCommandRequest.has_oscillating",
+            index=5,
+            number=6,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="oscillating",
+            full_name="FanCommandRequest.oscillating",
+            index=6,
+            number=7,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_direction",
+            full_name="FanCommandRequest.has_direction",
+            index=7,
+            number=8,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="direction",
+            full_name="FanCommandRequest.direction",
+            index=8,
+            number=9,
+            type=14,
+            cpp_type=8,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_speed_level",
+            full_name="FanCommandRequest.has_speed_level",
+            index=9,
+            number=10,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="speed_level",
+            full_name="FanCommandRequest.speed_level",
+            index=10,
+            number=11,
+            type=5,
+            cpp_type=1,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=1700,
+    serialized_end=1960,
+)
+
+
+_LISTENTITIESLIGHTRESPONSE = _descriptor.Descriptor(
+    name="ListEntitiesLightResponse",
+    full_name="ListEntitiesLightResponse",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="object_id",
+            full_name="ListEntitiesLightResponse.object_id",
+            index=0,
+            number=1,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="key",
+            full_name="ListEntitiesLightResponse.key",
+            index=1,
+            number=2,
+            type=7,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="name",
+            full_name="ListEntitiesLightResponse.name",
+            index=2,
+            number=3,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="unique_id",
+            full_name="ListEntitiesLightResponse.unique_id",
+            index=3,
+            number=4,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="supports_brightness",
+            full_name="ListEntitiesLightResponse.supports_brightness",
+            index=4,
+            number=5,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="supports_rgb",
+            full_name="ListEntitiesLightResponse.supports_rgb",
+            index=5,
+            number=6,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="supports_white_value",
+            full_name="ListEntitiesLightResponse.supports_white_value",
+            index=6,
+            number=7,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="supports_color_temperature",
+            full_name="ListEntitiesLightResponse.supports_color_temperature",
+            index=7,
+            number=8,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="min_mireds",
+            full_name="ListEntitiesLightResponse.min_mireds",
+            index=8,
+            number=9,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="max_mireds",
+            full_name="ListEntitiesLightResponse.max_mireds",
+            index=9,
+            number=10,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="effects",
+            full_name="ListEntitiesLightResponse.effects",
+            index=10,
+            number=11,
+            type=9,
+            cpp_type=9,
+            label=3,
+            has_default_value=False,
+            default_value=[],
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=1963,
+    serialized_end=2229,
+)
+
+
+_LIGHTSTATERESPONSE = _descriptor.Descriptor(
+    name="LightStateResponse",
+    full_name="LightStateResponse",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="key",
+            full_name="LightStateResponse.key",
+            index=0,
+            number=1,
+            type=7,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="state",
+            full_name="LightStateResponse.state",
+            index=1,
+            number=2,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="brightness",
+            full_name="LightStateResponse.brightness",
+            index=2,
+            number=3,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="red",
+            full_name="LightStateResponse.red",
+            index=3,
+            number=4,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="green",
+            full_name="LightStateResponse.green",
+            index=4,
+            number=5,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="blue",
+            full_name="LightStateResponse.blue",
+            index=5,
+            number=6,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="white",
+            full_name="LightStateResponse.white",
+            index=6,
+            number=7,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="color_temperature",
+            full_name="LightStateResponse.color_temperature",
+            index=7,
+            number=8,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="effect",
+            full_name="LightStateResponse.effect",
+            index=8,
+            number=9,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=2232,
+    serialized_end=2400,
+)
+
+
+_LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
+    name="LightCommandRequest",
+    full_name="LightCommandRequest",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="key",
+            full_name="LightCommandRequest.key",
+            index=0,
+            number=1,
+            type=7,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_state",
+            full_name="LightCommandRequest.has_state",
+            index=1,
+            number=2,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="state",
+            full_name="LightCommandRequest.state",
+            index=2,
+            number=3,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_brightness",
+            full_name="LightCommandRequest.has_brightness",
+            index=3,
+            number=4,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="brightness",
+            full_name="LightCommandRequest.brightness",
+            index=4,
+            number=5,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_rgb",
+            full_name="LightCommandRequest.has_rgb",
+            index=5,
+            number=6,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="red",
+            full_name="LightCommandRequest.red",
+            index=6,
+            number=7,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="green",
+            full_name="LightCommandRequest.green",
+            index=7,
+            number=8,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="blue",
+            full_name="LightCommandRequest.blue",
+            index=8,
+            number=9,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_white",
+            full_name="LightCommandRequest.has_white",
+            index=9,
+            number=10,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="white",
+            full_name="LightCommandRequest.white",
+            index=10,
+            number=11,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_color_temperature",
+            full_name="LightCommandRequest.has_color_temperature",
+            index=11,
+            number=12,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="color_temperature",
+            full_name="LightCommandRequest.color_temperature",
+            index=12,
+            number=13,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_transition_length",
+            full_name="LightCommandRequest.has_transition_length",
+            index=13,
+            number=14,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="transition_length",
+            full_name="LightCommandRequest.transition_length",
+            index=14,
+            number=15,
+            type=13,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_flash_length",
+            full_name="LightCommandRequest.has_flash_length",
+            index=15,
+            number=16,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="flash_length",
+            full_name="LightCommandRequest.flash_length",
+            index=16,
+            number=17,
+            type=13,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_effect",
+            full_name="LightCommandRequest.has_effect",
+            index=17,
+            number=18,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="effect",
+            full_name="LightCommandRequest.effect",
+            index=18,
+            number=19,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=2403,
+    serialized_end=2808,
 )
 
 
-_DEVICEINFORESPONSE = _descriptor.Descriptor(
-    name="DeviceInfoResponse",
-    full_name="DeviceInfoResponse",
+_LISTENTITIESSENSORRESPONSE = _descriptor.Descriptor(
+    name="ListEntitiesSensorResponse",
+    full_name="ListEntitiesSensorResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
-            name="uses_password",
-            full_name="DeviceInfoResponse.uses_password",
+            name="object_id",
+            full_name="ListEntitiesSensorResponse.object_id",
             index=0,
             number=1,
-            type=8,
-            cpp_type=7,
+            type=9,
+            cpp_type=9,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=_b("").decode("utf-8"),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -460,15 +3041,15 @@ _DEVICEINFORESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="name",
-            full_name="DeviceInfoResponse.name",
+            name="key",
+            full_name="ListEntitiesSensorResponse.key",
             index=1,
             number=2,
-            type=9,
-            cpp_type=9,
+            type=7,
+            cpp_type=3,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -478,8 +3059,8 @@ _DEVICEINFORESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="mac_address",
-            full_name="DeviceInfoResponse.mac_address",
+            name="name",
+            full_name="ListEntitiesSensorResponse.name",
             index=2,
             number=3,
             type=9,
@@ -496,8 +3077,8 @@ _DEVICEINFORESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="esphome_core_version",
-            full_name="DeviceInfoResponse.esphome_core_version",
+            name="unique_id",
+            full_name="ListEntitiesSensorResponse.unique_id",
             index=3,
             number=4,
             type=9,
@@ -514,8 +3095,8 @@ _DEVICEINFORESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="compilation_time",
-            full_name="DeviceInfoResponse.compilation_time",
+            name="icon",
+            full_name="ListEntitiesSensorResponse.icon",
             index=4,
             number=5,
             type=9,
@@ -532,8 +3113,8 @@ _DEVICEINFORESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="model",
-            full_name="DeviceInfoResponse.model",
+            name="unit_of_measurement",
+            full_name="ListEntitiesSensorResponse.unit_of_measurement",
             index=5,
             number=6,
             type=9,
@@ -550,10 +3131,28 @@ _DEVICEINFORESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="has_deep_sleep",
-            full_name="DeviceInfoResponse.has_deep_sleep",
+            name="accuracy_decimals",
+            full_name="ListEntitiesSensorResponse.accuracy_decimals",
             index=6,
             number=7,
+            type=5,
+            cpp_type=1,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="force_update",
+            full_name="ListEntitiesSensorResponse.force_update",
+            index=7,
+            number=8,
             type=8,
             cpp_type=7,
             label=1,
@@ -567,6 +3166,24 @@ _DEVICEINFORESPONSE = _descriptor.Descriptor(
             serialized_options=None,
             file=DESCRIPTOR,
         ),
+        _descriptor.FieldDescriptor(
+            name="device_class",
+            full_name="ListEntitiesSensorResponse.device_class",
+            index=8,
+            number=9,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
     ],
     extensions=[],
     nested_types=[],
@@ -576,18 +3193,73 @@ _DEVICEINFORESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=319,
-    serialized_end=492,
+    serialized_start=2811,
+    serialized_end=3018,
 )
 
 
-_LISTENTITIESREQUEST = _descriptor.Descriptor(
-    name="ListEntitiesRequest",
-    full_name="ListEntitiesRequest",
+_SENSORSTATERESPONSE = _descriptor.Descriptor(
+    name="SensorStateResponse",
+    full_name="SensorStateResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
-    fields=[],
+    fields=[
+        _descriptor.FieldDescriptor(
+            name="key",
+            full_name="SensorStateResponse.key",
+            index=0,
+            number=1,
+            type=7,
+            cpp_type=3,
+            label=1,
+            has_default_value=False,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="state",
+            full_name="SensorStateResponse.state",
+            index=1,
+            number=2,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="missing_state",
+            full_name="SensorStateResponse.missing_state",
+            index=2,
+            number=3,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+    ],
     extensions=[],
     nested_types=[],
     enum_types=[],
@@ -596,21 +3268,21 @@ _LISTENTITIESREQUEST = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=494,
-    serialized_end=515,
+    serialized_start=3020,
+    serialized_end=3092,
 )
 
 
-_LISTENTITIESBINARYSENSORRESPONSE = _descriptor.Descriptor(
-    name="ListEntitiesBinarySensorResponse",
-    full_name="ListEntitiesBinarySensorResponse",
+_LISTENTITIESSWITCHRESPONSE = _descriptor.Descriptor(
+    name="ListEntitiesSwitchResponse",
+    full_name="ListEntitiesSwitchResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
             name="object_id",
-            full_name="ListEntitiesBinarySensorResponse.object_id",
+            full_name="ListEntitiesSwitchResponse.object_id",
             index=0,
             number=1,
             type=9,
@@ -628,7 +3300,7 @@ _LISTENTITIESBINARYSENSORRESPONSE = _descriptor.Descriptor(
         ),
         _descriptor.FieldDescriptor(
             name="key",
-            full_name="ListEntitiesBinarySensorResponse.key",
+            full_name="ListEntitiesSwitchResponse.key",
             index=1,
             number=2,
             type=7,
@@ -646,7 +3318,7 @@ _LISTENTITIESBINARYSENSORRESPONSE = _descriptor.Descriptor(
         ),
         _descriptor.FieldDescriptor(
             name="name",
-            full_name="ListEntitiesBinarySensorResponse.name",
+            full_name="ListEntitiesSwitchResponse.name",
             index=2,
             number=3,
             type=9,
@@ -664,7 +3336,7 @@ _LISTENTITIESBINARYSENSORRESPONSE = _descriptor.Descriptor(
         ),
         _descriptor.FieldDescriptor(
             name="unique_id",
-            full_name="ListEntitiesBinarySensorResponse.unique_id",
+            full_name="ListEntitiesSwitchResponse.unique_id",
             index=3,
             number=4,
             type=9,
@@ -681,8 +3353,8 @@ _LISTENTITIESBINARYSENSORRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="device_class",
-            full_name="ListEntitiesBinarySensorResponse.device_class",
+            name="icon",
+            full_name="ListEntitiesSwitchResponse.icon",
             index=4,
             number=5,
             type=9,
@@ -699,8 +3371,8 @@ _LISTENTITIESBINARYSENSORRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="is_status_binary_sensor",
-            full_name="ListEntitiesBinarySensorResponse.is_status_binary_sensor",
+            name="assumed_state",
+            full_name="ListEntitiesSwitchResponse.assumed_state",
             index=5,
             number=6,
             type=8,
@@ -725,41 +3397,23 @@ _LISTENTITIESBINARYSENSORRESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=518,
-    serialized_end=672,
+    serialized_start=3095,
+    serialized_end=3225,
 )
 
 
-_LISTENTITIESCOVERRESPONSE = _descriptor.Descriptor(
-    name="ListEntitiesCoverResponse",
-    full_name="ListEntitiesCoverResponse",
+_SWITCHSTATERESPONSE = _descriptor.Descriptor(
+    name="SwitchStateResponse",
+    full_name="SwitchStateResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
-        _descriptor.FieldDescriptor(
-            name="object_id",
-            full_name="ListEntitiesCoverResponse.object_id",
-            index=0,
-            number=1,
-            type=9,
-            cpp_type=9,
-            label=1,
-            has_default_value=False,
-            default_value=_b("").decode("utf-8"),
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
-            serialized_options=None,
-            file=DESCRIPTOR,
-        ),
-        _descriptor.FieldDescriptor(
-            name="key",
-            full_name="ListEntitiesCoverResponse.key",
-            index=1,
-            number=2,
+        _descriptor.FieldDescriptor(
+            name="key",
+            full_name="SwitchStateResponse.key",
+            index=0,
+            number=1,
             type=7,
             cpp_type=3,
             label=1,
@@ -774,15 +3428,15 @@ _LISTENTITIESCOVERRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="name",
-            full_name="ListEntitiesCoverResponse.name",
-            index=2,
-            number=3,
-            type=9,
-            cpp_type=9,
+            name="state",
+            full_name="SwitchStateResponse.state",
+            index=1,
+            number=2,
+            type=8,
+            cpp_type=7,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=False,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -791,16 +3445,37 @@ _LISTENTITIESCOVERRESPONSE = _descriptor.Descriptor(
             serialized_options=None,
             file=DESCRIPTOR,
         ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=3227,
+    serialized_end=3276,
+)
+
+
+_SWITCHCOMMANDREQUEST = _descriptor.Descriptor(
+    name="SwitchCommandRequest",
+    full_name="SwitchCommandRequest",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
         _descriptor.FieldDescriptor(
-            name="unique_id",
-            full_name="ListEntitiesCoverResponse.unique_id",
-            index=3,
-            number=4,
-            type=9,
-            cpp_type=9,
+            name="key",
+            full_name="SwitchCommandRequest.key",
+            index=0,
+            number=1,
+            type=7,
+            cpp_type=3,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -810,10 +3485,10 @@ _LISTENTITIESCOVERRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="is_optimistic",
-            full_name="ListEntitiesCoverResponse.is_optimistic",
-            index=4,
-            number=5,
+            name="state",
+            full_name="SwitchCommandRequest.state",
+            index=1,
+            number=2,
             type=8,
             cpp_type=7,
             label=1,
@@ -836,21 +3511,21 @@ _LISTENTITIESCOVERRESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=674,
-    serialized_end=789,
+    serialized_start=3278,
+    serialized_end=3328,
 )
 
 
-_LISTENTITIESFANRESPONSE = _descriptor.Descriptor(
-    name="ListEntitiesFanResponse",
-    full_name="ListEntitiesFanResponse",
+_LISTENTITIESTEXTSENSORRESPONSE = _descriptor.Descriptor(
+    name="ListEntitiesTextSensorResponse",
+    full_name="ListEntitiesTextSensorResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
             name="object_id",
-            full_name="ListEntitiesFanResponse.object_id",
+            full_name="ListEntitiesTextSensorResponse.object_id",
             index=0,
             number=1,
             type=9,
@@ -868,7 +3543,7 @@ _LISTENTITIESFANRESPONSE = _descriptor.Descriptor(
         ),
         _descriptor.FieldDescriptor(
             name="key",
-            full_name="ListEntitiesFanResponse.key",
+            full_name="ListEntitiesTextSensorResponse.key",
             index=1,
             number=2,
             type=7,
@@ -886,7 +3561,7 @@ _LISTENTITIESFANRESPONSE = _descriptor.Descriptor(
         ),
         _descriptor.FieldDescriptor(
             name="name",
-            full_name="ListEntitiesFanResponse.name",
+            full_name="ListEntitiesTextSensorResponse.name",
             index=2,
             number=3,
             type=9,
@@ -904,7 +3579,7 @@ _LISTENTITIESFANRESPONSE = _descriptor.Descriptor(
         ),
         _descriptor.FieldDescriptor(
             name="unique_id",
-            full_name="ListEntitiesFanResponse.unique_id",
+            full_name="ListEntitiesTextSensorResponse.unique_id",
             index=3,
             number=4,
             type=9,
@@ -921,33 +3596,15 @@ _LISTENTITIESFANRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="supports_oscillation",
-            full_name="ListEntitiesFanResponse.supports_oscillation",
+            name="icon",
+            full_name="ListEntitiesTextSensorResponse.icon",
             index=4,
             number=5,
-            type=8,
-            cpp_type=7,
-            label=1,
-            has_default_value=False,
-            default_value=False,
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
-            serialized_options=None,
-            file=DESCRIPTOR,
-        ),
-        _descriptor.FieldDescriptor(
-            name="supports_speed",
-            full_name="ListEntitiesFanResponse.supports_speed",
-            index=5,
-            number=6,
-            type=8,
-            cpp_type=7,
+            type=9,
+            cpp_type=9,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=_b("").decode("utf-8"),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -965,41 +3622,23 @@ _LISTENTITIESFANRESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=792,
-    serialized_end=936,
+    serialized_start=3330,
+    serialized_end=3441,
 )
 
 
-_LISTENTITIESLIGHTRESPONSE = _descriptor.Descriptor(
-    name="ListEntitiesLightResponse",
-    full_name="ListEntitiesLightResponse",
+_TEXTSENSORSTATERESPONSE = _descriptor.Descriptor(
+    name="TextSensorStateResponse",
+    full_name="TextSensorStateResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
-            name="object_id",
-            full_name="ListEntitiesLightResponse.object_id",
+            name="key",
+            full_name="TextSensorStateResponse.key",
             index=0,
             number=1,
-            type=9,
-            cpp_type=9,
-            label=1,
-            has_default_value=False,
-            default_value=_b("").decode("utf-8"),
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
-            serialized_options=None,
-            file=DESCRIPTOR,
-        ),
-        _descriptor.FieldDescriptor(
-            name="key",
-            full_name="ListEntitiesLightResponse.key",
-            index=1,
-            number=2,
             type=7,
             cpp_type=3,
             label=1,
@@ -1014,10 +3653,10 @@ _LISTENTITIESLIGHTRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="name",
-            full_name="ListEntitiesLightResponse.name",
-            index=2,
-            number=3,
+            name="state",
+            full_name="TextSensorStateResponse.state",
+            index=1,
+            number=2,
             type=9,
             cpp_type=9,
             label=1,
@@ -1032,15 +3671,15 @@ _LISTENTITIESLIGHTRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="unique_id",
-            full_name="ListEntitiesLightResponse.unique_id",
-            index=3,
-            number=4,
-            type=9,
-            cpp_type=9,
+            name="missing_state",
+            full_name="TextSensorStateResponse.missing_state",
+            index=2,
+            number=3,
+            type=8,
+            cpp_type=7,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=False,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1049,16 +3688,37 @@ _LISTENTITIESLIGHTRESPONSE = _descriptor.Descriptor(
             serialized_options=None,
             file=DESCRIPTOR,
         ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=3443,
+    serialized_end=3519,
+)
+
+
+_SUBSCRIBELOGSREQUEST = _descriptor.Descriptor(
+    name="SubscribeLogsRequest",
+    full_name="SubscribeLogsRequest",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
         _descriptor.FieldDescriptor(
-            name="supports_brightness",
-            full_name="ListEntitiesLightResponse.supports_brightness",
-            index=4,
-            number=5,
-            type=8,
-            cpp_type=7,
+            name="level",
+            full_name="SubscribeLogsRequest.level",
+            index=0,
+            number=1,
+            type=14,
+            cpp_type=8,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1068,10 +3728,10 @@ _LISTENTITIESLIGHTRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="supports_rgb",
-            full_name="ListEntitiesLightResponse.supports_rgb",
-            index=5,
-            number=6,
+            name="dump_config",
+            full_name="SubscribeLogsRequest.dump_config",
+            index=1,
+            number=2,
             type=8,
             cpp_type=7,
             label=1,
@@ -1086,10 +3746,10 @@ _LISTENTITIESLIGHTRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="supports_white_value",
-            full_name="ListEntitiesLightResponse.supports_white_value",
-            index=6,
-            number=7,
+            name="binary",
+            full_name="SubscribeLogsRequest.binary",
+            index=2,
+            number=3,
             type=8,
             cpp_type=7,
             label=1,
@@ -1103,16 +3763,37 @@ _LISTENTITIESLIGHTRESPONSE = _descriptor.Descriptor(
             serialized_options=None,
             file=DESCRIPTOR,
         ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=3521,
+    serialized_end=3606,
+)
+
+
+_SUBSCRIBELOGSRESPONSE = _descriptor.Descriptor(
+    name="SubscribeLogsResponse",
+    full_name="SubscribeLogsResponse",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
         _descriptor.FieldDescriptor(
-            name="supports_color_temperature",
-            full_name="ListEntitiesLightResponse.supports_color_temperature",
-            index=7,
-            number=8,
-            type=8,
-            cpp_type=7,
+            name="level",
+            full_name="SubscribeLogsResponse.level",
+            index=0,
+            number=1,
+            type=14,
+            cpp_type=8,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1122,15 +3803,15 @@ _LISTENTITIESLIGHTRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="min_mireds",
-            full_name="ListEntitiesLightResponse.min_mireds",
-            index=8,
-            number=9,
-            type=2,
-            cpp_type=6,
+            name="tag",
+            full_name="SubscribeLogsResponse.tag",
+            index=1,
+            number=2,
+            type=9,
+            cpp_type=9,
             label=1,
             has_default_value=False,
-            default_value=float(0),
+            default_value=_b("").decode("utf-8"),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1140,15 +3821,15 @@ _LISTENTITIESLIGHTRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="max_mireds",
-            full_name="ListEntitiesLightResponse.max_mireds",
-            index=9,
-            number=10,
-            type=2,
-            cpp_type=6,
+            name="message",
+            full_name="SubscribeLogsResponse.message",
+            index=2,
+            number=3,
+            type=9,
+            cpp_type=9,
             label=1,
             has_default_value=False,
-            default_value=float(0),
+            default_value=_b("").decode("utf-8"),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1158,15 +3839,15 @@ _LISTENTITIESLIGHTRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="effects",
-            full_name="ListEntitiesLightResponse.effects",
-            index=10,
-            number=11,
-            type=9,
-            cpp_type=9,
-            label=3,
+            name="send_failed",
+            full_name="SubscribeLogsResponse.send_failed",
+            index=3,
+            number=4,
+            type=8,
+            cpp_type=7,
+            label=1,
             has_default_value=False,
-            default_value=[],
+            default_value=False,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1184,28 +3865,28 @@ _LISTENTITIESLIGHTRESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=939,
-    serialized_end=1205,
+    serialized_start=3608,
+    serialized_end=3708,
 )
 
 
-_LISTENTITIESSENSORRESPONSE = _descriptor.Descriptor(
-    name="ListEntitiesSensorResponse",
-    full_name="ListEntitiesSensorResponse",
+_SUBSCRIBELOGSBINARYRESPONSE = _descriptor.Descriptor(
+    name="SubscribeLogsBinaryResponse",
+    full_name="SubscribeLogsBinaryResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
-            name="object_id",
-            full_name="ListEntitiesSensorResponse.object_id",
+            name="level",
+            full_name="SubscribeLogsBinaryResponse.level",
             index=0,
             number=1,
-            type=9,
-            cpp_type=9,
+            type=14,
+            cpp_type=8,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1215,28 +3896,10 @@ _LISTENTITIESSENSORRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="key",
-            full_name="ListEntitiesSensorResponse.key",
+            name="tag",
+            full_name="SubscribeLogsBinaryResponse.tag",
             index=1,
             number=2,
-            type=7,
-            cpp_type=3,
-            label=1,
-            has_default_value=False,
-            default_value=0,
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
-            serialized_options=None,
-            file=DESCRIPTOR,
-        ),
-        _descriptor.FieldDescriptor(
-            name="name",
-            full_name="ListEntitiesSensorResponse.name",
-            index=2,
-            number=3,
             type=9,
             cpp_type=9,
             label=1,
@@ -1251,15 +3914,15 @@ _LISTENTITIESSENSORRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="unique_id",
-            full_name="ListEntitiesSensorResponse.unique_id",
-            index=3,
-            number=4,
-            type=9,
+            name="data",
+            full_name="SubscribeLogsBinaryResponse.data",
+            index=2,
+            number=3,
+            type=12,
             cpp_type=9,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=_b(""),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1268,11 +3931,52 @@ _LISTENTITIESSENSORRESPONSE = _descriptor.Descriptor(
             serialized_options=None,
             file=DESCRIPTOR,
         ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=3710,
+    serialized_end=3792,
+)
+
+
+_SUBSCRIBEHOMEASSISTANTSERVICESREQUEST = _descriptor.Descriptor(
+    name="SubscribeHomeassistantServicesRequest",
+    full_name="SubscribeHomeassistantServicesRequest",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=3794,
+    serialized_end=3833,
+)
+
+
+_HOMEASSISTANTSERVICEMAP = _descriptor.Descriptor(
+    name="HomeassistantServiceMap",
+    full_name="HomeassistantServiceMap",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
         _descriptor.FieldDescriptor(
-            name="icon",
-            full_name="ListEntitiesSensorResponse.icon",
-            index=4,
-            number=5,
+            name="key",
+            full_name="HomeassistantServiceMap.key",
+            index=0,
+            number=1,
             type=9,
             cpp_type=9,
             label=1,
@@ -1287,10 +3991,10 @@ _LISTENTITIESSENSORRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="unit_of_measurement",
-            full_name="ListEntitiesSensorResponse.unit_of_measurement",
-            index=5,
-            number=6,
+            name="value",
+            full_name="HomeassistantServiceMap.value",
+            index=1,
+            number=2,
             type=9,
             cpp_type=9,
             label=1,
@@ -1304,24 +4008,6 @@ _LISTENTITIESSENSORRESPONSE = _descriptor.Descriptor(
             serialized_options=None,
             file=DESCRIPTOR,
         ),
-        _descriptor.FieldDescriptor(
-            name="accuracy_decimals",
-            full_name="ListEntitiesSensorResponse.accuracy_decimals",
-            index=6,
-            number=7,
-            type=5,
-            cpp_type=1,
-            label=1,
-            has_default_value=False,
-            default_value=0,
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
-            serialized_options=None,
-            file=DESCRIPTOR,
-        ),
     ],
     extensions=[],
     nested_types=[],
@@ -1331,21 +4017,21 @@ _LISTENTITIESSENSORRESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=1208,
-    serialized_end=1371,
+    serialized_start=3835,
+    serialized_end=3888,
 )
 
 
-_LISTENTITIESSWITCHRESPONSE = _descriptor.Descriptor(
-    name="ListEntitiesSwitchResponse",
-    full_name="ListEntitiesSwitchResponse",
+_HOMEASSISTANTSERVICERESPONSE = _descriptor.Descriptor(
+    name="HomeassistantServiceResponse",
+    full_name="HomeassistantServiceResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
-            name="object_id",
-            full_name="ListEntitiesSwitchResponse.object_id",
+            name="service",
+            full_name="HomeassistantServiceResponse.service",
             index=0,
             number=1,
             type=9,
@@ -1362,15 +4048,15 @@ _LISTENTITIESSWITCHRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="key",
-            full_name="ListEntitiesSwitchResponse.key",
+            name="data",
+            full_name="HomeassistantServiceResponse.data",
             index=1,
             number=2,
-            type=7,
-            cpp_type=3,
-            label=1,
+            type=11,
+            cpp_type=10,
+            label=3,
             has_default_value=False,
-            default_value=0,
+            default_value=[],
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1380,15 +4066,15 @@ _LISTENTITIESSWITCHRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="name",
-            full_name="ListEntitiesSwitchResponse.name",
+            name="data_template",
+            full_name="HomeassistantServiceResponse.data_template",
             index=2,
             number=3,
-            type=9,
-            cpp_type=9,
-            label=1,
+            type=11,
+            cpp_type=10,
+            label=3,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=[],
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1398,15 +4084,15 @@ _LISTENTITIESSWITCHRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="unique_id",
-            full_name="ListEntitiesSwitchResponse.unique_id",
+            name="variables",
+            full_name="HomeassistantServiceResponse.variables",
             index=3,
             number=4,
-            type=9,
-            cpp_type=9,
-            label=1,
+            type=11,
+            cpp_type=10,
+            label=3,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=[],
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1416,28 +4102,10 @@ _LISTENTITIESSWITCHRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="icon",
-            full_name="ListEntitiesSwitchResponse.icon",
+            name="is_event",
+            full_name="HomeassistantServiceResponse.is_event",
             index=4,
             number=5,
-            type=9,
-            cpp_type=9,
-            label=1,
-            has_default_value=False,
-            default_value=_b("").decode("utf-8"),
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
-            serialized_options=None,
-            file=DESCRIPTOR,
-        ),
-        _descriptor.FieldDescriptor(
-            name="optimistic",
-            full_name="ListEntitiesSwitchResponse.optimistic",
-            index=5,
-            number=6,
             type=8,
             cpp_type=7,
             label=1,
@@ -1460,21 +4128,41 @@ _LISTENTITIESSWITCHRESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=1373,
-    serialized_end=1500,
+    serialized_start=3891,
+    serialized_end=4090,
 )
 
 
-_LISTENTITIESTEXTSENSORRESPONSE = _descriptor.Descriptor(
-    name="ListEntitiesTextSensorResponse",
-    full_name="ListEntitiesTextSensorResponse",
+_SUBSCRIBEHOMEASSISTANTSTATESREQUEST = _descriptor.Descriptor(
+    name="SubscribeHomeAssistantStatesRequest",
+    full_name="SubscribeHomeAssistantStatesRequest",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=4092,
+    serialized_end=4129,
+)
+
+
+_SUBSCRIBEHOMEASSISTANTSTATERESPONSE = _descriptor.Descriptor(
+    name="SubscribeHomeAssistantStateResponse",
+    full_name="SubscribeHomeAssistantStateResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
-            name="object_id",
-            full_name="ListEntitiesTextSensorResponse.object_id",
+            name="entity_id",
+            full_name="SubscribeHomeAssistantStateResponse.entity_id",
             index=0,
             number=1,
             type=9,
@@ -1490,47 +4178,32 @@ _LISTENTITIESTEXTSENSORRESPONSE = _descriptor.Descriptor(
             serialized_options=None,
             file=DESCRIPTOR,
         ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=4131,
+    serialized_end=4187,
+)
+
+
+_HOMEASSISTANTSTATERESPONSE = _descriptor.Descriptor(
+    name="HomeAssistantStateResponse",
+    full_name="HomeAssistantStateResponse",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
         _descriptor.FieldDescriptor(
-            name="key",
-            full_name="ListEntitiesTextSensorResponse.key",
-            index=1,
-            number=2,
-            type=7,
-            cpp_type=3,
-            label=1,
-            has_default_value=False,
-            default_value=0,
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
-            serialized_options=None,
-            file=DESCRIPTOR,
-        ),
-        _descriptor.FieldDescriptor(
-            name="name",
-            full_name="ListEntitiesTextSensorResponse.name",
-            index=2,
-            number=3,
-            type=9,
-            cpp_type=9,
-            label=1,
-            has_default_value=False,
-            default_value=_b("").decode("utf-8"),
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
-            serialized_options=None,
-            file=DESCRIPTOR,
-        ),
-        _descriptor.FieldDescriptor(
-            name="unique_id",
-            full_name="ListEntitiesTextSensorResponse.unique_id",
-            index=3,
-            number=4,
+            name="entity_id",
+            full_name="HomeAssistantStateResponse.entity_id",
+            index=0,
+            number=1,
             type=9,
             cpp_type=9,
             label=1,
@@ -1545,10 +4218,10 @@ _LISTENTITIESTEXTSENSORRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="icon",
-            full_name="ListEntitiesTextSensorResponse.icon",
-            index=4,
-            number=5,
+            name="state",
+            full_name="HomeAssistantStateResponse.state",
+            index=1,
+            number=2,
             type=9,
             cpp_type=9,
             label=1,
@@ -1571,34 +4244,14 @@ _LISTENTITIESTEXTSENSORRESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=1502,
-    serialized_end=1613,
-)
-
-
-_LISTENTITIESDONERESPONSE = _descriptor.Descriptor(
-    name="ListEntitiesDoneResponse",
-    full_name="ListEntitiesDoneResponse",
-    filename=None,
-    file=DESCRIPTOR,
-    containing_type=None,
-    fields=[],
-    extensions=[],
-    nested_types=[],
-    enum_types=[],
-    serialized_options=None,
-    is_extendable=False,
-    syntax="proto3",
-    extension_ranges=[],
-    oneofs=[],
-    serialized_start=1615,
-    serialized_end=1641,
+    serialized_start=4189,
+    serialized_end=4251,
 )
 
 
-_SUBSCRIBESTATESREQUEST = _descriptor.Descriptor(
-    name="SubscribeStatesRequest",
-    full_name="SubscribeStatesRequest",
+_GETTIMEREQUEST = _descriptor.Descriptor(
+    name="GetTimeRequest",
+    full_name="GetTimeRequest",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
@@ -1611,21 +4264,21 @@ _SUBSCRIBESTATESREQUEST = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=1643,
-    serialized_end=1667,
+    serialized_start=4253,
+    serialized_end=4269,
 )
 
 
-_BINARYSENSORSTATERESPONSE = _descriptor.Descriptor(
-    name="BinarySensorStateResponse",
-    full_name="BinarySensorStateResponse",
+_GETTIMERESPONSE = _descriptor.Descriptor(
+    name="GetTimeResponse",
+    full_name="GetTimeResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
-            name="key",
-            full_name="BinarySensorStateResponse.key",
+            name="epoch_seconds",
+            full_name="GetTimeResponse.epoch_seconds",
             index=0,
             number=1,
             type=7,
@@ -1641,24 +4294,6 @@ _BINARYSENSORSTATERESPONSE = _descriptor.Descriptor(
             serialized_options=None,
             file=DESCRIPTOR,
         ),
-        _descriptor.FieldDescriptor(
-            name="state",
-            full_name="BinarySensorStateResponse.state",
-            index=1,
-            number=2,
-            type=8,
-            cpp_type=7,
-            label=1,
-            has_default_value=False,
-            default_value=False,
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
-            serialized_options=None,
-            file=DESCRIPTOR,
-        ),
     ],
     extensions=[],
     nested_types=[],
@@ -1668,28 +4303,28 @@ _BINARYSENSORSTATERESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=1669,
-    serialized_end=1724,
+    serialized_start=4271,
+    serialized_end=4311,
 )
 
 
-_COVERSTATERESPONSE = _descriptor.Descriptor(
-    name="CoverStateResponse",
-    full_name="CoverStateResponse",
+_LISTENTITIESSERVICESARGUMENT = _descriptor.Descriptor(
+    name="ListEntitiesServicesArgument",
+    full_name="ListEntitiesServicesArgument",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
-            name="key",
-            full_name="CoverStateResponse.key",
+            name="name",
+            full_name="ListEntitiesServicesArgument.name",
             index=0,
             number=1,
-            type=7,
-            cpp_type=3,
+            type=9,
+            cpp_type=9,
             label=1,
             has_default_value=False,
-            default_value=0,
+            default_value=_b("").decode("utf-8"),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1699,8 +4334,8 @@ _COVERSTATERESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="state",
-            full_name="CoverStateResponse.state",
+            name="type",
+            full_name="ListEntitiesServicesArgument.type",
             index=1,
             number=2,
             type=14,
@@ -1719,36 +4354,34 @@ _COVERSTATERESPONSE = _descriptor.Descriptor(
     ],
     extensions=[],
     nested_types=[],
-    enum_types=[
-        _COVERSTATERESPONSE_COVERSTATE,
-    ],
+    enum_types=[],
     serialized_options=None,
     is_extendable=False,
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=1726,
-    serialized_end=1842,
+    serialized_start=4313,
+    serialized_end=4388,
 )
 
 
-_FANSTATERESPONSE = _descriptor.Descriptor(
-    name="FanStateResponse",
-    full_name="FanStateResponse",
+_LISTENTITIESSERVICESRESPONSE = _descriptor.Descriptor(
+    name="ListEntitiesServicesResponse",
+    full_name="ListEntitiesServicesResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
-            name="key",
-            full_name="FanStateResponse.key",
+            name="name",
+            full_name="ListEntitiesServicesResponse.name",
             index=0,
             number=1,
-            type=7,
-            cpp_type=3,
+            type=9,
+            cpp_type=9,
             label=1,
             has_default_value=False,
-            default_value=0,
+            default_value=_b("").decode("utf-8"),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1758,15 +4391,15 @@ _FANSTATERESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="state",
-            full_name="FanStateResponse.state",
+            name="key",
+            full_name="ListEntitiesServicesResponse.key",
             index=1,
             number=2,
-            type=8,
-            cpp_type=7,
+            type=7,
+            cpp_type=3,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1776,33 +4409,15 @@ _FANSTATERESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="oscillating",
-            full_name="FanStateResponse.oscillating",
+            name="args",
+            full_name="ListEntitiesServicesResponse.args",
             index=2,
             number=3,
-            type=8,
-            cpp_type=7,
-            label=1,
-            has_default_value=False,
-            default_value=False,
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
-            serialized_options=None,
-            file=DESCRIPTOR,
-        ),
-        _descriptor.FieldDescriptor(
-            name="speed",
-            full_name="FanStateResponse.speed",
-            index=3,
-            number=4,
-            type=14,
-            cpp_type=8,
-            label=1,
+            type=11,
+            cpp_type=10,
+            label=3,
             has_default_value=False,
-            default_value=0,
+            default_value=[],
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1820,28 +4435,28 @@ _FANSTATERESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=1844,
-    serialized_end=1937,
+    serialized_start=4390,
+    serialized_end=4492,
 )
 
 
-_LIGHTSTATERESPONSE = _descriptor.Descriptor(
-    name="LightStateResponse",
-    full_name="LightStateResponse",
+_EXECUTESERVICEARGUMENT = _descriptor.Descriptor(
+    name="ExecuteServiceArgument",
+    full_name="ExecuteServiceArgument",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
-            name="key",
-            full_name="LightStateResponse.key",
+            name="bool_",
+            full_name="ExecuteServiceArgument.bool_",
             index=0,
             number=1,
-            type=7,
-            cpp_type=3,
+            type=8,
+            cpp_type=7,
             label=1,
             has_default_value=False,
-            default_value=0,
+            default_value=False,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1851,15 +4466,15 @@ _LIGHTSTATERESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="state",
-            full_name="LightStateResponse.state",
+            name="legacy_int",
+            full_name="ExecuteServiceArgument.legacy_int",
             index=1,
             number=2,
-            type=8,
-            cpp_type=7,
+            type=5,
+            cpp_type=1,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1869,8 +4484,8 @@ _LIGHTSTATERESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="brightness",
-            full_name="LightStateResponse.brightness",
+            name="float_",
+            full_name="ExecuteServiceArgument.float_",
             index=2,
             number=3,
             type=2,
@@ -1887,15 +4502,15 @@ _LIGHTSTATERESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="red",
-            full_name="LightStateResponse.red",
+            name="string_",
+            full_name="ExecuteServiceArgument.string_",
             index=3,
             number=4,
-            type=2,
-            cpp_type=6,
+            type=9,
+            cpp_type=9,
             label=1,
             has_default_value=False,
-            default_value=float(0),
+            default_value=_b("").decode("utf-8"),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1905,15 +4520,15 @@ _LIGHTSTATERESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="green",
-            full_name="LightStateResponse.green",
+            name="int_",
+            full_name="ExecuteServiceArgument.int_",
             index=4,
             number=5,
-            type=2,
-            cpp_type=6,
+            type=17,
+            cpp_type=1,
             label=1,
             has_default_value=False,
-            default_value=float(0),
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1923,15 +4538,15 @@ _LIGHTSTATERESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="blue",
-            full_name="LightStateResponse.blue",
+            name="bool_array",
+            full_name="ExecuteServiceArgument.bool_array",
             index=5,
             number=6,
-            type=2,
-            cpp_type=6,
-            label=1,
+            type=8,
+            cpp_type=7,
+            label=3,
             has_default_value=False,
-            default_value=float(0),
+            default_value=[],
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1941,15 +4556,15 @@ _LIGHTSTATERESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="white",
-            full_name="LightStateResponse.white",
+            name="int_array",
+            full_name="ExecuteServiceArgument.int_array",
             index=6,
             number=7,
-            type=2,
-            cpp_type=6,
-            label=1,
+            type=17,
+            cpp_type=1,
+            label=3,
             has_default_value=False,
-            default_value=float(0),
+            default_value=[],
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1959,15 +4574,15 @@ _LIGHTSTATERESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="color_temperature",
-            full_name="LightStateResponse.color_temperature",
+            name="float_array",
+            full_name="ExecuteServiceArgument.float_array",
             index=7,
             number=8,
             type=2,
             cpp_type=6,
-            label=1,
+            label=3,
             has_default_value=False,
-            default_value=float(0),
+            default_value=[],
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -1977,15 +4592,15 @@ _LIGHTSTATERESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="effect",
-            full_name="LightStateResponse.effect",
+            name="string_array",
+            full_name="ExecuteServiceArgument.string_array",
             index=8,
             number=9,
             type=9,
             cpp_type=9,
-            label=1,
+            label=3,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=[],
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2003,21 +4618,21 @@ _LIGHTSTATERESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=1940,
-    serialized_end=2108,
+    serialized_start=4495,
+    serialized_end=4683,
 )
 
 
-_SENSORSTATERESPONSE = _descriptor.Descriptor(
-    name="SensorStateResponse",
-    full_name="SensorStateResponse",
+_EXECUTESERVICEREQUEST = _descriptor.Descriptor(
+    name="ExecuteServiceRequest",
+    full_name="ExecuteServiceRequest",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
             name="key",
-            full_name="SensorStateResponse.key",
+            full_name="ExecuteServiceRequest.key",
             index=0,
             number=1,
             type=7,
@@ -2034,15 +4649,15 @@ _SENSORSTATERESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="state",
-            full_name="SensorStateResponse.state",
+            name="args",
+            full_name="ExecuteServiceRequest.args",
             index=1,
             number=2,
-            type=2,
-            cpp_type=6,
-            label=1,
+            type=11,
+            cpp_type=10,
+            label=3,
             has_default_value=False,
-            default_value=float(0),
+            default_value=[],
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2060,28 +4675,64 @@ _SENSORSTATERESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=2110,
-    serialized_end=2159,
+    serialized_start=4685,
+    serialized_end=4760,
 )
 
 
-_SWITCHSTATERESPONSE = _descriptor.Descriptor(
-    name="SwitchStateResponse",
-    full_name="SwitchStateResponse",
+_LISTENTITIESCAMERARESPONSE = _descriptor.Descriptor(
+    name="ListEntitiesCameraResponse",
+    full_name="ListEntitiesCameraResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
-            name="key",
-            full_name="SwitchStateResponse.key",
+            name="object_id",
+            full_name="ListEntitiesCameraResponse.object_id",
             index=0,
             number=1,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="key",
+            full_name="ListEntitiesCameraResponse.key",
+            index=1,
+            number=2,
             type=7,
             cpp_type=3,
             label=1,
             has_default_value=False,
-            default_value=0,
+            default_value=0,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="name",
+            full_name="ListEntitiesCameraResponse.name",
+            index=2,
+            number=3,
+            type=9,
+            cpp_type=9,
+            label=1,
+            has_default_value=False,
+            default_value=_b("").decode("utf-8"),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2091,15 +4742,15 @@ _SWITCHSTATERESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="state",
-            full_name="SwitchStateResponse.state",
-            index=1,
-            number=2,
-            type=8,
-            cpp_type=7,
+            name="unique_id",
+            full_name="ListEntitiesCameraResponse.unique_id",
+            index=3,
+            number=4,
+            type=9,
+            cpp_type=9,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=_b("").decode("utf-8"),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2117,21 +4768,21 @@ _SWITCHSTATERESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=2161,
-    serialized_end=2210,
+    serialized_start=4762,
+    serialized_end=4855,
 )
 
 
-_TEXTSENSORSTATERESPONSE = _descriptor.Descriptor(
-    name="TextSensorStateResponse",
-    full_name="TextSensorStateResponse",
+_CAMERAIMAGERESPONSE = _descriptor.Descriptor(
+    name="CameraImageResponse",
+    full_name="CameraImageResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
             name="key",
-            full_name="TextSensorStateResponse.key",
+            full_name="CameraImageResponse.key",
             index=0,
             number=1,
             type=7,
@@ -2148,15 +4799,33 @@ _TEXTSENSORSTATERESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="state",
-            full_name="TextSensorStateResponse.state",
+            name="data",
+            full_name="CameraImageResponse.data",
             index=1,
             number=2,
-            type=9,
+            type=12,
             cpp_type=9,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=_b(""),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="done",
+            full_name="CameraImageResponse.done",
+            index=2,
+            number=3,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2174,28 +4843,28 @@ _TEXTSENSORSTATERESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=2212,
-    serialized_end=2265,
+    serialized_start=4857,
+    serialized_end=4919,
 )
 
 
-_COVERCOMMANDREQUEST = _descriptor.Descriptor(
-    name="CoverCommandRequest",
-    full_name="CoverCommandRequest",
+_CAMERAIMAGEREQUEST = _descriptor.Descriptor(
+    name="CameraImageRequest",
+    full_name="CameraImageRequest",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
-            name="key",
-            full_name="CoverCommandRequest.key",
+            name="single",
+            full_name="CameraImageRequest.single",
             index=0,
             number=1,
-            type=7,
-            cpp_type=3,
+            type=8,
+            cpp_type=7,
             label=1,
             has_default_value=False,
-            default_value=0,
+            default_value=False,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2205,8 +4874,8 @@ _COVERCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="has_state",
-            full_name="CoverCommandRequest.has_state",
+            name="stream",
+            full_name="CameraImageRequest.stream",
             index=1,
             number=2,
             type=8,
@@ -2222,57 +4891,37 @@ _COVERCOMMANDREQUEST = _descriptor.Descriptor(
             serialized_options=None,
             file=DESCRIPTOR,
         ),
-        _descriptor.FieldDescriptor(
-            name="command",
-            full_name="CoverCommandRequest.command",
-            index=2,
-            number=3,
-            type=14,
-            cpp_type=8,
-            label=1,
-            has_default_value=False,
-            default_value=0,
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
-            serialized_options=None,
-            file=DESCRIPTOR,
-        ),
     ],
     extensions=[],
     nested_types=[],
-    enum_types=[
-        _COVERCOMMANDREQUEST_COVERCOMMAND,
-    ],
+    enum_types=[],
     serialized_options=None,
     is_extendable=False,
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=2268,
-    serialized_end=2420,
+    serialized_start=4921,
+    serialized_end=4973,
 )
 
 
-_FANCOMMANDREQUEST = _descriptor.Descriptor(
-    name="FanCommandRequest",
-    full_name="FanCommandRequest",
+_LISTENTITIESCLIMATERESPONSE = _descriptor.Descriptor(
+    name="ListEntitiesClimateResponse",
+    full_name="ListEntitiesClimateResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
-            name="key",
-            full_name="FanCommandRequest.key",
+            name="object_id",
+            full_name="ListEntitiesClimateResponse.object_id",
             index=0,
             number=1,
-            type=7,
-            cpp_type=3,
+            type=9,
+            cpp_type=9,
             label=1,
             has_default_value=False,
-            default_value=0,
+            default_value=_b("").decode("utf-8"),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2282,15 +4931,15 @@ _FANCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="has_state",
-            full_name="FanCommandRequest.has_state",
+            name="key",
+            full_name="ListEntitiesClimateResponse.key",
             index=1,
             number=2,
-            type=8,
-            cpp_type=7,
+            type=7,
+            cpp_type=3,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2300,15 +4949,15 @@ _FANCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="state",
-            full_name="FanCommandRequest.state",
+            name="name",
+            full_name="ListEntitiesClimateResponse.name",
             index=2,
             number=3,
-            type=8,
-            cpp_type=7,
+            type=9,
+            cpp_type=9,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=_b("").decode("utf-8"),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2318,15 +4967,15 @@ _FANCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="has_speed",
-            full_name="FanCommandRequest.has_speed",
+            name="unique_id",
+            full_name="ListEntitiesClimateResponse.unique_id",
             index=3,
             number=4,
-            type=8,
-            cpp_type=7,
+            type=9,
+            cpp_type=9,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=_b("").decode("utf-8"),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2336,15 +4985,15 @@ _FANCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="speed",
-            full_name="FanCommandRequest.speed",
+            name="supports_current_temperature",
+            full_name="ListEntitiesClimateResponse.supports_current_temperature",
             index=4,
             number=5,
-            type=14,
-            cpp_type=8,
+            type=8,
+            cpp_type=7,
             label=1,
             has_default_value=False,
-            default_value=0,
+            default_value=False,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2354,8 +5003,8 @@ _FANCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="has_oscillating",
-            full_name="FanCommandRequest.has_oscillating",
+            name="supports_two_point_target_temperature",
+            full_name="ListEntitiesClimateResponse.supports_two_point_target_temperature",
             index=5,
             number=6,
             type=8,
@@ -2372,72 +5021,15 @@ _FANCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="oscillating",
-            full_name="FanCommandRequest.oscillating",
+            name="supported_modes",
+            full_name="ListEntitiesClimateResponse.supported_modes",
             index=6,
             number=7,
-            type=8,
-            cpp_type=7,
-            label=1,
-            has_default_value=False,
-            default_value=False,
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
-            serialized_options=None,
-            file=DESCRIPTOR,
-        ),
-    ],
-    extensions=[],
-    nested_types=[],
-    enum_types=[],
-    serialized_options=None,
-    is_extendable=False,
-    syntax="proto3",
-    extension_ranges=[],
-    oneofs=[],
-    serialized_start=2423,
-    serialized_end=2580,
-)
-
-
-_LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
-    name="LightCommandRequest",
-    full_name="LightCommandRequest",
-    filename=None,
-    file=DESCRIPTOR,
-    containing_type=None,
-    fields=[
-        _descriptor.FieldDescriptor(
-            name="key",
-            full_name="LightCommandRequest.key",
-            index=0,
-            number=1,
-            type=7,
-            cpp_type=3,
-            label=1,
-            has_default_value=False,
-            default_value=0,
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
-            serialized_options=None,
-            file=DESCRIPTOR,
-        ),
-        _descriptor.FieldDescriptor(
-            name="has_state",
-            full_name="LightCommandRequest.has_state",
-            index=1,
-            number=2,
-            type=8,
-            cpp_type=7,
-            label=1,
+            type=14,
+            cpp_type=8,
+            label=3,
             has_default_value=False,
-            default_value=False,
+            default_value=[],
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2447,15 +5039,15 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="state",
-            full_name="LightCommandRequest.state",
-            index=2,
-            number=3,
-            type=8,
-            cpp_type=7,
+            name="visual_min_temperature",
+            full_name="ListEntitiesClimateResponse.visual_min_temperature",
+            index=7,
+            number=8,
+            type=2,
+            cpp_type=6,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=float(0),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2465,15 +5057,15 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="has_brightness",
-            full_name="LightCommandRequest.has_brightness",
-            index=3,
-            number=4,
-            type=8,
-            cpp_type=7,
+            name="visual_max_temperature",
+            full_name="ListEntitiesClimateResponse.visual_max_temperature",
+            index=8,
+            number=9,
+            type=2,
+            cpp_type=6,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=float(0),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2483,10 +5075,10 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="brightness",
-            full_name="LightCommandRequest.brightness",
-            index=4,
-            number=5,
+            name="visual_temperature_step",
+            full_name="ListEntitiesClimateResponse.visual_temperature_step",
+            index=9,
+            number=10,
             type=2,
             cpp_type=6,
             label=1,
@@ -2501,10 +5093,10 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="has_rgb",
-            full_name="LightCommandRequest.has_rgb",
-            index=5,
-            number=6,
+            name="supports_away",
+            full_name="ListEntitiesClimateResponse.supports_away",
+            index=10,
+            number=11,
             type=8,
             cpp_type=7,
             label=1,
@@ -2519,15 +5111,15 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="red",
-            full_name="LightCommandRequest.red",
-            index=6,
-            number=7,
-            type=2,
-            cpp_type=6,
+            name="supports_action",
+            full_name="ListEntitiesClimateResponse.supports_action",
+            index=11,
+            number=12,
+            type=8,
+            cpp_type=7,
             label=1,
             has_default_value=False,
-            default_value=float(0),
+            default_value=False,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2537,15 +5129,15 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="green",
-            full_name="LightCommandRequest.green",
-            index=7,
-            number=8,
-            type=2,
-            cpp_type=6,
-            label=1,
+            name="supported_fan_modes",
+            full_name="ListEntitiesClimateResponse.supported_fan_modes",
+            index=12,
+            number=13,
+            type=14,
+            cpp_type=8,
+            label=3,
             has_default_value=False,
-            default_value=float(0),
+            default_value=[],
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2555,15 +5147,15 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="blue",
-            full_name="LightCommandRequest.blue",
-            index=8,
-            number=9,
-            type=2,
-            cpp_type=6,
-            label=1,
+            name="supported_swing_modes",
+            full_name="ListEntitiesClimateResponse.supported_swing_modes",
+            index=13,
+            number=14,
+            type=14,
+            cpp_type=8,
+            label=3,
             has_default_value=False,
-            default_value=float(0),
+            default_value=[],
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2572,16 +5164,37 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             serialized_options=None,
             file=DESCRIPTOR,
         ),
+    ],
+    extensions=[],
+    nested_types=[],
+    enum_types=[],
+    serialized_options=None,
+    is_extendable=False,
+    syntax="proto3",
+    extension_ranges=[],
+    oneofs=[],
+    serialized_start=4976,
+    serialized_end=5435,
+)
+
+
+_CLIMATESTATERESPONSE = _descriptor.Descriptor(
+    name="ClimateStateResponse",
+    full_name="ClimateStateResponse",
+    filename=None,
+    file=DESCRIPTOR,
+    containing_type=None,
+    fields=[
         _descriptor.FieldDescriptor(
-            name="has_white",
-            full_name="LightCommandRequest.has_white",
-            index=9,
-            number=10,
-            type=8,
-            cpp_type=7,
+            name="key",
+            full_name="ClimateStateResponse.key",
+            index=0,
+            number=1,
+            type=7,
+            cpp_type=3,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2591,15 +5204,15 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="white",
-            full_name="LightCommandRequest.white",
-            index=10,
-            number=11,
-            type=2,
-            cpp_type=6,
+            name="mode",
+            full_name="ClimateStateResponse.mode",
+            index=1,
+            number=2,
+            type=14,
+            cpp_type=8,
             label=1,
             has_default_value=False,
-            default_value=float(0),
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2609,15 +5222,15 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="has_color_temperature",
-            full_name="LightCommandRequest.has_color_temperature",
-            index=11,
-            number=12,
-            type=8,
-            cpp_type=7,
+            name="current_temperature",
+            full_name="ClimateStateResponse.current_temperature",
+            index=2,
+            number=3,
+            type=2,
+            cpp_type=6,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=float(0),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2627,10 +5240,10 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="color_temperature",
-            full_name="LightCommandRequest.color_temperature",
-            index=12,
-            number=13,
+            name="target_temperature",
+            full_name="ClimateStateResponse.target_temperature",
+            index=3,
+            number=4,
             type=2,
             cpp_type=6,
             label=1,
@@ -2645,15 +5258,15 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="has_transition_length",
-            full_name="LightCommandRequest.has_transition_length",
-            index=13,
-            number=14,
-            type=8,
-            cpp_type=7,
+            name="target_temperature_low",
+            full_name="ClimateStateResponse.target_temperature_low",
+            index=4,
+            number=5,
+            type=2,
+            cpp_type=6,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=float(0),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2663,15 +5276,15 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="transition_length",
-            full_name="LightCommandRequest.transition_length",
-            index=14,
-            number=15,
-            type=13,
-            cpp_type=3,
+            name="target_temperature_high",
+            full_name="ClimateStateResponse.target_temperature_high",
+            index=5,
+            number=6,
+            type=2,
+            cpp_type=6,
             label=1,
             has_default_value=False,
-            default_value=0,
+            default_value=float(0),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2681,10 +5294,10 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="has_flash_length",
-            full_name="LightCommandRequest.has_flash_length",
-            index=15,
-            number=16,
+            name="away",
+            full_name="ClimateStateResponse.away",
+            index=6,
+            number=7,
             type=8,
             cpp_type=7,
             label=1,
@@ -2699,12 +5312,12 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="flash_length",
-            full_name="LightCommandRequest.flash_length",
-            index=16,
-            number=17,
-            type=13,
-            cpp_type=3,
+            name="action",
+            full_name="ClimateStateResponse.action",
+            index=7,
+            number=8,
+            type=14,
+            cpp_type=8,
             label=1,
             has_default_value=False,
             default_value=0,
@@ -2717,15 +5330,15 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="has_effect",
-            full_name="LightCommandRequest.has_effect",
-            index=17,
-            number=18,
-            type=8,
-            cpp_type=7,
+            name="fan_mode",
+            full_name="ClimateStateResponse.fan_mode",
+            index=8,
+            number=9,
+            type=14,
+            cpp_type=8,
             label=1,
             has_default_value=False,
-            default_value=False,
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2735,15 +5348,15 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="effect",
-            full_name="LightCommandRequest.effect",
-            index=18,
-            number=19,
-            type=9,
-            cpp_type=9,
+            name="swing_mode",
+            full_name="ClimateStateResponse.swing_mode",
+            index=9,
+            number=10,
+            type=14,
+            cpp_type=8,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2761,21 +5374,21 @@ _LIGHTCOMMANDREQUEST = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=2583,
-    serialized_end=2988,
+    serialized_start=5438,
+    serialized_end=5743,
 )
 
 
-_SWITCHCOMMANDREQUEST = _descriptor.Descriptor(
-    name="SwitchCommandRequest",
-    full_name="SwitchCommandRequest",
+_CLIMATECOMMANDREQUEST = _descriptor.Descriptor(
+    name="ClimateCommandRequest",
+    full_name="ClimateCommandRequest",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
             name="key",
-            full_name="SwitchCommandRequest.key",
+            full_name="ClimateCommandRequest.key",
             index=0,
             number=1,
             type=7,
@@ -2792,8 +5405,8 @@ _SWITCHCOMMANDREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="state",
-            full_name="SwitchCommandRequest.state",
+            name="has_mode",
+            full_name="ClimateCommandRequest.has_mode",
             index=1,
             number=2,
             type=8,
@@ -2809,32 +5422,11 @@ _SWITCHCOMMANDREQUEST = _descriptor.Descriptor(
             serialized_options=None,
             file=DESCRIPTOR,
         ),
-    ],
-    extensions=[],
-    nested_types=[],
-    enum_types=[],
-    serialized_options=None,
-    is_extendable=False,
-    syntax="proto3",
-    extension_ranges=[],
-    oneofs=[],
-    serialized_start=2990,
-    serialized_end=3040,
-)
-
-
-_SUBSCRIBELOGSREQUEST = _descriptor.Descriptor(
-    name="SubscribeLogsRequest",
-    full_name="SubscribeLogsRequest",
-    filename=None,
-    file=DESCRIPTOR,
-    containing_type=None,
-    fields=[
         _descriptor.FieldDescriptor(
-            name="level",
-            full_name="SubscribeLogsRequest.level",
-            index=0,
-            number=1,
+            name="mode",
+            full_name="ClimateCommandRequest.mode",
+            index=2,
+            number=3,
             type=14,
             cpp_type=8,
             label=1,
@@ -2849,10 +5441,10 @@ _SUBSCRIBELOGSREQUEST = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="dump_config",
-            full_name="SubscribeLogsRequest.dump_config",
-            index=1,
-            number=2,
+            name="has_target_temperature",
+            full_name="ClimateCommandRequest.has_target_temperature",
+            index=3,
+            number=4,
             type=8,
             cpp_type=7,
             label=1,
@@ -2866,37 +5458,16 @@ _SUBSCRIBELOGSREQUEST = _descriptor.Descriptor(
             serialized_options=None,
             file=DESCRIPTOR,
         ),
-    ],
-    extensions=[],
-    nested_types=[],
-    enum_types=[],
-    serialized_options=None,
-    is_extendable=False,
-    syntax="proto3",
-    extension_ranges=[],
-    oneofs=[],
-    serialized_start=3042,
-    serialized_end=3111,
-)
-
-
-_SUBSCRIBELOGSRESPONSE = _descriptor.Descriptor(
-    name="SubscribeLogsResponse",
-    full_name="SubscribeLogsResponse",
-    filename=None,
-    file=DESCRIPTOR,
-    containing_type=None,
-    fields=[
         _descriptor.FieldDescriptor(
-            name="level",
-            full_name="SubscribeLogsResponse.level",
-            index=0,
-            number=1,
-            type=14,
-            cpp_type=8,
+            name="target_temperature",
+            full_name="ClimateCommandRequest.target_temperature",
+            index=4,
+            number=5,
+            type=2,
+            cpp_type=6,
             label=1,
             has_default_value=False,
-            default_value=0,
+            default_value=float(0),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2906,15 +5477,69 @@ _SUBSCRIBELOGSRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="tag",
-            full_name="SubscribeLogsResponse.tag",
-            index=1,
-            number=2,
-            type=9,
-            cpp_type=9,
+            name="has_target_temperature_low",
+            full_name="ClimateCommandRequest.has_target_temperature_low",
+            index=5,
+            number=6,
+            type=8,
+            cpp_type=7,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="target_temperature_low",
+            full_name="ClimateCommandRequest.target_temperature_low",
+            index=6,
+            number=7,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="has_target_temperature_high",
+            full_name="ClimateCommandRequest.has_target_temperature_high",
+            index=7,
+            number=8,
+            type=8,
+            cpp_type=7,
+            label=1,
+            has_default_value=False,
+            default_value=False,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="target_temperature_high",
+            full_name="ClimateCommandRequest.target_temperature_high",
+            index=8,
+            number=9,
+            type=2,
+            cpp_type=6,
+            label=1,
+            has_default_value=False,
+            default_value=float(0),
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2924,15 +5549,15 @@ _SUBSCRIBELOGSRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="message",
-            full_name="SubscribeLogsResponse.message",
-            index=2,
-            number=3,
-            type=9,
-            cpp_type=9,
+            name="has_away",
+            full_name="ClimateCommandRequest.has_away",
+            index=9,
+            number=10,
+            type=8,
+            cpp_type=7,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=False,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -2942,10 +5567,10 @@ _SUBSCRIBELOGSRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="send_failed",
-            full_name="SubscribeLogsResponse.send_failed",
-            index=3,
-            number=4,
+            name="away",
+            full_name="ClimateCommandRequest.away",
+            index=10,
+            number=11,
             type=8,
             cpp_type=7,
             label=1,
@@ -2959,57 +5584,16 @@ _SUBSCRIBELOGSRESPONSE = _descriptor.Descriptor(
             serialized_options=None,
             file=DESCRIPTOR,
         ),
-    ],
-    extensions=[],
-    nested_types=[],
-    enum_types=[],
-    serialized_options=None,
-    is_extendable=False,
-    syntax="proto3",
-    extension_ranges=[],
-    oneofs=[],
-    serialized_start=3113,
-    serialized_end=3213,
-)
-
-
-_SUBSCRIBESERVICECALLSREQUEST = _descriptor.Descriptor(
-    name="SubscribeServiceCallsRequest",
-    full_name="SubscribeServiceCallsRequest",
-    filename=None,
-    file=DESCRIPTOR,
-    containing_type=None,
-    fields=[],
-    extensions=[],
-    nested_types=[],
-    enum_types=[],
-    serialized_options=None,
-    is_extendable=False,
-    syntax="proto3",
-    extension_ranges=[],
-    oneofs=[],
-    serialized_start=3215,
-    serialized_end=3245,
-)
-
-
-_SERVICECALLRESPONSE_DATAENTRY = _descriptor.Descriptor(
-    name="DataEntry",
-    full_name="ServiceCallResponse.DataEntry",
-    filename=None,
-    file=DESCRIPTOR,
-    containing_type=None,
-    fields=[
         _descriptor.FieldDescriptor(
-            name="key",
-            full_name="ServiceCallResponse.DataEntry.key",
-            index=0,
-            number=1,
-            type=9,
-            cpp_type=9,
+            name="has_fan_mode",
+            full_name="ClimateCommandRequest.has_fan_mode",
+            index=11,
+            number=12,
+            type=8,
+            cpp_type=7,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=False,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -3019,15 +5603,15 @@ _SERVICECALLRESPONSE_DATAENTRY = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="value",
-            full_name="ServiceCallResponse.DataEntry.value",
-            index=1,
-            number=2,
-            type=9,
-            cpp_type=9,
+            name="fan_mode",
+            full_name="ClimateCommandRequest.fan_mode",
+            index=12,
+            number=13,
+            type=14,
+            cpp_type=8,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -3036,36 +5620,16 @@ _SERVICECALLRESPONSE_DATAENTRY = _descriptor.Descriptor(
             serialized_options=None,
             file=DESCRIPTOR,
         ),
-    ],
-    extensions=[],
-    nested_types=[],
-    enum_types=[],
-    serialized_options=_b("8\001"),
-    is_extendable=False,
-    syntax="proto3",
-    extension_ranges=[],
-    oneofs=[],
-    serialized_start=3453,
-    serialized_end=3496,
-)
-
-_SERVICECALLRESPONSE_DATATEMPLATEENTRY = _descriptor.Descriptor(
-    name="DataTemplateEntry",
-    full_name="ServiceCallResponse.DataTemplateEntry",
-    filename=None,
-    file=DESCRIPTOR,
-    containing_type=None,
-    fields=[
         _descriptor.FieldDescriptor(
-            name="key",
-            full_name="ServiceCallResponse.DataTemplateEntry.key",
-            index=0,
-            number=1,
-            type=9,
-            cpp_type=9,
+            name="has_swing_mode",
+            full_name="ClimateCommandRequest.has_swing_mode",
+            index=13,
+            number=14,
+            type=8,
+            cpp_type=7,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=False,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -3075,15 +5639,15 @@ _SERVICECALLRESPONSE_DATATEMPLATEENTRY = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="value",
-            full_name="ServiceCallResponse.DataTemplateEntry.value",
-            index=1,
-            number=2,
-            type=9,
-            cpp_type=9,
+            name="swing_mode",
+            full_name="ClimateCommandRequest.swing_mode",
+            index=14,
+            number=15,
+            type=14,
+            cpp_type=8,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -3096,50 +5660,33 @@ _SERVICECALLRESPONSE_DATATEMPLATEENTRY = _descriptor.Descriptor(
     extensions=[],
     nested_types=[],
     enum_types=[],
-    serialized_options=_b("8\001"),
+    serialized_options=None,
     is_extendable=False,
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=3498,
-    serialized_end=3549,
+    serialized_start=5746,
+    serialized_end=6178,
 )
 
-_SERVICECALLRESPONSE_VARIABLESENTRY = _descriptor.Descriptor(
-    name="VariablesEntry",
-    full_name="ServiceCallResponse.VariablesEntry",
+
+_PROFILERSTATSREQUEST = _descriptor.Descriptor(
+    name="ProfilerStatsRequest",
+    full_name="ProfilerStatsRequest",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
-            name="key",
-            full_name="ServiceCallResponse.VariablesEntry.key",
+            name="reset",
+            full_name="ProfilerStatsRequest.reset",
             index=0,
             number=1,
-            type=9,
-            cpp_type=9,
-            label=1,
-            has_default_value=False,
-            default_value=_b("").decode("utf-8"),
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
-            serialized_options=None,
-            file=DESCRIPTOR,
-        ),
-        _descriptor.FieldDescriptor(
-            name="value",
-            full_name="ServiceCallResponse.VariablesEntry.value",
-            index=1,
-            number=2,
-            type=9,
-            cpp_type=9,
+            type=8,
+            cpp_type=7,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=False,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -3152,32 +5699,33 @@ _SERVICECALLRESPONSE_VARIABLESENTRY = _descriptor.Descriptor(
     extensions=[],
     nested_types=[],
     enum_types=[],
-    serialized_options=_b("8\001"),
+    serialized_options=None,
     is_extendable=False,
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=3551,
-    serialized_end=3599,
+    serialized_start=6180,
+    serialized_end=6217,
 )
 
-_SERVICECALLRESPONSE = _descriptor.Descriptor(
-    name="ServiceCallResponse",
-    full_name="ServiceCallResponse",
+
+_PROFILERTIMINGSTATS = _descriptor.Descriptor(
+    name="ProfilerTimingStats",
+    full_name="ProfilerTimingStats",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
-            name="service",
-            full_name="ServiceCallResponse.service",
+            name="count",
+            full_name="ProfilerTimingStats.count",
             index=0,
             number=1,
-            type=9,
-            cpp_type=9,
+            type=13,
+            cpp_type=3,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -3187,15 +5735,15 @@ _SERVICECALLRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="data",
-            full_name="ServiceCallResponse.data",
+            name="min_us",
+            full_name="ProfilerTimingStats.min_us",
             index=1,
             number=2,
-            type=11,
-            cpp_type=10,
-            label=3,
+            type=13,
+            cpp_type=3,
+            label=1,
             has_default_value=False,
-            default_value=[],
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -3205,15 +5753,15 @@ _SERVICECALLRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="data_template",
-            full_name="ServiceCallResponse.data_template",
+            name="avg_us",
+            full_name="ProfilerTimingStats.avg_us",
             index=2,
             number=3,
-            type=11,
-            cpp_type=10,
-            label=3,
+            type=13,
+            cpp_type=3,
+            label=1,
             has_default_value=False,
-            default_value=[],
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -3223,15 +5771,15 @@ _SERVICECALLRESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="variables",
-            full_name="ServiceCallResponse.variables",
+            name="max_us",
+            full_name="ProfilerTimingStats.max_us",
             index=3,
             number=4,
-            type=11,
-            cpp_type=10,
-            label=3,
+            type=13,
+            cpp_type=3,
+            label=1,
             has_default_value=False,
-            default_value=[],
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -3240,61 +5788,16 @@ _SERVICECALLRESPONSE = _descriptor.Descriptor(
             serialized_options=None,
             file=DESCRIPTOR,
         ),
-    ],
-    extensions=[],
-    nested_types=[
-        _SERVICECALLRESPONSE_DATAENTRY,
-        _SERVICECALLRESPONSE_DATATEMPLATEENTRY,
-        _SERVICECALLRESPONSE_VARIABLESENTRY,
-    ],
-    enum_types=[],
-    serialized_options=None,
-    is_extendable=False,
-    syntax="proto3",
-    extension_ranges=[],
-    oneofs=[],
-    serialized_start=3248,
-    serialized_end=3599,
-)
-
-
-_SUBSCRIBEHOMEASSISTANTSTATESREQUEST = _descriptor.Descriptor(
-    name="SubscribeHomeAssistantStatesRequest",
-    full_name="SubscribeHomeAssistantStatesRequest",
-    filename=None,
-    file=DESCRIPTOR,
-    containing_type=None,
-    fields=[],
-    extensions=[],
-    nested_types=[],
-    enum_types=[],
-    serialized_options=None,
-    is_extendable=False,
-    syntax="proto3",
-    extension_ranges=[],
-    oneofs=[],
-    serialized_start=3601,
-    serialized_end=3638,
-)
-
-
-_SUBSCRIBEHOMEASSISTANTSTATERESPONSE = _descriptor.Descriptor(
-    name="SubscribeHomeAssistantStateResponse",
-    full_name="SubscribeHomeAssistantStateResponse",
-    filename=None,
-    file=DESCRIPTOR,
-    containing_type=None,
-    fields=[
         _descriptor.FieldDescriptor(
-            name="entity_id",
-            full_name="SubscribeHomeAssistantStateResponse.entity_id",
-            index=0,
-            number=1,
-            type=9,
-            cpp_type=9,
+            name="p99_us",
+            full_name="ProfilerTimingStats.p99_us",
+            index=4,
+            number=5,
+            type=13,
+            cpp_type=3,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=0,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -3312,21 +5815,21 @@ _SUBSCRIBEHOMEASSISTANTSTATERESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=3640,
-    serialized_end=3696,
+    serialized_start=6219,
+    serialized_end=6319,
 )
 
 
-_HOMEASSISTANTSTATERESPONSE = _descriptor.Descriptor(
-    name="HomeAssistantStateResponse",
-    full_name="HomeAssistantStateResponse",
+_PROFILERSTATSRESPONSE = _descriptor.Descriptor(
+    name="ProfilerStatsResponse",
+    full_name="ProfilerStatsResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
     fields=[
         _descriptor.FieldDescriptor(
-            name="entity_id",
-            full_name="HomeAssistantStateResponse.entity_id",
+            name="source",
+            full_name="ProfilerStatsResponse.source",
             index=0,
             number=1,
             type=9,
@@ -3343,15 +5846,51 @@ _HOMEASSISTANTSTATERESPONSE = _descriptor.Descriptor(
             file=DESCRIPTOR,
         ),
         _descriptor.FieldDescriptor(
-            name="state",
-            full_name="HomeAssistantStateResponse.state",
+            name="loop",
+            full_name="ProfilerStatsResponse.loop",
             index=1,
             number=2,
-            type=9,
-            cpp_type=9,
+            type=11,
+            cpp_type=10,
+            label=1,
+            has_default_value=False,
+            default_value=None,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="update",
+            full_name="ProfilerStatsResponse.update",
+            index=2,
+            number=3,
+            type=11,
+            cpp_type=10,
+            label=1,
+            has_default_value=False,
+            default_value=None,
+            message_type=None,
+            enum_type=None,
+            containing_type=None,
+            is_extension=False,
+            extension_scope=None,
+            serialized_options=None,
+            file=DESCRIPTOR,
+        ),
+        _descriptor.FieldDescriptor(
+            name="scheduler",
+            full_name="ProfilerStatsResponse.scheduler",
+            index=3,
+            number=4,
+            type=11,
+            cpp_type=10,
             label=1,
             has_default_value=False,
-            default_value=_b("").decode("utf-8"),
+            default_value=None,
             message_type=None,
             enum_type=None,
             containing_type=None,
@@ -3369,14 +5908,14 @@ _HOMEASSISTANTSTATERESPONSE = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=3698,
-    serialized_end=3760,
+    serialized_start=6322,
+    serialized_end=6476,
 )
 
 
-_GETTIMEREQUEST = _descriptor.Descriptor(
-    name="GetTimeRequest",
-    full_name="GetTimeRequest",
+_PROFILERSTATSDONERESPONSE = _descriptor.Descriptor(
+    name="ProfilerStatsDoneResponse",
+    full_name="ProfilerStatsDoneResponse",
     filename=None,
     file=DESCRIPTOR,
     containing_type=None,
@@ -3389,71 +5928,51 @@ _GETTIMEREQUEST = _descriptor.Descriptor(
     syntax="proto3",
     extension_ranges=[],
     oneofs=[],
-    serialized_start=3762,
-    serialized_end=3778,
-)
-
-
-_GETTIMERESPONSE = _descriptor.Descriptor(
-    name="GetTimeResponse",
-    full_name="GetTimeResponse",
-    filename=None,
-    file=DESCRIPTOR,
-    containing_type=None,
-    fields=[
-        _descriptor.FieldDescriptor(
-            name="epoch_seconds",
-            full_name="GetTimeResponse.epoch_seconds",
-            index=0,
-            number=1,
-            type=7,
-            cpp_type=3,
-            label=1,
-            has_default_value=False,
-            default_value=0,
-            message_type=None,
-            enum_type=None,
-            containing_type=None,
-            is_extension=False,
-            extension_scope=None,
-            serialized_options=None,
-            file=DESCRIPTOR,
-        ),
-    ],
-    extensions=[],
-    nested_types=[],
-    enum_types=[],
-    serialized_options=None,
-    is_extendable=False,
-    syntax="proto3",
-    extension_ranges=[],
-    oneofs=[],
-    serialized_start=3780,
-    serialized_end=3820,
+    serialized_start=6478,
+    serialized_end=6505,
 )
 
-_COVERSTATERESPONSE.fields_by_name["state"].enum_type = _COVERSTATERESPONSE_COVERSTATE
-_COVERSTATERESPONSE_COVERSTATE.containing_type = _COVERSTATERESPONSE
+_COVERSTATERESPONSE.fields_by_name["legacy_state"].enum_type = _LEGACYCOVERSTATE
+_COVERSTATERESPONSE.fields_by_name["current_operation"].enum_type = _COVEROPERATION
+_COVERCOMMANDREQUEST.fields_by_name["legacy_command"].enum_type = _LEGACYCOVERCOMMAND
 _FANSTATERESPONSE.fields_by_name["speed"].enum_type = _FANSPEED
-_COVERCOMMANDREQUEST.fields_by_name[
-    "command"
-].enum_type = _COVERCOMMANDREQUEST_COVERCOMMAND
-_COVERCOMMANDREQUEST_COVERCOMMAND.containing_type = _COVERCOMMANDREQUEST
+_FANSTATERESPONSE.fields_by_name["direction"].enum_type = _FANDIRECTION
 _FANCOMMANDREQUEST.fields_by_name["speed"].enum_type = _FANSPEED
+_FANCOMMANDREQUEST.fields_by_name["direction"].enum_type = _FANDIRECTION
 _SUBSCRIBELOGSREQUEST.fields_by_name["level"].enum_type = _LOGLEVEL
 _SUBSCRIBELOGSRESPONSE.fields_by_name["level"].enum_type = _LOGLEVEL
-_SERVICECALLRESPONSE_DATAENTRY.containing_type = _SERVICECALLRESPONSE
-_SERVICECALLRESPONSE_DATATEMPLATEENTRY.containing_type = _SERVICECALLRESPONSE
-_SERVICECALLRESPONSE_VARIABLESENTRY.containing_type = _SERVICECALLRESPONSE
-_SERVICECALLRESPONSE.fields_by_name[
+_SUBSCRIBELOGSBINARYRESPONSE.fields_by_name["level"].enum_type = _LOGLEVEL
+_HOMEASSISTANTSERVICERESPONSE.fields_by_name[
     "data"
-].message_type = _SERVICECALLRESPONSE_DATAENTRY
-_SERVICECALLRESPONSE.fields_by_name[
+].message_type = _HOMEASSISTANTSERVICEMAP
+_HOMEASSISTANTSERVICERESPONSE.fields_by_name[
     "data_template"
-].message_type = _SERVICECALLRESPONSE_DATATEMPLATEENTRY
-_SERVICECALLRESPONSE.fields_by_name[
+].message_type = _HOMEASSISTANTSERVICEMAP
+_HOMEASSISTANTSERVICERESPONSE.fields_by_name[
     "variables"
-].message_type = _SERVICECALLRESPONSE_VARIABLESENTRY
+].message_type = _HOMEASSISTANTSERVICEMAP
+_LISTENTITIESSERVICESARGUMENT.fields_by_name["type"].enum_type = _SERVICEARGTYPE
+_LISTENTITIESSERVICESRESPONSE.fields_by_name[
+    "args"
+].message_type = _LISTENTITIESSERVICESARGUMENT
+_EXECUTESERVICEREQUEST.fields_by_name["args"].message_type = _EXECUTESERVICEARGUMENT
+_LISTENTITIESCLIMATERESPONSE.fields_by_name["supported_modes"].enum_type = _CLIMATEMODE
+_LISTENTITIESCLIMATERESPONSE.fields_by_name[
+    "supported_fan_modes"
+].enum_type = _CLIMATEFANMODE
+_LISTENTITIESCLIMATERESPONSE.fields_by_name[
+    "supported_swing_modes"
+].enum_type = _CLIMATESWINGMODE
+_CLIMATESTATERESPONSE.fields_by_name["mode"].enum_type = _CLIMATEMODE
+_CLIMATESTATERESPONSE.fields_by_name["action"].enum_type = _CLIMATEACTION
+_CLIMATESTATERESPONSE.fields_by_name["fan_mode"].enum_type = _CLIMATEFANMODE
+_CLIMATESTATERESPONSE.fields_by_name["swing_mode"].enum_type = _CLIMATESWINGMODE
+_CLIMATECOMMANDREQUEST.fields_by_name["mode"].enum_type = _CLIMATEMODE
+_CLIMATECOMMANDREQUEST.fields_by_name["fan_mode"].enum_type = _CLIMATEFANMODE
+_CLIMATECOMMANDREQUEST.fields_by_name["swing_mode"].enum_type = _CLIMATESWINGMODE
+_PROFILERSTATSRESPONSE.fields_by_name["loop"].message_type = _PROFILERTIMINGSTATS
+_PROFILERSTATSRESPONSE.fields_by_name["update"].message_type = _PROFILERTIMINGSTATS
+_PROFILERSTATSRESPONSE.fields_by_name["scheduler"].message_type = _PROFILERTIMINGSTATS
 DESCRIPTOR.message_types_by_name["HelloRequest"] = _HELLOREQUEST
 DESCRIPTOR.message_types_by_name["HelloResponse"] = _HELLORESPONSE
 DESCRIPTOR.message_types_by_name["ConnectRequest"] = _CONNECTREQUEST
@@ -3465,46 +5984,52 @@ DESCRIPTOR.message_types_by_name["PingResponse"] = _PINGRESPONSE
 DESCRIPTOR.message_types_by_name["DeviceInfoRequest"] = _DEVICEINFOREQUEST
 DESCRIPTOR.message_types_by_name["DeviceInfoResponse"] = _DEVICEINFORESPONSE
 DESCRIPTOR.message_types_by_name["ListEntitiesRequest"] = _LISTENTITIESREQUEST
+DESCRIPTOR.message_types_by_name["ListEntitiesDoneResponse"] = _LISTENTITIESDONERESPONSE
+DESCRIPTOR.message_types_by_name["SubscribeStatesRequest"] = _SUBSCRIBESTATESREQUEST
 DESCRIPTOR.message_types_by_name[
     "ListEntitiesBinarySensorResponse"
 ] = _LISTENTITIESBINARYSENSORRESPONSE
+DESCRIPTOR.message_types_by_name[
+    "BinarySensorStateResponse"
+] = _BINARYSENSORSTATERESPONSE
 DESCRIPTOR.message_types_by_name[
     "ListEntitiesCoverResponse"
 ] = _LISTENTITIESCOVERRESPONSE
+DESCRIPTOR.message_types_by_name["CoverStateResponse"] = _COVERSTATERESPONSE
+DESCRIPTOR.message_types_by_name["CoverCommandRequest"] = _COVERCOMMANDREQUEST
 DESCRIPTOR.message_types_by_name["ListEntitiesFanResponse"] = _LISTENTITIESFANRESPONSE
+DESCRIPTOR.message_types_by_name["FanStateResponse"] = _FANSTATERESPONSE
+DESCRIPTOR.message_types_by_name["FanCommandRequest"] = _FANCOMMANDREQUEST
 DESCRIPTOR.message_types_by_name[
     "ListEntitiesLightResponse"
 ] = _LISTENTITIESLIGHTRESPONSE
+DESCRIPTOR.message_types_by_name["LightStateResponse"] = _LIGHTSTATERESPONSE
+DESCRIPTOR.message_types_by_name["LightCommandRequest"] = _LIGHTCOMMANDREQUEST
 DESCRIPTOR.message_types_by_name[
     "ListEntitiesSensorResponse"
 ] = _LISTENTITIESSENSORRESPONSE
+DESCRIPTOR.message_types_by_name["SensorStateResponse"] = _SENSORSTATERESPONSE
 DESCRIPTOR.message_types_by_name[
     "ListEntitiesSwitchResponse"
 ] = _LISTENTITIESSWITCHRESPONSE
+DESCRIPTOR.message_types_by_name["SwitchStateResponse"] = _SWITCHSTATERESPONSE
+DESCRIPTOR.message_types_by_name["SwitchCommandRequest"] = _SWITCHCOMMANDREQUEST
 DESCRIPTOR.message_types_by_name[
     "ListEntitiesTextSensorResponse"
 ] = _LISTENTITIESTEXTSENSORRESPONSE
-DESCRIPTOR.message_types_by_name["ListEntitiesDoneResponse"] = _LISTENTITIESDONERESPONSE
-DESCRIPTOR.message_types_by_name["SubscribeStatesRequest"] = _SUBSCRIBESTATESREQUEST
-DESCRIPTOR.message_types_by_name[
-    "BinarySensorStateResponse"
-] = _BINARYSENSORSTATERESPONSE
-DESCRIPTOR.message_types_by_name["CoverStateResponse"] = _COVERSTATERESPONSE
-DESCRIPTOR.message_types_by_name["FanStateResponse"] = _FANSTATERESPONSE
-DESCRIPTOR.message_types_by_name["LightStateResponse"] = _LIGHTSTATERESPONSE
-DESCRIPTOR.message_types_by_name["SensorStateResponse"] = _SENSORSTATERESPONSE
-DESCRIPTOR.message_types_by_name["SwitchStateResponse"] = _SWITCHSTATERESPONSE
 DESCRIPTOR.message_types_by_name["TextSensorStateResponse"] = _TEXTSENSORSTATERESPONSE
-DESCRIPTOR.message_types_by_name["CoverCommandRequest"] = _COVERCOMMANDREQUEST
-DESCRIPTOR.message_types_by_name["FanCommandRequest"] = _FANCOMMANDREQUEST
-DESCRIPTOR.message_types_by_name["LightCommandRequest"] = _LIGHTCOMMANDREQUEST
-DESCRIPTOR.message_types_by_name["SwitchCommandRequest"] = _SWITCHCOMMANDREQUEST
 DESCRIPTOR.message_types_by_name["SubscribeLogsRequest"] = _SUBSCRIBELOGSREQUEST
 DESCRIPTOR.message_types_by_name["SubscribeLogsResponse"] = _SUBSCRIBELOGSRESPONSE
 DESCRIPTOR.message_types_by_name[
-    "SubscribeServiceCallsRequest"
-] = _SUBSCRIBESERVICECALLSREQUEST
-DESCRIPTOR.message_types_by_name["ServiceCallResponse"] = _SERVICECALLRESPONSE
+    "SubscribeLogsBinaryResponse"
+] = _SUBSCRIBELOGSBINARYRESPONSE
+DESCRIPTOR.message_types_by_name[
+    "SubscribeHomeassistantServicesRequest"
+] = _SUBSCRIBEHOMEASSISTANTSERVICESREQUEST
+DESCRIPTOR.message_types_by_name["HomeassistantServiceMap"] = _HOMEASSISTANTSERVICEMAP
+DESCRIPTOR.message_types_by_name[
+    "HomeassistantServiceResponse"
+] = _HOMEASSISTANTSERVICERESPONSE
 DESCRIPTOR.message_types_by_name[
     "SubscribeHomeAssistantStatesRequest"
 ] = _SUBSCRIBEHOMEASSISTANTSTATESREQUEST
@@ -3516,8 +6041,41 @@ DESCRIPTOR.message_types_by_name[
 ] = _HOMEASSISTANTSTATERESPONSE
 DESCRIPTOR.message_types_by_name["GetTimeRequest"] = _GETTIMEREQUEST
 DESCRIPTOR.message_types_by_name["GetTimeResponse"] = _GETTIMERESPONSE
+DESCRIPTOR.message_types_by_name[
+    "ListEntitiesServicesArgument"
+] = _LISTENTITIESSERVICESARGUMENT
+DESCRIPTOR.message_types_by_name[
+    "ListEntitiesServicesResponse"
+] = _LISTENTITIESSERVICESRESPONSE
+DESCRIPTOR.message_types_by_name["ExecuteServiceArgument"] = _EXECUTESERVICEARGUMENT
+DESCRIPTOR.message_types_by_name["ExecuteServiceRequest"] = _EXECUTESERVICEREQUEST
+DESCRIPTOR.message_types_by_name[
+    "ListEntitiesCameraResponse"
+] = _LISTENTITIESCAMERARESPONSE
+DESCRIPTOR.message_types_by_name["CameraImageResponse"] = _CAMERAIMAGERESPONSE
+DESCRIPTOR.message_types_by_name["CameraImageRequest"] = _CAMERAIMAGEREQUEST
+DESCRIPTOR.message_types_by_name[
+    "ListEntitiesClimateResponse"
+] = _LISTENTITIESCLIMATERESPONSE
+DESCRIPTOR.message_types_by_name["ClimateStateResponse"] = _CLIMATESTATERESPONSE
+DESCRIPTOR.message_types_by_name["ClimateCommandRequest"] = _CLIMATECOMMANDREQUEST
+DESCRIPTOR.message_types_by_name["ProfilerStatsRequest"] = _PROFILERSTATSREQUEST
+DESCRIPTOR.message_types_by_name["ProfilerTimingStats"] = _PROFILERTIMINGSTATS
+DESCRIPTOR.message_types_by_name["ProfilerStatsResponse"] = _PROFILERSTATSRESPONSE
+DESCRIPTOR.message_types_by_name[
+    "ProfilerStatsDoneResponse"
+] = _PROFILERSTATSDONERESPONSE
+DESCRIPTOR.enum_types_by_name["LegacyCoverState"] = _LEGACYCOVERSTATE
+DESCRIPTOR.enum_types_by_name["CoverOperation"] = _COVEROPERATION
+DESCRIPTOR.enum_types_by_name["LegacyCoverCommand"] = _LEGACYCOVERCOMMAND
 DESCRIPTOR.enum_types_by_name["FanSpeed"] = _FANSPEED
+DESCRIPTOR.enum_types_by_name["FanDirection"] = _FANDIRECTION
 DESCRIPTOR.enum_types_by_name["LogLevel"] = _LOGLEVEL
+DESCRIPTOR.enum_types_by_name["ServiceArgType"] = _SERVICEARGTYPE
+DESCRIPTOR.enum_types_by_name["ClimateMode"] = _CLIMATEMODE
+DESCRIPTOR.enum_types_by_name["ClimateFanMode"] = _CLIMATEFANMODE
+DESCRIPTOR.enum_types_by_name["ClimateSwingMode"] = _CLIMATESWINGMODE
+DESCRIPTOR.enum_types_by_name["ClimateAction"] = _CLIMATEACTION
 _sym_db.RegisterFileDescriptor(DESCRIPTOR)
 
 HelloRequest = _reflection.GeneratedProtocolMessageType(
@@ -3568,430 +6126,573 @@ DisconnectRequest = _reflection.GeneratedProtocolMessageType(
     "DisconnectRequest",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_DISCONNECTREQUEST,
+        DESCRIPTOR=_DISCONNECTREQUEST,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:DisconnectRequest)
+    ),
+)
+_sym_db.RegisterMessage(DisconnectRequest)
+
+DisconnectResponse = _reflection.GeneratedProtocolMessageType(
+    "DisconnectResponse",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_DISCONNECTRESPONSE,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:DisconnectResponse)
+    ),
+)
+_sym_db.RegisterMessage(DisconnectResponse)
+
+PingRequest = _reflection.GeneratedProtocolMessageType(
+    "PingRequest",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_PINGREQUEST,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:PingRequest)
+    ),
+)
+_sym_db.RegisterMessage(PingRequest)
+
+PingResponse = _reflection.GeneratedProtocolMessageType(
+    "PingResponse",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_PINGRESPONSE,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:PingResponse)
+    ),
+)
+_sym_db.RegisterMessage(PingResponse)
+
+DeviceInfoRequest = _reflection.GeneratedProtocolMessageType(
+    "DeviceInfoRequest",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_DEVICEINFOREQUEST,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:DeviceInfoRequest)
+    ),
+)
+_sym_db.RegisterMessage(DeviceInfoRequest)
+
+DeviceInfoResponse = _reflection.GeneratedProtocolMessageType(
+    "DeviceInfoResponse",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_DEVICEINFORESPONSE,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:DeviceInfoResponse)
+    ),
+)
+_sym_db.RegisterMessage(DeviceInfoResponse)
+
+ListEntitiesRequest = _reflection.GeneratedProtocolMessageType(
+    "ListEntitiesRequest",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_LISTENTITIESREQUEST,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:ListEntitiesRequest)
+    ),
+)
+_sym_db.RegisterMessage(ListEntitiesRequest)
+
+ListEntitiesDoneResponse = _reflection.GeneratedProtocolMessageType(
+    "ListEntitiesDoneResponse",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_LISTENTITIESDONERESPONSE,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:ListEntitiesDoneResponse)
+    ),
+)
+_sym_db.RegisterMessage(ListEntitiesDoneResponse)
+
+SubscribeStatesRequest = _reflection.GeneratedProtocolMessageType(
+    "SubscribeStatesRequest",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_SUBSCRIBESTATESREQUEST,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:SubscribeStatesRequest)
+    ),
+)
+_sym_db.RegisterMessage(SubscribeStatesRequest)
+
+ListEntitiesBinarySensorResponse = _reflection.GeneratedProtocolMessageType(
+    "ListEntitiesBinarySensorResponse",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_LISTENTITIESBINARYSENSORRESPONSE,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:ListEntitiesBinarySensorResponse)
+    ),
+)
+_sym_db.RegisterMessage(ListEntitiesBinarySensorResponse)
+
+BinarySensorStateResponse = _reflection.GeneratedProtocolMessageType(
+    "BinarySensorStateResponse",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_BINARYSENSORSTATERESPONSE,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:BinarySensorStateResponse)
+    ),
+)
+_sym_db.RegisterMessage(BinarySensorStateResponse)
+
+ListEntitiesCoverResponse = _reflection.GeneratedProtocolMessageType(
+    "ListEntitiesCoverResponse",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_LISTENTITIESCOVERRESPONSE,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:ListEntitiesCoverResponse)
+    ),
+)
+_sym_db.RegisterMessage(ListEntitiesCoverResponse)
+
+CoverStateResponse = _reflection.GeneratedProtocolMessageType(
+    "CoverStateResponse",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_COVERSTATERESPONSE,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:CoverStateResponse)
+    ),
+)
+_sym_db.RegisterMessage(CoverStateResponse)
+
+CoverCommandRequest = _reflection.GeneratedProtocolMessageType(
+    "CoverCommandRequest",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_COVERCOMMANDREQUEST,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:CoverCommandRequest)
+    ),
+)
+_sym_db.RegisterMessage(CoverCommandRequest)
+
+ListEntitiesFanResponse = _reflection.GeneratedProtocolMessageType(
+    "ListEntitiesFanResponse",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_LISTENTITIESFANRESPONSE,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:ListEntitiesFanResponse)
+    ),
+)
+_sym_db.RegisterMessage(ListEntitiesFanResponse)
+
+FanStateResponse = _reflection.GeneratedProtocolMessageType(
+    "FanStateResponse",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_FANSTATERESPONSE,
+        __module__="api_pb2"
+        # @@protoc_insertion_point(class_scope:FanStateResponse)
+    ),
+)
+_sym_db.RegisterMessage(FanStateResponse)
+
+FanCommandRequest = _reflection.GeneratedProtocolMessageType(
+    "FanCommandRequest",
+    (_message.Message,),
+    dict(
+        DESCRIPTOR=_FANCOMMANDREQUEST,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:DisconnectRequest)
+        # @@protoc_insertion_point(class_scope:FanCommandRequest)
     ),
 )
-_sym_db.RegisterMessage(DisconnectRequest)
+_sym_db.RegisterMessage(FanCommandRequest)
 
-DisconnectResponse = _reflection.GeneratedProtocolMessageType(
-    "DisconnectResponse",
+ListEntitiesLightResponse = _reflection.GeneratedProtocolMessageType(
+    "ListEntitiesLightResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_DISCONNECTRESPONSE,
+        DESCRIPTOR=_LISTENTITIESLIGHTRESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:DisconnectResponse)
+        # @@protoc_insertion_point(class_scope:ListEntitiesLightResponse)
     ),
 )
-_sym_db.RegisterMessage(DisconnectResponse)
+_sym_db.RegisterMessage(ListEntitiesLightResponse)
 
-PingRequest = _reflection.GeneratedProtocolMessageType(
-    "PingRequest",
+LightStateResponse = _reflection.GeneratedProtocolMessageType(
+    "LightStateResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_PINGREQUEST,
+        DESCRIPTOR=_LIGHTSTATERESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:PingRequest)
+        # @@protoc_insertion_point(class_scope:LightStateResponse)
     ),
 )
-_sym_db.RegisterMessage(PingRequest)
+_sym_db.RegisterMessage(LightStateResponse)
 
-PingResponse = _reflection.GeneratedProtocolMessageType(
-    "PingResponse",
+LightCommandRequest = _reflection.GeneratedProtocolMessageType(
+    "LightCommandRequest",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_PINGRESPONSE,
+        DESCRIPTOR=_LIGHTCOMMANDREQUEST,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:PingResponse)
+        # @@protoc_insertion_point(class_scope:LightCommandRequest)
     ),
 )
-_sym_db.RegisterMessage(PingResponse)
+_sym_db.RegisterMessage(LightCommandRequest)
 
-DeviceInfoRequest = _reflection.GeneratedProtocolMessageType(
-    "DeviceInfoRequest",
+ListEntitiesSensorResponse = _reflection.GeneratedProtocolMessageType(
+    "ListEntitiesSensorResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_DEVICEINFOREQUEST,
+        DESCRIPTOR=_LISTENTITIESSENSORRESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:DeviceInfoRequest)
+        # @@protoc_insertion_point(class_scope:ListEntitiesSensorResponse)
     ),
 )
-_sym_db.RegisterMessage(DeviceInfoRequest)
+_sym_db.RegisterMessage(ListEntitiesSensorResponse)
 
-DeviceInfoResponse = _reflection.GeneratedProtocolMessageType(
-    "DeviceInfoResponse",
+SensorStateResponse = _reflection.GeneratedProtocolMessageType(
+    "SensorStateResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_DEVICEINFORESPONSE,
+        DESCRIPTOR=_SENSORSTATERESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:DeviceInfoResponse)
+        # @@protoc_insertion_point(class_scope:SensorStateResponse)
     ),
 )
-_sym_db.RegisterMessage(DeviceInfoResponse)
+_sym_db.RegisterMessage(SensorStateResponse)
 
-ListEntitiesRequest = _reflection.GeneratedProtocolMessageType(
-    "ListEntitiesRequest",
+ListEntitiesSwitchResponse = _reflection.GeneratedProtocolMessageType(
+    "ListEntitiesSwitchResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_LISTENTITIESREQUEST,
+        DESCRIPTOR=_LISTENTITIESSWITCHRESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:ListEntitiesRequest)
+        # @@protoc_insertion_point(class_scope:ListEntitiesSwitchResponse)
     ),
 )
-_sym_db.RegisterMessage(ListEntitiesRequest)
+_sym_db.RegisterMessage(ListEntitiesSwitchResponse)
 
-ListEntitiesBinarySensorResponse = _reflection.GeneratedProtocolMessageType(
-    "ListEntitiesBinarySensorResponse",
+SwitchStateResponse = _reflection.GeneratedProtocolMessageType(
+    "SwitchStateResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_LISTENTITIESBINARYSENSORRESPONSE,
+        DESCRIPTOR=_SWITCHSTATERESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:ListEntitiesBinarySensorResponse)
+        # @@protoc_insertion_point(class_scope:SwitchStateResponse)
     ),
 )
-_sym_db.RegisterMessage(ListEntitiesBinarySensorResponse)
+_sym_db.RegisterMessage(SwitchStateResponse)
 
-ListEntitiesCoverResponse = _reflection.GeneratedProtocolMessageType(
-    "ListEntitiesCoverResponse",
+SwitchCommandRequest = _reflection.GeneratedProtocolMessageType(
+    "SwitchCommandRequest",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_LISTENTITIESCOVERRESPONSE,
+        DESCRIPTOR=_SWITCHCOMMANDREQUEST,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:ListEntitiesCoverResponse)
+        # @@protoc_insertion_point(class_scope:SwitchCommandRequest)
     ),
 )
-_sym_db.RegisterMessage(ListEntitiesCoverResponse)
+_sym_db.RegisterMessage(SwitchCommandRequest)
 
-ListEntitiesFanResponse = _reflection.GeneratedProtocolMessageType(
-    "ListEntitiesFanResponse",
+ListEntitiesTextSensorResponse = _reflection.GeneratedProtocolMessageType(
+    "ListEntitiesTextSensorResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_LISTENTITIESFANRESPONSE,
+        DESCRIPTOR=_LISTENTITIESTEXTSENSORRESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:ListEntitiesFanResponse)
+        # @@protoc_insertion_point(class_scope:ListEntitiesTextSensorResponse)
     ),
 )
-_sym_db.RegisterMessage(ListEntitiesFanResponse)
+_sym_db.RegisterMessage(ListEntitiesTextSensorResponse)
 
-ListEntitiesLightResponse = _reflection.GeneratedProtocolMessageType(
-    "ListEntitiesLightResponse",
+TextSensorStateResponse = _reflection.GeneratedProtocolMessageType(
+    "TextSensorStateResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_LISTENTITIESLIGHTRESPONSE,
+        DESCRIPTOR=_TEXTSENSORSTATERESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:ListEntitiesLightResponse)
+        # @@protoc_insertion_point(class_scope:TextSensorStateResponse)
     ),
 )
-_sym_db.RegisterMessage(ListEntitiesLightResponse)
+_sym_db.RegisterMessage(TextSensorStateResponse)
 
-ListEntitiesSensorResponse = _reflection.GeneratedProtocolMessageType(
-    "ListEntitiesSensorResponse",
+SubscribeLogsRequest = _reflection.GeneratedProtocolMessageType(
+    "SubscribeLogsRequest",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_LISTENTITIESSENSORRESPONSE,
+        DESCRIPTOR=_SUBSCRIBELOGSREQUEST,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:ListEntitiesSensorResponse)
+        # @@protoc_insertion_point(class_scope:SubscribeLogsRequest)
     ),
 )
-_sym_db.RegisterMessage(ListEntitiesSensorResponse)
+_sym_db.RegisterMessage(SubscribeLogsRequest)
 
-ListEntitiesSwitchResponse = _reflection.GeneratedProtocolMessageType(
-    "ListEntitiesSwitchResponse",
+SubscribeLogsResponse = _reflection.GeneratedProtocolMessageType(
+    "SubscribeLogsResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_LISTENTITIESSWITCHRESPONSE,
+        DESCRIPTOR=_SUBSCRIBELOGSRESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:ListEntitiesSwitchResponse)
+        # @@protoc_insertion_point(class_scope:SubscribeLogsResponse)
     ),
 )
-_sym_db.RegisterMessage(ListEntitiesSwitchResponse)
+_sym_db.RegisterMessage(SubscribeLogsResponse)
 
-ListEntitiesTextSensorResponse = _reflection.GeneratedProtocolMessageType(
-    "ListEntitiesTextSensorResponse",
+SubscribeLogsBinaryResponse = _reflection.GeneratedProtocolMessageType(
+    "SubscribeLogsBinaryResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_LISTENTITIESTEXTSENSORRESPONSE,
+        DESCRIPTOR=_SUBSCRIBELOGSBINARYRESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:ListEntitiesTextSensorResponse)
+        # @@protoc_insertion_point(class_scope:SubscribeLogsBinaryResponse)
     ),
 )
-_sym_db.RegisterMessage(ListEntitiesTextSensorResponse)
+_sym_db.RegisterMessage(SubscribeLogsBinaryResponse)
 
-ListEntitiesDoneResponse = _reflection.GeneratedProtocolMessageType(
-    "ListEntitiesDoneResponse",
+SubscribeHomeassistantServicesRequest = _reflection.GeneratedProtocolMessageType(
+    "SubscribeHomeassistantServicesRequest",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_LISTENTITIESDONERESPONSE,
+        DESCRIPTOR=_SUBSCRIBEHOMEASSISTANTSERVICESREQUEST,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:ListEntitiesDoneResponse)
+        # @@protoc_insertion_point(class_scope:SubscribeHomeassistantServicesRequest)
     ),
 )
-_sym_db.RegisterMessage(ListEntitiesDoneResponse)
+_sym_db.RegisterMessage(SubscribeHomeassistantServicesRequest)
 
-SubscribeStatesRequest = _reflection.GeneratedProtocolMessageType(
-    "SubscribeStatesRequest",
+HomeassistantServiceMap = _reflection.GeneratedProtocolMessageType(
+    "HomeassistantServiceMap",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_SUBSCRIBESTATESREQUEST,
+        DESCRIPTOR=_HOMEASSISTANTSERVICEMAP,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:SubscribeStatesRequest)
+        # @@protoc_insertion_point(class_scope:HomeassistantServiceMap)
     ),
 )
-_sym_db.RegisterMessage(SubscribeStatesRequest)
+_sym_db.RegisterMessage(HomeassistantServiceMap)
 
-BinarySensorStateResponse = _reflection.GeneratedProtocolMessageType(
-    "BinarySensorStateResponse",
+HomeassistantServiceResponse = _reflection.GeneratedProtocolMessageType(
+    "HomeassistantServiceResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_BINARYSENSORSTATERESPONSE,
+        DESCRIPTOR=_HOMEASSISTANTSERVICERESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:BinarySensorStateResponse)
+        # @@protoc_insertion_point(class_scope:HomeassistantServiceResponse)
     ),
 )
-_sym_db.RegisterMessage(BinarySensorStateResponse)
+_sym_db.RegisterMessage(HomeassistantServiceResponse)
 
-CoverStateResponse = _reflection.GeneratedProtocolMessageType(
-    "CoverStateResponse",
+SubscribeHomeAssistantStatesRequest = _reflection.GeneratedProtocolMessageType(
+    "SubscribeHomeAssistantStatesRequest",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_COVERSTATERESPONSE,
+        DESCRIPTOR=_SUBSCRIBEHOMEASSISTANTSTATESREQUEST,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:CoverStateResponse)
+        # @@protoc_insertion_point(class_scope:SubscribeHomeAssistantStatesRequest)
     ),
 )
-_sym_db.RegisterMessage(CoverStateResponse)
+_sym_db.RegisterMessage(SubscribeHomeAssistantStatesRequest)
 
-FanStateResponse = _reflection.GeneratedProtocolMessageType(
-    "FanStateResponse",
+SubscribeHomeAssistantStateResponse = _reflection.GeneratedProtocolMessageType(
+    "SubscribeHomeAssistantStateResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_FANSTATERESPONSE,
+        DESCRIPTOR=_SUBSCRIBEHOMEASSISTANTSTATERESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:FanStateResponse)
+        # @@protoc_insertion_point(class_scope:SubscribeHomeAssistantStateResponse)
     ),
 )
-_sym_db.RegisterMessage(FanStateResponse)
+_sym_db.RegisterMessage(SubscribeHomeAssistantStateResponse)
 
-LightStateResponse = _reflection.GeneratedProtocolMessageType(
-    "LightStateResponse",
+HomeAssistantStateResponse = _reflection.GeneratedProtocolMessageType(
+    "HomeAssistantStateResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_LIGHTSTATERESPONSE,
+        DESCRIPTOR=_HOMEASSISTANTSTATERESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:LightStateResponse)
+        # @@protoc_insertion_point(class_scope:HomeAssistantStateResponse)
     ),
 )
-_sym_db.RegisterMessage(LightStateResponse)
+_sym_db.RegisterMessage(HomeAssistantStateResponse)
 
-SensorStateResponse = _reflection.GeneratedProtocolMessageType(
-    "SensorStateResponse",
+GetTimeRequest = _reflection.GeneratedProtocolMessageType(
+    "GetTimeRequest",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_SENSORSTATERESPONSE,
+        DESCRIPTOR=_GETTIMEREQUEST,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:SensorStateResponse)
+        # @@protoc_insertion_point(class_scope:GetTimeRequest)
     ),
 )
-_sym_db.RegisterMessage(SensorStateResponse)
+_sym_db.RegisterMessage(GetTimeRequest)
 
-SwitchStateResponse = _reflection.GeneratedProtocolMessageType(
-    "SwitchStateResponse",
+GetTimeResponse = _reflection.GeneratedProtocolMessageType(
+    "GetTimeResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_SWITCHSTATERESPONSE,
+        DESCRIPTOR=_GETTIMERESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:SwitchStateResponse)
+        # @@protoc_insertion_point(class_scope:GetTimeResponse)
     ),
 )
-_sym_db.RegisterMessage(SwitchStateResponse)
+_sym_db.RegisterMessage(GetTimeResponse)
 
-TextSensorStateResponse = _reflection.GeneratedProtocolMessageType(
-    "TextSensorStateResponse",
+ListEntitiesServicesArgument = _reflection.GeneratedProtocolMessageType(
+    "ListEntitiesServicesArgument",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_TEXTSENSORSTATERESPONSE,
+        DESCRIPTOR=_LISTENTITIESSERVICESARGUMENT,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:TextSensorStateResponse)
+        # @@protoc_insertion_point(class_scope:ListEntitiesServicesArgument)
     ),
 )
-_sym_db.RegisterMessage(TextSensorStateResponse)
+_sym_db.RegisterMessage(ListEntitiesServicesArgument)
 
-CoverCommandRequest = _reflection.GeneratedProtocolMessageType(
-    "CoverCommandRequest",
+ListEntitiesServicesResponse = _reflection.GeneratedProtocolMessageType(
+    "ListEntitiesServicesResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_COVERCOMMANDREQUEST,
+        DESCRIPTOR=_LISTENTITIESSERVICESRESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:CoverCommandRequest)
+        # @@protoc_insertion_point(class_scope:ListEntitiesServicesResponse)
     ),
 )
-_sym_db.RegisterMessage(CoverCommandRequest)
+_sym_db.RegisterMessage(ListEntitiesServicesResponse)
 
-FanCommandRequest = _reflection.GeneratedProtocolMessageType(
-    "FanCommandRequest",
+ExecuteServiceArgument = _reflection.GeneratedProtocolMessageType(
+    "ExecuteServiceArgument",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_FANCOMMANDREQUEST,
+        DESCRIPTOR=_EXECUTESERVICEARGUMENT,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:FanCommandRequest)
+        # @@protoc_insertion_point(class_scope:ExecuteServiceArgument)
     ),
 )
-_sym_db.RegisterMessage(FanCommandRequest)
+_sym_db.RegisterMessage(ExecuteServiceArgument)
 
-LightCommandRequest = _reflection.GeneratedProtocolMessageType(
-    "LightCommandRequest",
+ExecuteServiceRequest = _reflection.GeneratedProtocolMessageType(
+    "ExecuteServiceRequest",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_LIGHTCOMMANDREQUEST,
+        DESCRIPTOR=_EXECUTESERVICEREQUEST,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:LightCommandRequest)
+        # @@protoc_insertion_point(class_scope:ExecuteServiceRequest)
     ),
 )
-_sym_db.RegisterMessage(LightCommandRequest)
+_sym_db.RegisterMessage(ExecuteServiceRequest)
 
-SwitchCommandRequest = _reflection.GeneratedProtocolMessageType(
-    "SwitchCommandRequest",
+ListEntitiesCameraResponse = _reflection.GeneratedProtocolMessageType(
+    "ListEntitiesCameraResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_SWITCHCOMMANDREQUEST,
+        DESCRIPTOR=_LISTENTITIESCAMERARESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:SwitchCommandRequest)
+        # @@protoc_insertion_point(class_scope:ListEntitiesCameraResponse)
     ),
 )
-_sym_db.RegisterMessage(SwitchCommandRequest)
+_sym_db.RegisterMessage(ListEntitiesCameraResponse)
 
-SubscribeLogsRequest = _reflection.GeneratedProtocolMessageType(
-    "SubscribeLogsRequest",
+CameraImageResponse = _reflection.GeneratedProtocolMessageType(
+    "CameraImageResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_SUBSCRIBELOGSREQUEST,
+        DESCRIPTOR=_CAMERAIMAGERESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:SubscribeLogsRequest)
+        # @@protoc_insertion_point(class_scope:CameraImageResponse)
     ),
 )
-_sym_db.RegisterMessage(SubscribeLogsRequest)
+_sym_db.RegisterMessage(CameraImageResponse)
 
-SubscribeLogsResponse = _reflection.GeneratedProtocolMessageType(
-    "SubscribeLogsResponse",
+CameraImageRequest = _reflection.GeneratedProtocolMessageType(
+    "CameraImageRequest",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_SUBSCRIBELOGSRESPONSE,
+        DESCRIPTOR=_CAMERAIMAGEREQUEST,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:SubscribeLogsResponse)
+        # @@protoc_insertion_point(class_scope:CameraImageRequest)
     ),
 )
-_sym_db.RegisterMessage(SubscribeLogsResponse)
+_sym_db.RegisterMessage(CameraImageRequest)
 
-SubscribeServiceCallsRequest = _reflection.GeneratedProtocolMessageType(
-    "SubscribeServiceCallsRequest",
+ListEntitiesClimateResponse = _reflection.GeneratedProtocolMessageType(
+    "ListEntitiesClimateResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_SUBSCRIBESERVICECALLSREQUEST,
+        DESCRIPTOR=_LISTENTITIESCLIMATERESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:SubscribeServiceCallsRequest)
+        # @@protoc_insertion_point(class_scope:ListEntitiesClimateResponse)
     ),
 )
-_sym_db.RegisterMessage(SubscribeServiceCallsRequest)
+_sym_db.RegisterMessage(ListEntitiesClimateResponse)
 
-ServiceCallResponse = _reflection.GeneratedProtocolMessageType(
-    "ServiceCallResponse",
+ClimateStateResponse = _reflection.GeneratedProtocolMessageType(
+    "ClimateStateResponse",
     (_message.Message,),
     dict(
-        DataEntry=_reflection.GeneratedProtocolMessageType(
-            "DataEntry",
-            (_message.Message,),
-            dict(
-                DESCRIPTOR=_SERVICECALLRESPONSE_DATAENTRY,
-                __module__="api_pb2"
-                # @@protoc_insertion_point(class_scope:ServiceCallResponse.DataEntry)
-            ),
-        ),
-        DataTemplateEntry=_reflection.GeneratedProtocolMessageType(
-            "DataTemplateEntry",
-            (_message.Message,),
-            dict(
-                DESCRIPTOR=_SERVICECALLRESPONSE_DATATEMPLATEENTRY,
-                __module__="api_pb2"
-                # @@protoc_insertion_point(class_scope:ServiceCallResponse.DataTemplateEntry)
-            ),
-        ),
-        VariablesEntry=_reflection.GeneratedProtocolMessageType(
-            "VariablesEntry",
-            (_message.Message,),
-            dict(
-                DESCRIPTOR=_SERVICECALLRESPONSE_VARIABLESENTRY,
-                __module__="api_pb2"
-                # @@protoc_insertion_point(class_scope:ServiceCallResponse.VariablesEntry)
-            ),
-        ),
-        DESCRIPTOR=_SERVICECALLRESPONSE,
+        DESCRIPTOR=_CLIMATESTATERESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:ServiceCallResponse)
+        # @@protoc_insertion_point(class_scope:ClimateStateResponse)
     ),
 )
-_sym_db.RegisterMessage(ServiceCallResponse)
-_sym_db.RegisterMessage(ServiceCallResponse.DataEntry)
-_sym_db.RegisterMessage(ServiceCallResponse.DataTemplateEntry)
-_sym_db.RegisterMessage(ServiceCallResponse.VariablesEntry)
+_sym_db.RegisterMessage(ClimateStateResponse)
 
-SubscribeHomeAssistantStatesRequest = _reflection.GeneratedProtocolMessageType(
-    "SubscribeHomeAssistantStatesRequest",
+ClimateCommandRequest = _reflection.GeneratedProtocolMessageType(
+    "ClimateCommandRequest",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_SUBSCRIBEHOMEASSISTANTSTATESREQUEST,
+        DESCRIPTOR=_CLIMATECOMMANDREQUEST,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:SubscribeHomeAssistantStatesRequest)
+        # @@protoc_insertion_point(class_scope:ClimateCommandRequest)
     ),
 )
-_sym_db.RegisterMessage(SubscribeHomeAssistantStatesRequest)
+_sym_db.RegisterMessage(ClimateCommandRequest)
 
-SubscribeHomeAssistantStateResponse = _reflection.GeneratedProtocolMessageType(
-    "SubscribeHomeAssistantStateResponse",
+ProfilerStatsRequest = _reflection.GeneratedProtocolMessageType(
+    "ProfilerStatsRequest",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_SUBSCRIBEHOMEASSISTANTSTATERESPONSE,
+        DESCRIPTOR=_PROFILERSTATSREQUEST,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:SubscribeHomeAssistantStateResponse)
+        # @@protoc_insertion_point(class_scope:ProfilerStatsRequest)
     ),
 )
-_sym_db.RegisterMessage(SubscribeHomeAssistantStateResponse)
+_sym_db.RegisterMessage(ProfilerStatsRequest)
 
-HomeAssistantStateResponse = _reflection.GeneratedProtocolMessageType(
-    "HomeAssistantStateResponse",
+ProfilerTimingStats = _reflection.GeneratedProtocolMessageType(
+    "ProfilerTimingStats",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_HOMEASSISTANTSTATERESPONSE,
+        DESCRIPTOR=_PROFILERTIMINGSTATS,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:HomeAssistantStateResponse)
+        # @@protoc_insertion_point(class_scope:ProfilerTimingStats)
     ),
 )
-_sym_db.RegisterMessage(HomeAssistantStateResponse)
+_sym_db.RegisterMessage(ProfilerTimingStats)
 
-GetTimeRequest = _reflection.GeneratedProtocolMessageType(
-    "GetTimeRequest",
+ProfilerStatsResponse = _reflection.GeneratedProtocolMessageType(
+    "ProfilerStatsResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_GETTIMEREQUEST,
+        DESCRIPTOR=_PROFILERSTATSRESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:GetTimeRequest)
+        # @@protoc_insertion_point(class_scope:ProfilerStatsResponse)
     ),
 )
-_sym_db.RegisterMessage(GetTimeRequest)
+_sym_db.RegisterMessage(ProfilerStatsResponse)
 
-GetTimeResponse = _reflection.GeneratedProtocolMessageType(
-    "GetTimeResponse",
+ProfilerStatsDoneResponse = _reflection.GeneratedProtocolMessageType(
+    "ProfilerStatsDoneResponse",
     (_message.Message,),
     dict(
-        DESCRIPTOR=_GETTIMERESPONSE,
+        DESCRIPTOR=_PROFILERSTATSDONERESPONSE,
         __module__="api_pb2"
-        # @@protoc_insertion_point(class_scope:GetTimeResponse)
+        # @@protoc_insertion_point(class_scope:ProfilerStatsDoneResponse)
     ),
 )
-_sym_db.RegisterMessage(GetTimeResponse)
+_sym_db.RegisterMessage(ProfilerStatsDoneResponse)
 
 
-_SERVICECALLRESPONSE_DATAENTRY._options = None
-_SERVICECALLRESPONSE_DATATEMPLATEENTRY._options = None
-_SERVICECALLRESPONSE_VARIABLESENTRY._options = None
 # @@protoc_insertion_point(module_scope)
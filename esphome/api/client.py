@@ -9,9 +9,9 @@ import time
 from typing import Optional  # noqa
 from google.protobuf import message  # noqa
 
-from esphome import const
+from esphome import binary_log, const
 import esphome.api.api_pb2 as pb
-from esphome.const import CONF_PASSWORD, CONF_PORT
+from esphome.const import CONF_BINARY_LOGS, CONF_LOGGER, CONF_PASSWORD, CONF_PORT
 from esphome.core import EsphomeError
 from esphome.helpers import resolve_ip_address, indent
 from esphome.log import color, Fore
@@ -58,10 +58,25 @@ MESSAGE_TYPE_TO_PROTO = {
     31: pb.FanCommandRequest,
     32: pb.LightCommandRequest,
     33: pb.SwitchCommandRequest,
-    34: pb.SubscribeServiceCallsRequest,
-    35: pb.ServiceCallResponse,
+    34: pb.SubscribeHomeassistantServicesRequest,
+    35: pb.HomeassistantServiceResponse,
     36: pb.GetTimeRequest,
     37: pb.GetTimeResponse,
+    38: pb.SubscribeHomeAssistantStatesRequest,
+    39: pb.SubscribeHomeAssistantStateResponse,
+    40: pb.HomeAssistantStateResponse,
+    41: pb.ListEntitiesServicesResponse,
+    42: pb.ExecuteServiceRequest,
+    43: pb.ListEntitiesCameraResponse,
+    44: pb.CameraImageResponse,
+    45: pb.CameraImageRequest,
+    46: pb.ListEntitiesClimateResponse,
+    47: pb.ClimateStateResponse,
+    48: pb.ClimateCommandRequest,
+    49: pb.ProfilerStatsRequest,
+    50: pb.ProfilerStatsResponse,
+    51: pb.ProfilerStatsDoneResponse,
+    52: pb.SubscribeLogsBinaryResponse,
 }
 
 
@@ -339,15 +354,17 @@ class APIClient(threading.Thread):
         if not self._authenticated:
             raise APIConnectionError("Must login first!")
 
-    def subscribe_logs(self, on_log, log_level=7, dump_config=False):
+    def subscribe_logs(self, on_log, log_level=7, dump_config=False, binary=False):
         self._check_authenticated()
 
         def on_msg(msg):
-            if isinstance(msg, pb.SubscribeLogsResponse):
+            if isinstance(
+                msg, (pb.SubscribeLogsResponse, pb.SubscribeLogsBinaryResponse)
+            ):
                 on_log(msg)
 
         self._message_handlers.append(on_msg)
-        req = pb.SubscribeLogsRequest(dump_config=dump_config)
+        req = pb.SubscribeLogsRequest(dump_config=dump_config, binary=binary)
         req.level = log_level
         self._send_message(req)
 
@@ -484,8 +501,22 @@ def run_logs(config, address):
         timer.start()
         retry_timer.append(timer)
 
+    decoder = None
+    if config[CONF_LOGGER].get(CONF_BINARY_LOGS):
+        table = binary_log.load_string_table(binary_log.string_table_path())
+        if table is None:
+            _LOGGER.warning(
+                "No log string table found, compile the firmware to use binary logs. "
+                "Falling back to text logs"
+            )
+        else:
+            decoder = binary_log.BinaryLogDecoder(table)
+
     def on_log(msg):
         time_ = datetime.now().time().strftime("[%H:%M:%S]")
+        if isinstance(msg, pb.SubscribeLogsBinaryResponse):
+            safe_print(time_ + decoder.decode(msg.level, msg.tag, msg.data))
+            return
         text = msg.message
         if msg.send_failed:
             text = color(
@@ -497,7 +528,9 @@ def run_logs(config, address):
 
     def on_login():
         try:
-            cli.subscribe_logs(on_log, dump_config=not has_connects)
+            cli.subscribe_logs(
+                on_log, dump_config=not has_connects, binary=decoder is not None
+            )
             has_connects.append(True)
         except APIConnectionError:
             cli.disconnect()
@@ -0,0 +1,313 @@
+"""Binary (deferred formatting) logs.
+
+With ``logger: binary_logs: true`` the device can send log messages to API clients as the ID of the
+format string followed by the raw arguments instead of the formatted text (see
+esphome/components/logger/binary_log.h for the encoding). The format strings are collected from the
+sources when the firmware is compiled and stored in a string table in the build directory, which is
+used to turn the messages back into text.
+
+Only formats that are written as string literals at the log call can be found this way. Formats
+built with macros (like LOG_SECRET or ESPHOME_VERSION) and messages from ESP-IDF aren't in the
+table. The IDs of the table are compiled into the firmware (binary_log_formats.cpp), and the device
+sends all other messages as text.
+"""
+import json
+import logging
+import os
+import re
+import struct
+
+from esphome.const import SOURCE_FILE_EXTENSIONS
+from esphome.core import CORE
+from esphome.helpers import read_file, walk_files, write_file_if_changed
+
+_LOGGER = logging.getLogger(__name__)
+
+STRING_TABLE_FILENAME = "log_strings.json"
+STRING_TABLE_VERSION = 1
+FORMAT_IDS_FILENAME = "binary_log_formats.cpp"
+FORMAT_IDS_CPP_FORMAT = """\
+// Auto-generated by esphome from the log format strings in the sources, do not edit.
+#include "esphome/components/logger/binary_log.h"
+#include "esphome/core/esphal.h"
+
+namespace esphome {{
+namespace logger {{
+
+const uint32_t BINARY_LOG_FORMAT_IDS[] PROGMEM = {{{}}};
+const size_t BINARY_LOG_FORMAT_COUNT = {};
+
+}}  // namespace logger
+}}  // namespace esphome
+"""
+
+# ESP_LOGx(tag, "format" "continued", ...) - only formats consisting of nothing but string literals
+FORMAT_RE = re.compile(
+    r'\bESP_LOG[A-Z]*\s*\(\s*[^,()"]+,\s*((?:"(?:[^"\\\n]|\\.)*"\s*)+)(?=[,)])'
+)
+STRING_LITERAL_RE = re.compile(r'"((?:[^"\\\n]|\\.)*)"')
+CONVERSION_RE = re.compile(
+    r"%(?P<flags>[-+ #0]*)(?P<width>\*|\d+)?(?:\.(?P<precision>\*|\d*))?"
+    r"(?P<length>hh|h|ll|l|j|z|t|L)?(?P<conversion>[diouxXeEfFgGaAcspn%])"
+)
+SIMPLE_ESCAPES = {
+    "n": "\n",
+    "t": "\t",
+    "r": "\r",
+    "a": "\a",
+    "b": "\b",
+    "f": "\f",
+    "v": "\v",
+    "\\": "\\",
+    "'": "'",
+    '"': '"',
+    "?": "?",
+}
+
+LOG_LEVEL_COLORS = [
+    "",  # NONE
+    "\033[1;31m",  # ERROR
+    "\033[0;33m",  # WARNING
+    "\033[0;32m",  # INFO
+    "\033[0;35m",  # CONFIG
+    "\033[0;36m",  # DEBUG
+    "\033[0;37m",  # VERBOSE
+    "\033[0;38m",  # VERY_VERBOSE
+]
+LOG_LEVEL_LETTERS = ["", "E", "W", "I", "C", "D", "V", "VV"]
+LOG_RESET_COLOR = "\033[0m"
+
+
+def fnv1_hash(data: bytes) -> int:
+    """32-bit FNV-1 hash, same as binary_log_format_id() on the device."""
+    hash_ = 2166136261
+    for byte in data:
+        hash_ = (hash_ * 16777619) & 0xFFFFFFFF
+        hash_ ^= byte
+    return hash_
+
+
+def unescape_c_string(text: str) -> bytes:
+    """Get the bytes of the contents of a C string literal."""
+    out = bytearray()
+    i = 0
+    while i < len(text):
+        char = text[i]
+        i += 1
+        if char != "\\":
+            out += char.encode("utf-8")
+            continue
+        esc = text[i]
+        i += 1
+        if esc in SIMPLE_ESCAPES:
+            out += SIMPLE_ESCAPES[esc].encode("utf-8")
+        elif esc in "01234567":
+            end = i
+            while end < len(text) and end < i + 2 and text[end] in "01234567":
+                end += 1
+            out.append(int(text[i - 1 : end], 8) & 0xFF)
+            i = end
+        elif esc == "x":
+            end = i
+            while end < len(text) and text[end] in "0123456789abcdefABCDEF":
+                end += 1
+            out.append(int(text[i:end], 16) & 0xFF)
+            i = end
+        else:
+            out += esc.encode("utf-8")
+    return bytes(out)
+
+
+def extract_format_strings(text):
+    """Find the format strings of all log calls in C++ source code."""
+    formats = []
+    for match in FORMAT_RE.finditer(text):
+        literals = STRING_LITERAL_RE.findall(match.group(1))
+        formats.append(b"".join(unescape_c_string(lit) for lit in literals))
+    return formats
+
+
+def generate_string_table(texts):
+    """Map format IDs to format strings for all log calls in the given source texts."""
+    table = {}
+    for text in texts:
+        for fmt in extract_format_strings(text):
+            format_id = fnv1_hash(fmt)
+            existing = table.get(format_id)
+            if existing is not None and existing != fmt:
+                _LOGGER.warning(
+                    "Log format strings %r and %r have the same ID, binary logs may "
+                    "show the wrong text for them",
+                    existing,
+                    fmt,
+                )
+                continue
+            table[format_id] = fmt
+    return table
+
+
+def string_table_path():
+    return CORE.relative_build_path(STRING_TABLE_FILENAME)
+
+
+def generate_format_ids_cpp(table):
+    """Get the source of the sorted format ID array that is compiled into the firmware."""
+    ids = sorted(table)
+    # an array can't be empty
+    values = ", ".join(f"0x{format_id:08X}" for format_id in ids) or "0"
+    return FORMAT_IDS_CPP_FORMAT.format(values, len(ids))
+
+
+def format_ids_path():
+    return CORE.relative_src_path(FORMAT_IDS_FILENAME)
+
+
+def write_string_table():
+    """Write the string table for the sources in the build directory, and its IDs for the firmware."""
+    texts = []
+    for path in walk_files(CORE.relative_src_path()):
+        if os.path.splitext(path)[1] in SOURCE_FILE_EXTENSIONS:
+            texts.append(read_file(path))
+    table = generate_string_table(texts)
+    content = {
+        "version": STRING_TABLE_VERSION,
+        "formats": {
+            f"{format_id:08x}": fmt.decode("utf-8", "replace")
+            for format_id, fmt in sorted(table.items())
+        },
+    }
+    write_file_if_changed(string_table_path(), json.dumps(content, indent=1) + "\n")
+    write_file_if_changed(format_ids_path(), generate_format_ids_cpp(table))
+
+
+def remove_format_ids():
+    """Remove the format IDs from the sources when binary logging is disabled."""
+    path = format_ids_path()
+    if os.path.isfile(path):
+        os.remove(path)
+
+
+def load_string_table(path):
+    """Load a string table written by write_string_table(), None if there is none."""
+    if not os.path.isfile(path):
+        return None
+    content = json.loads(read_file(path))
+    if content.get("version") != STRING_TABLE_VERSION:
+        return None
+    return {int(key, 16): fmt for key, fmt in content["formats"].items()}
+
+
+class _Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def varint(self):
+        result = 0
+        shift = 0
+        while True:
+            byte = self.data[self.pos]
+            self.pos += 1
+            result |= (byte & 0x7F) << shift
+            shift += 7
+            if not byte & 0x80:
+                return result
+
+    def signed(self):
+        value = self.varint()
+        return (value >> 1) ^ -(value & 1)
+
+    def float(self):
+        (value,) = struct.unpack_from("<f", self.data, self.pos)
+        self.pos += 4
+        return value
+
+    def bytes(self, length):
+        if self.pos + length > len(self.data):
+            raise IndexError
+        value = self.data[self.pos : self.pos + length]
+        self.pos += length
+        return value
+
+
+def _format_conversion(match, reader):
+    conversion = match.group("conversion")
+    if conversion == "%":
+        return "%"
+    flags = match.group("flags")
+    width = match.group("width") or ""
+    precision = match.group("precision")
+    if width == "*":
+        width = reader.signed()
+        if width < 0:
+            flags += "-"
+            width = -width
+    if precision == "*":
+        precision = reader.signed()
+        # a negative precision is taken as if it was omitted
+        precision = None if precision < 0 else str(precision)
+    spec = f"%{flags}{width}" + (f".{precision or 0}" if precision is not None else "")
+
+    if conversion in "di":
+        return (spec + "d") % reader.signed()
+    if conversion == "u":
+        return (spec + "d") % reader.varint()
+    if conversion in "oxX":
+        return (spec + conversion) % reader.varint()
+    if conversion == "c":
+        return (spec + "c") % chr(reader.varint())
+    if conversion == "p":
+        return (spec.replace("#", "") + "s") % hex(reader.varint())
+    if conversion in "aA":
+        value = reader.float().hex()
+        return (spec + "s") % (value.upper() if conversion == "A" else value)
+    if conversion in "eEfFgG":
+        return (spec + conversion) % reader.float()
+    if conversion == "s":
+        value = reader.bytes(reader.varint()).decode("utf-8", "replace")
+        # the device only sent the characters that are printed
+        return (spec.split(".")[0] + "s") % value
+    return ""
+
+
+class BinaryLogDecoder:
+    def __init__(self, table):
+        self._table = table
+
+    def format_message(self, data):
+        """Reconstruct the text of a message, returns (line, text)."""
+        reader = _Reader(data)
+        format_id = reader.varint()
+        line = reader.varint()
+        fmt = self._table.get(format_id)
+        if fmt is None:
+            return (
+                line,
+                f"<unknown log format {format_id:08x}, recompile to update the string table>",
+            )
+
+        parts = []
+        last = 0
+        for match in CONVERSION_RE.finditer(fmt):
+            parts.append(fmt[last : match.start()])
+            last = match.end()
+            try:
+                parts.append(_format_conversion(match, reader))
+            except (IndexError, struct.error):
+                parts.append("<truncated>")
+                last = len(fmt)
+                break
+        parts.append(fmt[last:])
+        text = "".join(parts)
+        if text.endswith("\n"):
+            text = text[:-1]
+        return line, text
+
+    def decode(self, level, tag, data):
+        """Get the message as the device would have logged it in text form."""
+        line, text = self.format_message(data)
+        level = max(0, min(level, 7))
+        return (
+            f"{LOG_LEVEL_COLORS[level]}[{LOG_LEVEL_LETTERS[level]}][{tag}:{line:03}]: "
+            f"{text}{LOG_RESET_COLOR}"
+        )
@@ -25,6 +25,9 @@ ANIMATION_SCHEMA = cv.Schema(
         cv.Optional(CONF_TYPE, default="BINARY"): cv.enum(
             espImage.IMAGE_TYPE, upper=True
         ),
+        cv.Optional(espImage.CONF_COMPRESSION, default="NONE"): cv.enum(
+            espImage.IMAGE_COMPRESSION, upper=True
+        ),
         cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
     }
 )
@@ -81,6 +84,12 @@ def to_code(config):
                 data[pos] = pix[2]
                 pos += 1
 
+    elif config[CONF_TYPE] == "RGB565":
+        data = []
+        for frameIndex in range(frames):
+            image.seek(frameIndex)
+            data += espImage.encode_rgb565(image, False)
+
     elif config[CONF_TYPE] == "BINARY":
         width8 = ((width + 7) // 8) * 8
         data = [0 for _ in range((height * width8 // 8) * frames)]
@@ -94,6 +103,29 @@ def to_code(config):
                     pos = x + y * width8 + (height * width8 * frameIndex)
                     data[pos // 8] |= 0x80 >> (pos % 8)
 
+    compression = config[espImage.CONF_COMPRESSION]
+    if compression == "RLE":
+        # every frame is compressed on its own, the data starts with their offsets
+        frame_size = len(data) // frames
+        size = espImage.element_size(config[CONF_TYPE])
+        compressed = []
+        offsets = []
+        for frame_index in range(frames):
+            offsets.append(4 * frames + len(compressed))
+            frame = data[frame_index * frame_size : (frame_index + 1) * frame_size]
+            compressed += espImage.compress_rle(frame, size)
+        compressed = [
+            (offset >> shift) & 0xFF for offset in offsets for shift in (0, 8, 16, 24)
+        ] + compressed
+        if len(compressed) < len(data):
+            data = compressed
+        else:
+            _LOGGER.info(
+                "Compressing animation %s doesn't save space, storing it uncompressed",
+                config[CONF_ID],
+            )
+            compression = "NONE"
+
     rhs = [HexInt(x) for x in data]
     prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
     cg.new_Pvariable(
@@ -103,4 +135,5 @@ def to_code(config):
         height,
         frames,
         espImage.IMAGE_TYPE[config[CONF_TYPE]],
+        espImage.IMAGE_COMPRESSION[compression],
     )
@@ -42,6 +42,9 @@ SERVICE_ARG_NATIVE_TYPES = {
     "string[]": cg.std_vector.template(cg.std_string),
 }
 
+CONF_BATCH_DELAY = "batch_delay"
+CONF_BATCH_SIZE = "batch_size"
+
 CONFIG_SCHEMA = cv.Schema(
     {
         cv.GenerateID(): cv.declare_id(APIServer),
@@ -50,6 +53,10 @@ CONFIG_SCHEMA = cv.Schema(
         cv.Optional(
             CONF_REBOOT_TIMEOUT, default="15min"
         ): cv.positive_time_period_milliseconds,
+        cv.Optional(
+            CONF_BATCH_DELAY, default="0ms"
+        ): cv.positive_time_period_milliseconds,
+        cv.Optional(CONF_BATCH_SIZE, default=1024): cv.int_range(min=64, max=4096),
         cv.Optional(CONF_SERVICES): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(UserServiceTrigger),
@@ -75,6 +82,8 @@ def to_code(config):
     cg.add(var.set_port(config[CONF_PORT]))
     cg.add(var.set_password(config[CONF_PASSWORD]))
     cg.add(var.set_reboot_timeout(config[CONF_REBOOT_TIMEOUT]))
+    cg.add(var.set_batch_delay(config[CONF_BATCH_DELAY]))
+    cg.add(var.set_batch_size(config[CONF_BATCH_SIZE]))
 
     for conf in config.get(CONF_SERVICES, []):
         template_args = []
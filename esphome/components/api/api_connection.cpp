@@ -13,6 +13,8 @@
 #include "esphome/components/fan/fan_helpers.h"
 #endif
 
+#include <algorithm>
+
 namespace esphome {
 namespace api {
 
@@ -29,7 +31,6 @@ APIConnection::APIConnection(AsyncClient *client, APIServer *parent)
                         this);
 
   this->send_buffer_.reserve(64);
-  this->recv_buffer_.reserve(32);
   this->client_info_ = this->client_->remoteIP().toString().c_str();
   this->last_traffic_ = millis();
 }
@@ -40,51 +41,72 @@ void APIConnection::on_timeout_(uint32_t time) { this->on_fatal_error(); }
 void APIConnection::on_data_(uint8_t *buf, size_t len) {
   if (len == 0 || buf == nullptr)
     return;
-  this->recv_buffer_.insert(this->recv_buffer_.end(), buf, buf + len);
+  if (!this->recv_buffer_.push(buf, len))
+    // handled in loop(), this runs in the context of the TCP stack
+    this->recv_overflow_ = true;
 }
 void APIConnection::parse_recv_buffer_() {
+  if (this->recv_overflow_) {
+    ESP_LOGW(TAG, "Receive buffer of %s overflowed", this->client_info_.c_str());
+    this->on_fatal_error();
+    return;
+  }
   if (this->recv_buffer_.empty() || this->remove_)
     return;
 
   while (!this->recv_buffer_.empty()) {
-    if (this->recv_buffer_[0] != 0x00) {
+    // preamble + size varint + type varint
+    uint8_t header[1 + 10 + 10];
+    const uint32_t header_size = this->recv_buffer_.peek(header, 0, sizeof(header));
+    if (header[0] != 0x00) {
       ESP_LOGW(TAG, "Invalid preamble from %s", this->client_info_.c_str());
       this->on_fatal_error();
       return;
     }
     uint32_t i = 1;
-    const uint32_t size = this->recv_buffer_.size();
     uint32_t consumed;
-    auto msg_size_varint = ProtoVarInt::parse(&this->recv_buffer_[i], size - i, &consumed);
-    if (!msg_size_varint.has_value())
+    auto msg_size_varint = ProtoVarInt::parse(&header[i], header_size - i, &consumed);
+    optional<ProtoVarInt> msg_type_varint;
+    if (msg_size_varint.has_value()) {
+      i += consumed;
+      msg_type_varint = ProtoVarInt::parse(&header[i], header_size - i, &consumed);
+    }
+    if (!msg_type_varint.has_value()) {
+      if (header_size == sizeof(header)) {
+        // a valid header always fits
+        ESP_LOGW(TAG, "Invalid message header from %s", this->client_info_.c_str());
+        this->on_fatal_error();
+      }
       // not enough data there yet
       return;
+    }
     i += consumed;
     uint32_t msg_size = msg_size_varint->as_uint32();
-
-    auto msg_type_varint = ProtoVarInt::parse(&this->recv_buffer_[i], size - i, &consumed);
-    if (!msg_type_varint.has_value())
-      // not enough data there yet
-      return;
-    i += consumed;
     uint32_t msg_type = msg_type_varint->as_uint32();
 
-    if (size - i < msg_size)
+    // i is at most sizeof(header), compared this way a huge size can't wrap around
+    if (msg_size > API_MAX_RECV_BUFFER_SIZE - i) {
+      ESP_LOGW(TAG, "Message from %s is too large (%u bytes)", this->client_info_.c_str(), msg_size);
+      this->on_fatal_error();
+      return;
+    }
+    if (this->recv_buffer_.size() - i < msg_size)
       // message body not fully received
       return;
 
-    uint8_t *msg = &this->recv_buffer_[i];
+    // decoded in place, unless the message wraps around the end of the ring buffer
+    uint8_t *msg = this->recv_buffer_.view(i, msg_size, this->recv_scratch_);
     this->read_message(msg_size, msg_type, msg);
     if (this->remove_)
       return;
-    // pop front
-    uint32_t total = i + msg_size;
-    this->recv_buffer_.erase(this->recv_buffer_.begin(), this->recv_buffer_.begin() + total);
+    this->recv_buffer_.consume(i + msg_size);
     this->last_traffic_ = millis();
   }
 }
 
 void APIConnection::disconnect_client() {
+  // send what's still queued before a graceful close, the server logs anything that's left
+  this->flush_batch_();
   this->client_->close();
   this->remove_ = true;
 }
@@ -113,6 +135,11 @@ void APIConnection::loop() {
 
   this->list_entities_iterator_.advance();
   this->initial_state_iterator_.advance();
+#ifdef USE_COMPONENT_PROFILER
+  this->advance_profiler_stats_();
+#endif
+  if (!this->batch_buffer_.empty() && millis() - this->batch_start_ >= this->parent_->get_batch_delay())
+    this->flush_batch_();
 
   const uint32_t keepalive = 60000;
   if (this->sent_ping_) {
@@ -132,7 +159,7 @@ void APIConnection::loop() {
     // reserve 15 bytes for metadata, and at least 64 bytes of data
     if (space >= 15 + 64) {
       uint32_t to_send = std::min(space - 15, this->image_reader_.available());
-      auto buffer = this->create_buffer();
+      auto buffer = this->create_buffer(15 + to_send);
       // fixed32 key = 1;
       buffer.encode_fixed32(1, esp32_camera::global_esp32_camera->get_object_id_hash());
       // bytes data = 2;
@@ -153,6 +180,41 @@ void APIConnection::loop() {
 #endif
 }
 
+#ifdef USE_COMPONENT_PROFILER
+static void fill_profiler_timing_stats(ProfilerTimingStats &out, const TimingStats &stats) {
+  out.count = stats.get_count();
+  out.min_us = stats.get_min();
+  out.avg_us = stats.get_average();
+  out.max_us = stats.get_max();
+  out.p99_us = stats.get_percentile(99.0f);
+}
+void APIConnection::advance_profiler_stats_() {
+  if (this->profiler_index_ < 0)
+    return;
+  const auto &components = App.get_components();
+  // Send one message per component, continue in the next loop() if the send buffer is full
+  while (this->profiler_index_ < static_cast<int32_t>(components.size())) {
+    Component *component = components[this->profiler_index_];
+    const ComponentProfile &profile = component->get_profile();
+    ProfilerStatsResponse resp;
+    resp.source = component->get_component_source();
+    fill_profiler_timing_stats(resp.loop, profile.loop);
+    fill_profiler_timing_stats(resp.update, profile.update);
+    fill_profiler_timing_stats(resp.scheduler, profile.scheduler);
+    if (!this->send_profiler_stats_response(resp))
+      return;
+    this->profiler_index_++;
+  }
+  if (!this->send_profiler_stats_done_response(ProfilerStatsDoneResponse()))
+    return;
+  if (this->profiler_reset_) {
+    for (auto *component : components)
+      component->get_profile().reset();
+  }
+  this->profiler_index_ = -1;
+}
+#endif
+
 std::string get_default_unique_id(const std::string &component_type, Nameable *nameable) {
   return App.get_name() + component_type + nameable->get_object_id();
 }
@@ -576,17 +638,19 @@ bool APIConnection::send_log_message(int level, const char *tag, const char *lin
     return false;
 
   // Send raw so that we don't copy too much
-  auto buffer = this->create_buffer();
+  const size_t line_len = strlen(line);
+  // level field (2 bytes) + message tag and length (at most 6 bytes)
+  auto buffer = this->create_buffer(line_len + 8);
   // LogLevel level = 1;
   buffer.encode_uint32(1, static_cast<uint32_t>(level));
   // string tag = 2;
   // buffer.encode_string(2, tag, strlen(tag));
   // string message = 3;
-  buffer.encode_string(3, line, strlen(line));
+  buffer.encode_string(3, line, line_len);
   // SubscribeLogsResponse - 29
   bool success = this->send_buffer(buffer, 29);
   if (!success) {
-    buffer = this->create_buffer();
+    buffer = this->create_buffer(2);
     // bool send_failed = 4;
     buffer.encode_bool(4, true);
     return this->send_buffer(buffer, 29);
@@ -595,6 +659,25 @@ bool APIConnection::send_log_message(int level, const char *tag, const char *lin
   }
 }
 
+#ifdef USE_BINARY_LOGGING
+bool APIConnection::send_binary_log_message(int level, const char *tag, const uint8_t *data, size_t len) {
+  if (this->log_subscription_ < level)
+    return false;
+
+  const size_t tag_len = strlen(tag);
+  // level field (2 bytes) + tag and data tags and lengths (at most 6 bytes each)
+  auto buffer = this->create_buffer(tag_len + len + 14);
+  // LogLevel level = 1;
+  buffer.encode_uint32(1, static_cast<uint32_t>(level));
+  // string tag = 2;
+  buffer.encode_string(2, tag, tag_len);
+  // bytes data = 3;
+  buffer.encode_bytes(3, data, len);
+  // SubscribeLogsBinaryResponse - 52
+  return this->send_buffer(buffer, 52);
+}
+#endif
+
 HelloResponse APIConnection::hello(const HelloRequest &msg) {
   this->client_info_ = msg.client_info + " (" + this->client_->remoteIP().toString().c_str();
   this->client_info_ += ")";
@@ -666,16 +749,81 @@ void APIConnection::subscribe_home_assistant_states(const SubscribeHomeAssistant
     }
   }
 }
+/// State updates, these are the bulk of the traffic and are fine to be delayed for a few milliseconds.
+static bool is_batchable_message(uint32_t message_type) {
+  switch (message_type) {
+    case 21:  // BinarySensorStateResponse
+    case 22:  // CoverStateResponse
+    case 23:  // FanStateResponse
+    case 24:  // LightStateResponse
+    case 25:  // SensorStateResponse
+    case 26:  // SwitchStateResponse
+    case 27:  // TextSensorStateResponse
+    case 47:  // ClimateStateResponse
+      return true;
+    default:
+      return false;
+  }
+}
+bool APIConnection::add_to_batch_(const uint8_t *header, size_t header_len, const std::vector<uint8_t> &payload) {
+  const size_t batch_size = this->parent_->get_batch_size();
+  if (!this->batch_buffer_.empty() && this->batch_buffer_.size() + header_len + payload.size() > batch_size) {
+    // doesn't fit anymore, make room first
+    if (!this->flush_batch_())
+      return false;
+  }
+  if (this->batch_buffer_.empty()) {
+    this->batch_start_ = millis();
+    this->batch_buffer_.reserve(batch_size);
+  }
+  this->batch_buffer_.insert(this->batch_buffer_.end(), header, header + header_len);
+  this->batch_buffer_.insert(this->batch_buffer_.end(), payload.begin(), payload.end());
+  this->batch_messages_++;
+  if (this->batch_buffer_.size() >= batch_size)
+    this->flush_batch_();
+  return true;
+}
+bool APIConnection::flush_batch_() {
+  if (this->batch_buffer_.empty())
+    return true;
+
+  if (this->batch_buffer_.size() > this->client_->space()) {
+    delay(0);
+    if (this->batch_buffer_.size() > this->client_->space()) {
+      ESP_LOGV(TAG, "Cannot send batch because of TCP buffer space");
+      return false;
+    }
+  }
+
+  this->client_->add(reinterpret_cast<char *>(this->batch_buffer_.data()), this->batch_buffer_.size(),
+                     ASYNC_WRITE_FLAG_COPY);
+  bool ret = this->client_->send();
+  ESP_LOGVV(TAG, "Sent batch of %u messages (%zu bytes)", this->batch_messages_, this->batch_buffer_.size());
+  this->batch_flushes_++;
+  this->batched_messages_ += this->batch_messages_;
+  this->max_batch_messages_ = std::max(this->max_batch_messages_, this->batch_messages_);
+  this->batch_buffer_.clear();
+  this->batch_messages_ = 0;
+  return ret;
+}
 bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) {
   if (this->remove_)
     return false;
 
-  std::vector<uint8_t> header;
-  header.push_back(0x00);
-  ProtoVarInt(buffer.get_buffer()->size()).encode(header);
-  ProtoVarInt(message_type).encode(header);
+  // preamble + size varint + type varint
+  uint8_t header[1 + 10 + 10];
+  size_t header_len = 0;
+  header[header_len++] = 0x00;
+  header_len += ProtoVarInt(buffer.get_buffer()->size()).encode(header + header_len);
+  header_len += ProtoVarInt(message_type).encode(header + header_len);
+
+  if (this->parent_->get_batch_delay() != 0 && is_batchable_message(message_type))
+    return this->add_to_batch_(header, header_len, *buffer.get_buffer());
+  // other messages must not overtake state updates that are still queued
+  if (!this->flush_batch_())
+    return false;
 
-  size_t needed_space = buffer.get_buffer()->size() + header.size();
+  size_t needed_space = buffer.get_buffer()->size() + header_len;
 
   if (needed_space > this->client_->space()) {
     delay(0);
@@ -689,7 +837,7 @@ bool APIConnection::send_buffer(ProtoWriteBuffer buffer, uint32_t message_type)
     }
   }
 
-  this->client_->add(reinterpret_cast<char *>(header.data()), header.size(),
+  this->client_->add(reinterpret_cast<char *>(header), header_len,
                      ASYNC_WRITE_FLAG_COPY | ASYNC_WRITE_FLAG_MORE);
   this->client_->add(reinterpret_cast<char *>(buffer.get_buffer()->data()), buffer.get_buffer()->size(),
                      ASYNC_WRITE_FLAG_COPY);
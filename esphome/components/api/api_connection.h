@@ -5,10 +5,16 @@
 #include "api_pb2.h"
 #include "api_pb2_service.h"
 #include "api_server.h"
+#include "ring_buffer.h"
 
 namespace esphome {
 namespace api {
 
+/// Initial size of the receive buffer of each connection.
+static const size_t API_RECV_BUFFER_SIZE = 256;
+/// The receive buffer grows up to this size if needed, the client is disconnected if it sends more at once.
+static const size_t API_MAX_RECV_BUFFER_SIZE = 16384;
+
 class APIConnection : public APIServerConnection {
  public:
   APIConnection(AsyncClient *client, APIServer *parent);
@@ -62,8 +68,19 @@ class APIConnection : public APIServerConnection {
   bool send_climate_state(climate::Climate *climate);
   bool send_climate_info(climate::Climate *climate);
   void climate_command(const ClimateCommandRequest &msg) override;
+#endif
+#ifdef USE_COMPONENT_PROFILER
+  void profiler_stats(const ProfilerStatsRequest &msg) override {
+    this->profiler_index_ = 0;
+    this->profiler_reset_ = msg.reset;
+  }
 #endif
   bool send_log_message(int level, const char *tag, const char *line);
+#ifdef USE_BINARY_LOGGING
+  bool send_binary_log_message(int level, const char *tag, const uint8_t *data, size_t len);
+  bool wants_text_logs() const { return this->log_subscription_ > ESPHOME_LOG_LEVEL_NONE && !this->log_binary_; }
+  bool wants_binary_logs() const { return this->log_subscription_ > ESPHOME_LOG_LEVEL_NONE && this->log_binary_; }
+#endif
   void send_homeassistant_service_call(const HomeassistantServiceResponse &call) {
     if (!this->service_call_subscription_)
       return;
@@ -105,6 +122,10 @@ class APIConnection : public APIServerConnection {
   }
   void subscribe_logs(const SubscribeLogsRequest &msg) override {
     this->log_subscription_ = msg.level;
+#ifdef USE_BINARY_LOGGING
+    this->log_binary_ = msg.binary;
+    this->parent_->update_log_requests();
+#endif
     if (msg.dump_config)
       App.schedule_dump_config();
   }
@@ -124,8 +145,9 @@ class APIConnection : public APIServerConnection {
   void on_fatal_error() override;
   void on_unauthenticated_access() override;
   void on_no_setup_connection() override;
-  ProtoWriteBuffer create_buffer() override {
+  ProtoWriteBuffer create_buffer(uint32_t reserve_size) override {
     this->send_buffer_.clear();
+    this->send_buffer_.reserve(reserve_size);
     return {&this->send_buffer_};
   }
   bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) override;
@@ -138,6 +160,13 @@ class APIConnection : public APIServerConnection {
   void on_timeout_(uint32_t time);
   void on_data_(uint8_t *buf, size_t len);
   void parse_recv_buffer_();
+  /// Queue a framed state update in the batch buffer, false if it can't be queued right now.
+  bool add_to_batch_(const uint8_t *header, size_t header_len, const std::vector<uint8_t> &payload);
+  /// Send all queued state updates in one TCP write, false if there's not enough space in the TCP buffer.
+  bool flush_batch_();
+#ifdef USE_COMPONENT_PROFILER
+  void advance_profiler_stats_();
+#endif
 
   enum class ConnectionState {
     WAITING_FOR_HELLO,
@@ -148,15 +177,34 @@ class APIConnection : public APIServerConnection {
   bool remove_{false};
 
   std::vector<uint8_t> send_buffer_;
-  std::vector<uint8_t> recv_buffer_;
+  RingBuffer recv_buffer_{API_RECV_BUFFER_SIZE, API_MAX_RECV_BUFFER_SIZE};
+  /// Holds messages that wrap around the end of recv_buffer_ while they're decoded.
+  std::vector<uint8_t> recv_scratch_;
+  bool recv_overflow_{false};
+  /// Framed state updates waiting to be sent, see APIServer::set_batch_delay.
+  std::vector<uint8_t> batch_buffer_;
+  uint32_t batch_messages_{0};
+  uint32_t batch_start_{0};
+  /// Batching statistics for this connection, logged when it's closed.
+  uint32_t batch_flushes_{0};
+  uint32_t batched_messages_{0};
+  uint32_t max_batch_messages_{0};
 
   std::string client_info_;
 #ifdef USE_ESP32_CAMERA
   esp32_camera::CameraImageReader image_reader_;
 #endif
+#ifdef USE_COMPONENT_PROFILER
+  /// Index of the next component to send profiler stats for, -1 if no request is in progress.
+  int32_t profiler_index_{-1};
+  bool profiler_reset_{false};
+#endif
 
   bool state_subscription_{false};
   int log_subscription_{ESPHOME_LOG_LEVEL_NONE};
+#ifdef USE_BINARY_LOGGING
+  bool log_binary_{false};
+#endif
   uint32_t last_traffic_;
   bool sent_ping_{false};
   bool service_call_subscription_{false};
@@ -189,6 +189,9 @@ bool HelloRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value)
   }
 }
 void HelloRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_string(1, this->client_info); }
+void HelloRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->client_info, false);
+}
 void HelloRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("HelloRequest {\n");
@@ -226,6 +229,11 @@ void HelloResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_uint32(2, this->api_version_minor);
   buffer.encode_string(3, this->server_info);
 }
+void HelloResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint32_field(total_size, 1, this->api_version_major, false);
+  ProtoSize::add_uint32_field(total_size, 1, this->api_version_minor, false);
+  ProtoSize::add_string_field(total_size, 1, this->server_info, false);
+}
 void HelloResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("HelloResponse {\n");
@@ -255,6 +263,9 @@ bool ConnectRequest::decode_length(uint32_t field_id, ProtoLengthDelimited value
   }
 }
 void ConnectRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_string(1, this->password); }
+void ConnectRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->password, false);
+}
 void ConnectRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ConnectRequest {\n");
@@ -274,6 +285,9 @@ bool ConnectResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   }
 }
 void ConnectResponse::encode(ProtoWriteBuffer buffer) const { buffer.encode_bool(1, this->invalid_password); }
+void ConnectResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool_field(total_size, 1, this->invalid_password, false);
+}
 void ConnectResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ConnectResponse {\n");
@@ -283,14 +297,19 @@ void ConnectResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 void DisconnectRequest::encode(ProtoWriteBuffer buffer) const {}
+void DisconnectRequest::calculate_size(uint32_t &total_size) const {}
 void DisconnectRequest::dump_to(std::string &out) const { out.append("DisconnectRequest {}"); }
 void DisconnectResponse::encode(ProtoWriteBuffer buffer) const {}
+void DisconnectResponse::calculate_size(uint32_t &total_size) const {}
 void DisconnectResponse::dump_to(std::string &out) const { out.append("DisconnectResponse {}"); }
 void PingRequest::encode(ProtoWriteBuffer buffer) const {}
+void PingRequest::calculate_size(uint32_t &total_size) const {}
 void PingRequest::dump_to(std::string &out) const { out.append("PingRequest {}"); }
 void PingResponse::encode(ProtoWriteBuffer buffer) const {}
+void PingResponse::calculate_size(uint32_t &total_size) const {}
 void PingResponse::dump_to(std::string &out) const { out.append("PingResponse {}"); }
 void DeviceInfoRequest::encode(ProtoWriteBuffer buffer) const {}
+void DeviceInfoRequest::calculate_size(uint32_t &total_size) const {}
 void DeviceInfoRequest::dump_to(std::string &out) const { out.append("DeviceInfoRequest {}"); }
 bool DeviceInfoResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
@@ -341,6 +360,15 @@ void DeviceInfoResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(6, this->model);
   buffer.encode_bool(7, this->has_deep_sleep);
 }
+void DeviceInfoResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool_field(total_size, 1, this->uses_password, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->mac_address, false);
+  ProtoSize::add_string_field(total_size, 1, this->esphome_version, false);
+  ProtoSize::add_string_field(total_size, 1, this->compilation_time, false);
+  ProtoSize::add_string_field(total_size, 1, this->model, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_deep_sleep, false);
+}
 void DeviceInfoResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("DeviceInfoResponse {\n");
@@ -374,10 +402,13 @@ void DeviceInfoResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 void ListEntitiesRequest::encode(ProtoWriteBuffer buffer) const {}
+void ListEntitiesRequest::calculate_size(uint32_t &total_size) const {}
 void ListEntitiesRequest::dump_to(std::string &out) const { out.append("ListEntitiesRequest {}"); }
 void ListEntitiesDoneResponse::encode(ProtoWriteBuffer buffer) const {}
+void ListEntitiesDoneResponse::calculate_size(uint32_t &total_size) const {}
 void ListEntitiesDoneResponse::dump_to(std::string &out) const { out.append("ListEntitiesDoneResponse {}"); }
 void SubscribeStatesRequest::encode(ProtoWriteBuffer buffer) const {}
+void SubscribeStatesRequest::calculate_size(uint32_t &total_size) const {}
 void SubscribeStatesRequest::dump_to(std::string &out) const { out.append("SubscribeStatesRequest {}"); }
 bool ListEntitiesBinarySensorResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
   switch (field_id) {
@@ -429,6 +460,14 @@ void ListEntitiesBinarySensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(5, this->device_class);
   buffer.encode_bool(6, this->is_status_binary_sensor);
 }
+void ListEntitiesBinarySensorResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_string_field(total_size, 1, this->device_class, false);
+  ProtoSize::add_bool_field(total_size, 1, this->is_status_binary_sensor, false);
+}
 void ListEntitiesBinarySensorResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesBinarySensorResponse {\n");
@@ -487,6 +526,11 @@ void BinarySensorStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+void BinarySensorStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->missing_state, false);
+}
 void BinarySensorStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("BinarySensorStateResponse {\n");
@@ -564,6 +608,16 @@ void ListEntitiesCoverResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(7, this->supports_tilt);
   buffer.encode_string(8, this->device_class);
 }
+void ListEntitiesCoverResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_bool_field(total_size, 1, this->assumed_state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_position, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_tilt, false);
+  ProtoSize::add_string_field(total_size, 1, this->device_class, false);
+}
 void ListEntitiesCoverResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesCoverResponse {\n");
@@ -640,6 +694,13 @@ void CoverStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(4, this->tilt);
   buffer.encode_enum<enums::CoverOperation>(5, this->current_operation);
 }
+void CoverStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_enum_field(total_size, 1, this->legacy_state, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->position != 0.0f, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->tilt != 0.0f, false);
+  ProtoSize::add_enum_field(total_size, 1, this->current_operation, false);
+}
 void CoverStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("CoverStateResponse {\n");
@@ -721,6 +782,16 @@ void CoverCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(7, this->tilt);
   buffer.encode_bool(8, this->stop);
 }
+void CoverCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_legacy_command, false);
+  ProtoSize::add_enum_field(total_size, 1, this->legacy_command, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_position, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->position != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_tilt, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->tilt != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->stop, false);
+}
 void CoverCommandRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("CoverCommandRequest {\n");
@@ -820,6 +891,16 @@ void ListEntitiesFanResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(7, this->supports_direction);
   buffer.encode_int32(8, this->supported_speed_count);
 }
+void ListEntitiesFanResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_oscillation, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_speed, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_direction, false);
+  ProtoSize::add_int32_field(total_size, 1, this->supported_speed_count, false);
+}
 void ListEntitiesFanResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesFanResponse {\n");
@@ -902,6 +983,14 @@ void FanStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::FanDirection>(5, this->direction);
   buffer.encode_int32(6, this->speed_level);
 }
+void FanStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->oscillating, false);
+  ProtoSize::add_enum_field(total_size, 1, this->speed, false);
+  ProtoSize::add_enum_field(total_size, 1, this->direction, false);
+  ProtoSize::add_int32_field(total_size, 1, this->speed_level, false);
+}
 void FanStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("FanStateResponse {\n");
@@ -1001,6 +1090,19 @@ void FanCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(10, this->has_speed_level);
   buffer.encode_int32(11, this->speed_level);
 }
+void FanCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_speed, false);
+  ProtoSize::add_enum_field(total_size, 1, this->speed, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_oscillating, false);
+  ProtoSize::add_bool_field(total_size, 1, this->oscillating, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_direction, false);
+  ProtoSize::add_enum_field(total_size, 1, this->direction, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_speed_level, false);
+  ProtoSize::add_int32_field(total_size, 1, this->speed_level, false);
+}
 void FanCommandRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("FanCommandRequest {\n");
@@ -1128,6 +1230,21 @@ void ListEntitiesLightResponse::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_string(11, it, true);
   }
 }
+void ListEntitiesLightResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_brightness, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_rgb, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_white_value, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_color_temperature, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->min_mireds != 0.0f, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->max_mireds != 0.0f, false);
+  for (const auto &it : this->effects) {
+    ProtoSize::add_string_field(total_size, 1, it, true);
+  }
+}
 void ListEntitiesLightResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesLightResponse {\n");
@@ -1246,6 +1363,17 @@ void LightStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(8, this->color_temperature);
   buffer.encode_string(9, this->effect);
 }
+void LightStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->state, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->brightness != 0.0f, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->red != 0.0f, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->green != 0.0f, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->blue != 0.0f, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->white != 0.0f, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->color_temperature != 0.0f, false);
+  ProtoSize::add_string_field(total_size, 1, this->effect, false);
+}
 void LightStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("LightStateResponse {\n");
@@ -1408,6 +1536,27 @@ void LightCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(18, this->has_effect);
   buffer.encode_string(19, this->effect);
 }
+void LightCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_brightness, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->brightness != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_rgb, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->red != 0.0f, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->green != 0.0f, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->blue != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_white, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->white != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_color_temperature, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->color_temperature != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_transition_length, false);
+  ProtoSize::add_uint32_field(total_size, 1, this->transition_length, false);
+  ProtoSize::add_bool_field(total_size, 2, this->has_flash_length, false);
+  ProtoSize::add_uint32_field(total_size, 2, this->flash_length, false);
+  ProtoSize::add_bool_field(total_size, 2, this->has_effect, false);
+  ProtoSize::add_string_field(total_size, 2, this->effect, false);
+}
 void LightCommandRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("LightCommandRequest {\n");
@@ -1562,6 +1711,17 @@ void ListEntitiesSensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(8, this->force_update);
   buffer.encode_string(9, this->device_class);
 }
+void ListEntitiesSensorResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_string_field(total_size, 1, this->icon, false);
+  ProtoSize::add_string_field(total_size, 1, this->unit_of_measurement, false);
+  ProtoSize::add_int32_field(total_size, 1, this->accuracy_decimals, false);
+  ProtoSize::add_bool_field(total_size, 1, this->force_update, false);
+  ProtoSize::add_string_field(total_size, 1, this->device_class, false);
+}
 void ListEntitiesSensorResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesSensorResponse {\n");
@@ -1633,6 +1793,11 @@ void SensorStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_float(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+void SensorStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->state != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->missing_state, false);
+}
 void SensorStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("SensorStateResponse {\n");
@@ -1701,6 +1866,14 @@ void ListEntitiesSwitchResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(5, this->icon);
   buffer.encode_bool(6, this->assumed_state);
 }
+void ListEntitiesSwitchResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_string_field(total_size, 1, this->icon, false);
+  ProtoSize::add_bool_field(total_size, 1, this->assumed_state, false);
+}
 void ListEntitiesSwitchResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesSwitchResponse {\n");
@@ -1754,6 +1927,10 @@ void SwitchStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
 }
+void SwitchStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->state, false);
+}
 void SwitchStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("SwitchStateResponse {\n");
@@ -1791,6 +1968,10 @@ void SwitchCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_fixed32(1, this->key);
   buffer.encode_bool(2, this->state);
 }
+void SwitchCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->state, false);
+}
 void SwitchCommandRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("SwitchCommandRequest {\n");
@@ -1843,6 +2024,13 @@ void ListEntitiesTextSensorResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(4, this->unique_id);
   buffer.encode_string(5, this->icon);
 }
+void ListEntitiesTextSensorResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_string_field(total_size, 1, this->icon, false);
+}
 void ListEntitiesTextSensorResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesTextSensorResponse {\n");
@@ -1903,6 +2091,11 @@ void TextSensorStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(2, this->state);
   buffer.encode_bool(3, this->missing_state);
 }
+void TextSensorStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->state, false);
+  ProtoSize::add_bool_field(total_size, 1, this->missing_state, false);
+}
 void TextSensorStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("TextSensorStateResponse {\n");
@@ -1930,6 +2123,10 @@ bool SubscribeLogsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
       this->dump_config = value.as_bool();
       return true;
     }
+    case 3: {
+      this->binary = value.as_bool();
+      return true;
+    }
     default:
       return false;
   }
@@ -1937,6 +2134,12 @@ bool SubscribeLogsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
 void SubscribeLogsRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::LogLevel>(1, this->level);
   buffer.encode_bool(2, this->dump_config);
+  buffer.encode_bool(3, this->binary);
+}
+void SubscribeLogsRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_enum_field(total_size, 1, this->level, false);
+  ProtoSize::add_bool_field(total_size, 1, this->dump_config, false);
+  ProtoSize::add_bool_field(total_size, 1, this->binary, false);
 }
 void SubscribeLogsRequest::dump_to(std::string &out) const {
   char buffer[64];
@@ -1948,6 +2151,10 @@ void SubscribeLogsRequest::dump_to(std::string &out) const {
   out.append("  dump_config: ");
   out.append(YESNO(this->dump_config));
   out.append("\n");
+
+  out.append("  binary: ");
+  out.append(YESNO(this->binary));
+  out.append("\n");
   out.append("}");
 }
 bool SubscribeLogsResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
@@ -1984,6 +2191,12 @@ void SubscribeLogsResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(3, this->message);
   buffer.encode_bool(4, this->send_failed);
 }
+void SubscribeLogsResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_enum_field(total_size, 1, this->level, false);
+  ProtoSize::add_string_field(total_size, 1, this->tag, false);
+  ProtoSize::add_string_field(total_size, 1, this->message, false);
+  ProtoSize::add_bool_field(total_size, 1, this->send_failed, false);
+}
 void SubscribeLogsResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("SubscribeLogsResponse {\n");
@@ -2004,7 +2217,58 @@ void SubscribeLogsResponse::dump_to(std::string &out) const {
   out.append("\n");
   out.append("}");
 }
+bool SubscribeLogsBinaryResponse::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 1: {
+      this->level = value.as_enum<enums::LogLevel>();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+bool SubscribeLogsBinaryResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  switch (field_id) {
+    case 2: {
+      this->tag = value.as_string();
+      return true;
+    }
+    case 3: {
+      this->data = value.as_string();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void SubscribeLogsBinaryResponse::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_enum<enums::LogLevel>(1, this->level);
+  buffer.encode_string(2, this->tag);
+  buffer.encode_string(3, this->data);
+}
+void SubscribeLogsBinaryResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_enum_field(total_size, 1, this->level, false);
+  ProtoSize::add_string_field(total_size, 1, this->tag, false);
+  ProtoSize::add_string_field(total_size, 1, this->data, false);
+}
+void SubscribeLogsBinaryResponse::dump_to(std::string &out) const {
+  char buffer[64];
+  out.append("SubscribeLogsBinaryResponse {\n");
+  out.append("  level: ");
+  out.append(proto_enum_to_string<enums::LogLevel>(this->level));
+  out.append("\n");
+
+  out.append("  tag: ");
+  out.append("'").append(this->tag).append("'");
+  out.append("\n");
+
+  out.append("  data: ");
+  out.append("'").append(this->data).append("'");
+  out.append("\n");
+  out.append("}");
+}
 void SubscribeHomeassistantServicesRequest::encode(ProtoWriteBuffer buffer) const {}
+void SubscribeHomeassistantServicesRequest::calculate_size(uint32_t &total_size) const {}
 void SubscribeHomeassistantServicesRequest::dump_to(std::string &out) const {
   out.append("SubscribeHomeassistantServicesRequest {}");
 }
@@ -2026,6 +2290,10 @@ void HomeassistantServiceMap::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->key);
   buffer.encode_string(2, this->value);
 }
+void HomeassistantServiceMap::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->key, false);
+  ProtoSize::add_string_field(total_size, 1, this->value, false);
+}
 void HomeassistantServiceMap::dump_to(std::string &out) const {
   char buffer[64];
   out.append("HomeassistantServiceMap {\n");
@@ -2083,6 +2351,19 @@ void HomeassistantServiceResponse::encode(ProtoWriteBuffer buffer) const {
   }
   buffer.encode_bool(5, this->is_event);
 }
+void HomeassistantServiceResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->service, false);
+  for (const auto &it : this->data) {
+    ProtoSize::add_message_field(total_size, 1, it, true);
+  }
+  for (const auto &it : this->data_template) {
+    ProtoSize::add_message_field(total_size, 1, it, true);
+  }
+  for (const auto &it : this->variables) {
+    ProtoSize::add_message_field(total_size, 1, it, true);
+  }
+  ProtoSize::add_bool_field(total_size, 1, this->is_event, false);
+}
 void HomeassistantServiceResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("HomeassistantServiceResponse {\n");
@@ -2114,6 +2395,7 @@ void HomeassistantServiceResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 void SubscribeHomeAssistantStatesRequest::encode(ProtoWriteBuffer buffer) const {}
+void SubscribeHomeAssistantStatesRequest::calculate_size(uint32_t &total_size) const {}
 void SubscribeHomeAssistantStatesRequest::dump_to(std::string &out) const {
   out.append("SubscribeHomeAssistantStatesRequest {}");
 }
@@ -2130,6 +2412,9 @@ bool SubscribeHomeAssistantStateResponse::decode_length(uint32_t field_id, Proto
 void SubscribeHomeAssistantStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->entity_id);
 }
+void SubscribeHomeAssistantStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->entity_id, false);
+}
 void SubscribeHomeAssistantStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("SubscribeHomeAssistantStateResponse {\n");
@@ -2156,6 +2441,10 @@ void HomeAssistantStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->entity_id);
   buffer.encode_string(2, this->state);
 }
+void HomeAssistantStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->entity_id, false);
+  ProtoSize::add_string_field(total_size, 1, this->state, false);
+}
 void HomeAssistantStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("HomeAssistantStateResponse {\n");
@@ -2169,6 +2458,7 @@ void HomeAssistantStateResponse::dump_to(std::string &out) const {
   out.append("}");
 }
 void GetTimeRequest::encode(ProtoWriteBuffer buffer) const {}
+void GetTimeRequest::calculate_size(uint32_t &total_size) const {}
 void GetTimeRequest::dump_to(std::string &out) const { out.append("GetTimeRequest {}"); }
 bool GetTimeResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
   switch (field_id) {
@@ -2181,6 +2471,9 @@ bool GetTimeResponse::decode_32bit(uint32_t field_id, Proto32Bit value) {
   }
 }
 void GetTimeResponse::encode(ProtoWriteBuffer buffer) const { buffer.encode_fixed32(1, this->epoch_seconds); }
+void GetTimeResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->epoch_seconds != 0, false);
+}
 void GetTimeResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("GetTimeResponse {\n");
@@ -2214,6 +2507,10 @@ void ListEntitiesServicesArgument::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(1, this->name);
   buffer.encode_enum<enums::ServiceArgType>(2, this->type);
 }
+void ListEntitiesServicesArgument::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_enum_field(total_size, 1, this->type, false);
+}
 void ListEntitiesServicesArgument::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesServicesArgument {\n");
@@ -2257,6 +2554,13 @@ void ListEntitiesServicesResponse::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_message<ListEntitiesServicesArgument>(3, it, true);
   }
 }
+void ListEntitiesServicesResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  for (const auto &it : this->args) {
+    ProtoSize::add_message_field(total_size, 1, it, true);
+  }
+}
 void ListEntitiesServicesResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesServicesResponse {\n");
@@ -2349,6 +2653,25 @@ void ExecuteServiceArgument::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_string(9, it, true);
   }
 }
+void ExecuteServiceArgument::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool_field(total_size, 1, this->bool_, false);
+  ProtoSize::add_int32_field(total_size, 1, this->legacy_int, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->float_ != 0.0f, false);
+  ProtoSize::add_string_field(total_size, 1, this->string_, false);
+  ProtoSize::add_sint32_field(total_size, 1, this->int_, false);
+  for (const auto it : this->bool_array) {
+    ProtoSize::add_bool_field(total_size, 1, it, true);
+  }
+  for (const auto &it : this->int_array) {
+    ProtoSize::add_sint32_field(total_size, 1, it, true);
+  }
+  for (const auto &it : this->float_array) {
+    ProtoSize::add_fixed_field<4>(total_size, 1, it != 0.0f, true);
+  }
+  for (const auto &it : this->string_array) {
+    ProtoSize::add_string_field(total_size, 1, it, true);
+  }
+}
 void ExecuteServiceArgument::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ExecuteServiceArgument {\n");
@@ -2428,6 +2751,12 @@ void ExecuteServiceRequest::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_message<ExecuteServiceArgument>(2, it, true);
   }
 }
+void ExecuteServiceRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  for (const auto &it : this->args) {
+    ProtoSize::add_message_field(total_size, 1, it, true);
+  }
+}
 void ExecuteServiceRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ExecuteServiceRequest {\n");
@@ -2477,6 +2806,12 @@ void ListEntitiesCameraResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(3, this->name);
   buffer.encode_string(4, this->unique_id);
 }
+void ListEntitiesCameraResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+}
 void ListEntitiesCameraResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesCameraResponse {\n");
@@ -2533,6 +2868,11 @@ void CameraImageResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_string(2, this->data);
   buffer.encode_bool(3, this->done);
 }
+void CameraImageResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->data, false);
+  ProtoSize::add_bool_field(total_size, 1, this->done, false);
+}
 void CameraImageResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("CameraImageResponse {\n");
@@ -2568,6 +2908,10 @@ void CameraImageRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(1, this->single);
   buffer.encode_bool(2, this->stream);
 }
+void CameraImageRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool_field(total_size, 1, this->single, false);
+  ProtoSize::add_bool_field(total_size, 1, this->stream, false);
+}
 void CameraImageRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("CameraImageRequest {\n");
@@ -2676,6 +3020,28 @@ void ListEntitiesClimateResponse::encode(ProtoWriteBuffer buffer) const {
     buffer.encode_enum<enums::ClimateSwingMode>(14, it, true);
   }
 }
+void ListEntitiesClimateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->object_id, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_string_field(total_size, 1, this->name, false);
+  ProtoSize::add_string_field(total_size, 1, this->unique_id, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_current_temperature, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_two_point_target_temperature, false);
+  for (const auto &it : this->supported_modes) {
+    ProtoSize::add_enum_field(total_size, 1, it, true);
+  }
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->visual_min_temperature != 0.0f, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->visual_max_temperature != 0.0f, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->visual_temperature_step != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_away, false);
+  ProtoSize::add_bool_field(total_size, 1, this->supports_action, false);
+  for (const auto &it : this->supported_fan_modes) {
+    ProtoSize::add_enum_field(total_size, 1, it, true);
+  }
+  for (const auto &it : this->supported_swing_modes) {
+    ProtoSize::add_enum_field(total_size, 1, it, true);
+  }
+}
 void ListEntitiesClimateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ListEntitiesClimateResponse {\n");
@@ -2810,6 +3176,18 @@ void ClimateStateResponse::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_enum<enums::ClimateFanMode>(9, this->fan_mode);
   buffer.encode_enum<enums::ClimateSwingMode>(10, this->swing_mode);
 }
+void ClimateStateResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_enum_field(total_size, 1, this->mode, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->current_temperature != 0.0f, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->target_temperature != 0.0f, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->target_temperature_low != 0.0f, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->target_temperature_high != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->away, false);
+  ProtoSize::add_enum_field(total_size, 1, this->action, false);
+  ProtoSize::add_enum_field(total_size, 1, this->fan_mode, false);
+  ProtoSize::add_enum_field(total_size, 1, this->swing_mode, false);
+}
 void ClimateStateResponse::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ClimateStateResponse {\n");
@@ -2948,6 +3326,23 @@ void ClimateCommandRequest::encode(ProtoWriteBuffer buffer) const {
   buffer.encode_bool(14, this->has_swing_mode);
   buffer.encode_enum<enums::ClimateSwingMode>(15, this->swing_mode);
 }
+void ClimateCommandRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->key != 0, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_mode, false);
+  ProtoSize::add_enum_field(total_size, 1, this->mode, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_target_temperature, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->target_temperature != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_target_temperature_low, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->target_temperature_low != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_target_temperature_high, false);
+  ProtoSize::add_fixed_field<4>(total_size, 1, this->target_temperature_high != 0.0f, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_away, false);
+  ProtoSize::add_bool_field(total_size, 1, this->away, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_fan_mode, false);
+  ProtoSize::add_enum_field(total_size, 1, this->fan_mode, false);
+  ProtoSize::add_bool_field(total_size, 1, this->has_swing_mode, false);
+  ProtoSize::add_enum_field(total_size, 1, this->swing_mode, false);
+}
 void ClimateCommandRequest::dump_to(std::string &out) const {
   char buffer[64];
   out.append("ClimateCommandRequest {\n");
@@ -3016,6 +3411,154 @@ void ClimateCommandRequest::dump_to(std::string &out) const {
   out.append("\n");
   out.append("}");
 }
+bool ProfilerStatsRequest::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 1: {
+      this->reset = value.as_bool();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void ProfilerStatsRequest::encode(ProtoWriteBuffer buffer) const { buffer.encode_bool(1, this->reset); }
+void ProfilerStatsRequest::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_bool_field(total_size, 1, this->reset, false);
+}
+void ProfilerStatsRequest::dump_to(std::string &out) const {
+  char buffer[64];
+  out.append("ProfilerStatsRequest {\n");
+  out.append("  reset: ");
+  out.append(YESNO(this->reset));
+  out.append("\n");
+  out.append("}");
+}
+bool ProfilerTimingStats::decode_varint(uint32_t field_id, ProtoVarInt value) {
+  switch (field_id) {
+    case 1: {
+      this->count = value.as_uint32();
+      return true;
+    }
+    case 2: {
+      this->min_us = value.as_uint32();
+      return true;
+    }
+    case 3: {
+      this->avg_us = value.as_uint32();
+      return true;
+    }
+    case 4: {
+      this->max_us = value.as_uint32();
+      return true;
+    }
+    case 5: {
+      this->p99_us = value.as_uint32();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void ProfilerTimingStats::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_uint32(1, this->count);
+  buffer.encode_uint32(2, this->min_us);
+  buffer.encode_uint32(3, this->avg_us);
+  buffer.encode_uint32(4, this->max_us);
+  buffer.encode_uint32(5, this->p99_us);
+}
+void ProfilerTimingStats::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_uint32_field(total_size, 1, this->count, false);
+  ProtoSize::add_uint32_field(total_size, 1, this->min_us, false);
+  ProtoSize::add_uint32_field(total_size, 1, this->avg_us, false);
+  ProtoSize::add_uint32_field(total_size, 1, this->max_us, false);
+  ProtoSize::add_uint32_field(total_size, 1, this->p99_us, false);
+}
+void ProfilerTimingStats::dump_to(std::string &out) const {
+  char buffer[64];
+  out.append("ProfilerTimingStats {\n");
+  out.append("  count: ");
+  sprintf(buffer, "%u", this->count);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  min_us: ");
+  sprintf(buffer, "%u", this->min_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  avg_us: ");
+  sprintf(buffer, "%u", this->avg_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  max_us: ");
+  sprintf(buffer, "%u", this->max_us);
+  out.append(buffer);
+  out.append("\n");
+
+  out.append("  p99_us: ");
+  sprintf(buffer, "%u", this->p99_us);
+  out.append(buffer);
+  out.append("\n");
+  out.append("}");
+}
+bool ProfilerStatsResponse::decode_length(uint32_t field_id, ProtoLengthDelimited value) {
+  switch (field_id) {
+    case 1: {
+      this->source = value.as_string();
+      return true;
+    }
+    case 2: {
+      this->loop = value.as_message<ProfilerTimingStats>();
+      return true;
+    }
+    case 3: {
+      this->update = value.as_message<ProfilerTimingStats>();
+      return true;
+    }
+    case 4: {
+      this->scheduler = value.as_message<ProfilerTimingStats>();
+      return true;
+    }
+    default:
+      return false;
+  }
+}
+void ProfilerStatsResponse::encode(ProtoWriteBuffer buffer) const {
+  buffer.encode_string(1, this->source);
+  buffer.encode_message<ProfilerTimingStats>(2, this->loop);
+  buffer.encode_message<ProfilerTimingStats>(3, this->update);
+  buffer.encode_message<ProfilerTimingStats>(4, this->scheduler);
+}
+void ProfilerStatsResponse::calculate_size(uint32_t &total_size) const {
+  ProtoSize::add_string_field(total_size, 1, this->source, false);
+  ProtoSize::add_message_field(total_size, 1, this->loop, false);
+  ProtoSize::add_message_field(total_size, 1, this->update, false);
+  ProtoSize::add_message_field(total_size, 1, this->scheduler, false);
+}
+void ProfilerStatsResponse::dump_to(std::string &out) const {
+  char buffer[64];
+  out.append("ProfilerStatsResponse {\n");
+  out.append("  source: ");
+  out.append("'").append(this->source).append("'");
+  out.append("\n");
+
+  out.append("  loop: ");
+  this->loop.dump_to(out);
+  out.append("\n");
+
+  out.append("  update: ");
+  this->update.dump_to(out);
+  out.append("\n");
+
+  out.append("  scheduler: ");
+  this->scheduler.dump_to(out);
+  out.append("\n");
+  out.append("}");
+}
+void ProfilerStatsDoneResponse::encode(ProtoWriteBuffer buffer) const {}
+void ProfilerStatsDoneResponse::calculate_size(uint32_t &total_size) const {}
+void ProfilerStatsDoneResponse::dump_to(std::string &out) const { out.append("ProfilerStatsDoneResponse {}"); }
 
 }  // namespace api
 }  // namespace esphome
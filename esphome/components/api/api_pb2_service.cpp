@@ -135,6 +135,11 @@ bool APIServerConnectionBase::send_text_sensor_state_response(const TextSensorSt
 bool APIServerConnectionBase::send_subscribe_logs_response(const SubscribeLogsResponse &msg) {
   return this->send_message_<SubscribeLogsResponse>(msg, 29);
 }
+#ifdef USE_BINARY_LOGGING
+bool APIServerConnectionBase::send_subscribe_logs_binary_response(const SubscribeLogsBinaryResponse &msg) {
+  return this->send_message_<SubscribeLogsBinaryResponse>(msg, 52);
+}
+#endif
 bool APIServerConnectionBase::send_homeassistant_service_response(const HomeassistantServiceResponse &msg) {
   ESP_LOGVV(TAG, "send_homeassistant_service_response: %s", msg.dump().c_str());
   return this->send_message_<HomeassistantServiceResponse>(msg, 35);
@@ -184,6 +189,20 @@ bool APIServerConnectionBase::send_climate_state_response(const ClimateStateResp
 #endif
 #ifdef USE_CLIMATE
 #endif
+#ifdef USE_COMPONENT_PROFILER
+#endif
+#ifdef USE_COMPONENT_PROFILER
+bool APIServerConnectionBase::send_profiler_stats_response(const ProfilerStatsResponse &msg) {
+  ESP_LOGVV(TAG, "send_profiler_stats_response: %s", msg.dump().c_str());
+  return this->send_message_<ProfilerStatsResponse>(msg, 50);
+}
+#endif
+#ifdef USE_COMPONENT_PROFILER
+bool APIServerConnectionBase::send_profiler_stats_done_response(const ProfilerStatsDoneResponse &msg) {
+  ESP_LOGVV(TAG, "send_profiler_stats_done_response: %s", msg.dump().c_str());
+  return this->send_message_<ProfilerStatsDoneResponse>(msg, 51);
+}
+#endif
 bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) {
   switch (msg_type) {
     case 1: {
@@ -349,6 +368,15 @@ bool APIServerConnectionBase::read_message(uint32_t msg_size, uint32_t msg_type,
       msg.decode(msg_data, msg_size);
       ESP_LOGVV(TAG, "on_climate_command_request: %s", msg.dump().c_str());
       this->on_climate_command_request(msg);
+#endif
+      break;
+    }
+    case 49: {
+#ifdef USE_COMPONENT_PROFILER
+      ProfilerStatsRequest msg;
+      msg.decode(msg_data, msg_size);
+      ESP_LOGVV(TAG, "on_profiler_stats_request: %s", msg.dump().c_str());
+      this->on_profiler_stats_request(msg);
 #endif
       break;
     }
@@ -547,6 +575,19 @@ void APIServerConnection::on_climate_command_request(const ClimateCommandRequest
   this->climate_command(msg);
 }
 #endif
+#ifdef USE_COMPONENT_PROFILER
+void APIServerConnection::on_profiler_stats_request(const ProfilerStatsRequest &msg) {
+  if (!this->is_connection_setup()) {
+    this->on_no_setup_connection();
+    return;
+  }
+  if (!this->is_authenticated()) {
+    this->on_unauthenticated_access();
+    return;
+  }
+  this->profiler_stats(msg);
+}
+#endif
 
 }  // namespace api
 }  // namespace esphome
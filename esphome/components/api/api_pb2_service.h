@@ -83,6 +83,9 @@ class APIServerConnectionBase : public ProtoService {
 #endif
   virtual void on_subscribe_logs_request(const SubscribeLogsRequest &value){};
   bool send_subscribe_logs_response(const SubscribeLogsResponse &msg);
+#ifdef USE_BINARY_LOGGING
+  bool send_subscribe_logs_binary_response(const SubscribeLogsBinaryResponse &msg);
+#endif
   virtual void on_subscribe_homeassistant_services_request(const SubscribeHomeassistantServicesRequest &value){};
   bool send_homeassistant_service_response(const HomeassistantServiceResponse &msg);
   virtual void on_subscribe_home_assistant_states_request(const SubscribeHomeAssistantStatesRequest &value){};
@@ -111,6 +114,15 @@ class APIServerConnectionBase : public ProtoService {
 #endif
 #ifdef USE_CLIMATE
   virtual void on_climate_command_request(const ClimateCommandRequest &value){};
+#endif
+#ifdef USE_COMPONENT_PROFILER
+  virtual void on_profiler_stats_request(const ProfilerStatsRequest &value){};
+#endif
+#ifdef USE_COMPONENT_PROFILER
+  bool send_profiler_stats_response(const ProfilerStatsResponse &msg);
+#endif
+#ifdef USE_COMPONENT_PROFILER
+  bool send_profiler_stats_done_response(const ProfilerStatsDoneResponse &msg);
 #endif
  protected:
   bool read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) override;
@@ -147,6 +159,9 @@ class APIServerConnection : public APIServerConnectionBase {
 #endif
 #ifdef USE_CLIMATE
   virtual void climate_command(const ClimateCommandRequest &msg) = 0;
+#endif
+#ifdef USE_COMPONENT_PROFILER
+  virtual void profiler_stats(const ProfilerStatsRequest &msg) = 0;
 #endif
  protected:
   void on_hello_request(const HelloRequest &msg) override;
@@ -179,6 +194,9 @@ class APIServerConnection : public APIServerConnectionBase {
 #ifdef USE_CLIMATE
   void on_climate_command_request(const ClimateCommandRequest &msg) override;
 #endif
+#ifdef USE_COMPONENT_PROFILER
+  void on_profiler_stats_request(const ProfilerStatsRequest &msg) override;
+#endif
 };
 
 }  // namespace api
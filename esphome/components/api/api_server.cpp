@@ -37,12 +37,31 @@ void APIServer::setup() {
       this);
 #ifdef USE_LOGGER
   if (logger::global_logger != nullptr) {
+#ifdef USE_BINARY_LOGGING
+    // messages are only formatted/encoded while a client is subscribed, see update_log_requests()
+    logger::global_logger->add_on_optional_log_callback([this](int level, const char *tag, const char *message) {
+      // binary subscribers get the text of messages that have no binary form
+      const bool fallback = logger::global_logger->is_binary_log_fallback();
+      for (auto *c : this->clients_) {
+        if (!c->remove_ && (c->wants_text_logs() || (fallback && c->wants_binary_logs())))
+          c->send_log_message(level, tag, message);
+      }
+    });
+    logger::global_logger->add_on_binary_log_callback(
+        [this](int level, const char *tag, const uint8_t *data, size_t len) {
+          for (auto *c : this->clients_) {
+            if (!c->remove_ && c->wants_binary_logs())
+              c->send_binary_log_message(level, tag, data, len);
+          }
+        });
+#else
     logger::global_logger->add_on_log_callback([this](int level, const char *tag, const char *message) {
       for (auto *c : this->clients_) {
         if (!c->remove_)
           c->send_log_message(level, tag, message);
       }
     });
+#endif
   }
 #endif
 
@@ -64,8 +83,20 @@ void APIServer::loop() {
       std::partition(this->clients_.begin(), this->clients_.end(), [](APIConnection *conn) { return !conn->remove_; });
   // print disconnection messages
   for (auto it = new_end; it != this->clients_.end(); ++it) {
-    ESP_LOGD(TAG, "Disconnecting %s", (*it)->client_info_.c_str());
+    APIConnection *conn = *it;
+    ESP_LOGD(TAG, "Disconnecting %s", conn->client_info_.c_str());
+    if (conn->batch_flushes_ != 0) {
+      ESP_LOGD(TAG, "  Batched %u state updates in %u frames (max %u per frame)", conn->batched_messages_,
+               conn->batch_flushes_, conn->max_batch_messages_);
+    }
+    if (conn->batch_messages_ != 0) {
+      ESP_LOGW(TAG, "  Dropped %u queued state updates", conn->batch_messages_);
+    }
   }
+#ifdef USE_BINARY_LOGGING
+  if (new_end != this->clients_.end())
+    this->update_log_requests();
+#endif
   // only then delete the pointers, otherwise log routine
   // would access freed memory
   for (auto it = new_end; it != this->clients_.end(); ++it)
@@ -94,6 +125,10 @@ void APIServer::loop() {
 void APIServer::dump_config() {
   ESP_LOGCONFIG(TAG, "API Server:");
   ESP_LOGCONFIG(TAG, "  Address: %s:%u", network_get_address().c_str(), this->port_);
+  if (this->batch_delay_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Batch Delay: %u ms", this->batch_delay_);
+    ESP_LOGCONFIG(TAG, "  Batch Size: %u bytes", this->batch_size_);
+  }
 }
 bool APIServer::uses_password() const { return !this->password_.empty(); }
 bool APIServer::check_password(const std::string &password) const {
@@ -125,6 +160,21 @@ bool APIServer::check_password(const std::string &password) const {
   return result == 0;
 }
 void APIServer::handle_disconnect(APIConnection *conn) {}
+#ifdef USE_BINARY_LOGGING
+void APIServer::update_log_requests() {
+  if (logger::global_logger == nullptr)
+    return;
+  bool text = false, binary = false;
+  for (auto *c : this->clients_) {
+    if (c->remove_)
+      continue;
+    text |= c->wants_text_logs();
+    binary |= c->wants_binary_logs();
+  }
+  logger::global_logger->set_text_log_requested(text);
+  logger::global_logger->set_binary_log_requested(binary);
+}
+#endif
 #ifdef USE_BINARY_SENSOR
 void APIServer::on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) {
   if (obj->is_internal())
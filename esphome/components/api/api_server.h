@@ -36,7 +36,21 @@ class APIServer : public Component, public Controller {
   void set_port(uint16_t port);
   void set_password(const std::string &password);
   void set_reboot_timeout(uint32_t reboot_timeout);
+  /** Coalesce state updates to each client for up to this many milliseconds (0 disables batching).
+   *
+   * Queued messages are sent together in one TCP write, which greatly reduces the number of small
+   * TCP segments when many entities change state in quick succession.
+   */
+  void set_batch_delay(uint32_t batch_delay) { this->batch_delay_ = batch_delay; }
+  uint32_t get_batch_delay() const { return this->batch_delay_; }
+  /// Send the queued state updates early once they reach this many bytes.
+  void set_batch_size(uint32_t batch_size) { this->batch_size_ = batch_size; }
+  uint32_t get_batch_size() const { return this->batch_size_; }
   void handle_disconnect(APIConnection *conn);
+#ifdef USE_BINARY_LOGGING
+  /// Tell the logger which log formats the connected clients are subscribed to.
+  void update_log_requests();
+#endif
 #ifdef USE_BINARY_SENSOR
   void on_binary_sensor_update(binary_sensor::BinarySensor *obj, bool state) override;
 #endif
@@ -83,6 +97,8 @@ class APIServer : public Component, public Controller {
   uint16_t port_{6053};
   uint32_t reboot_timeout_{300000};
   uint32_t last_connected_{0};
+  uint32_t batch_delay_{0};
+  uint32_t batch_size_{1024};
   std::vector<APIConnection *> clients_;
   std::string password_;
   std::vector<HomeAssistantStateSubscription> state_subs_;
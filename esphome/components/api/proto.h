@@ -63,20 +63,24 @@ class ProtoVarInt {
       return static_cast<int64_t>(this->value_ >> 1);
   }
   void encode(std::vector<uint8_t> &out) {
-    uint32_t val = this->value_;
-    if (val <= 0x7F) {
-      out.push_back(val);
+    if (this->value_ <= 0x7F) {
+      out.push_back(this->value_);
       return;
     }
-    while (val) {
-      uint8_t temp = val & 0x7F;
+    uint8_t data[10];
+    uint8_t len = this->encode(data);
+    out.insert(out.end(), data, data + len);
+  }
+  /// Encode into the given buffer (which must have room for 10 bytes), returns the number of bytes written.
+  uint8_t encode(uint8_t *out) const {
+    uint64_t val = this->value_;
+    uint8_t i = 0;
+    while (val > 0x7F) {
+      out[i++] = (val & 0x7F) | 0x80;
       val >>= 7;
-      if (val) {
-        out.push_back(temp | 0x80);
-      } else {
-        out.push_back(temp);
-      }
     }
+    out[i++] = val;
+    return i;
   }
 
  protected:
@@ -150,12 +154,12 @@ class ProtoWriteBuffer {
 
     this->encode_field_raw(field_id, 2);
     this->encode_varint_raw(len);
-    auto *data = reinterpret_cast<const uint8_t *>(string);
-    for (size_t i = 0; i < len; i++)
-      this->write(data[i]);
+    const size_t begin = this->buffer_->size();
+    this->buffer_->resize(begin + len);
+    memcpy(this->buffer_->data() + begin, string, len);
   }
   void encode_string(uint32_t field_id, const std::string &value, bool force = false) {
-    this->encode_string(field_id, value.data(), value.size());
+    this->encode_string(field_id, value.data(), value.size(), force);
   }
   void encode_bytes(uint32_t field_id, const uint8_t *data, size_t len, bool force = false) {
     this->encode_string(field_id, reinterpret_cast<const char *>(data), len, force);
@@ -200,7 +204,7 @@ class ProtoWriteBuffer {
       uint32_t raw;
     } val{};
     val.value = value;
-    this->encode_fixed32(field_id, val.raw);
+    this->encode_fixed32(field_id, val.raw, force);
   }
   void encode_int32(uint32_t field_id, int32_t value, bool force = false) {
     if (value < 0) {
@@ -223,15 +227,11 @@ class ProtoWriteBuffer {
   }
   template<class C> void encode_message(uint32_t field_id, const C &value, bool force = false) {
     this->encode_field_raw(field_id, 2);
-    size_t begin = this->buffer_->size();
-
+    // the nested length is written up front, so the message can be encoded in place
+    uint32_t nested_length = 0;
+    value.calculate_size(nested_length);
+    this->encode_varint_raw(nested_length);
     value.encode(*this);
-
-    const uint32_t nested_length = this->buffer_->size() - begin;
-    // add size varint
-    std::vector<uint8_t> var;
-    ProtoVarInt(nested_length).encode(var);
-    this->buffer_->insert(this->buffer_->begin() + begin, var.begin(), var.end());
   }
   std::vector<uint8_t> *get_buffer() const { return buffer_; }
 
@@ -239,9 +239,95 @@ class ProtoWriteBuffer {
   std::vector<uint8_t> *buffer_;
 };
 
+/** Computes the encoded size of protobuf fields.
+ *
+ * Each add_*_field method mirrors the matching ProtoWriteBuffer::encode_* method (including when a field is
+ * skipped), field_id_size is the size of the encoded field tag which is known at code generation time.
+ */
+class ProtoSize {
+ public:
+  static uint32_t varint(uint32_t value) {
+    if (value < (1 << 7))
+      return 1;
+    if (value < (1 << 14))
+      return 2;
+    if (value < (1 << 21))
+      return 3;
+    if (value < (1 << 28))
+      return 4;
+    return 5;
+  }
+  static uint32_t varint(uint64_t value) {
+    uint32_t size = 1;
+    while (value > 0x7F) {
+      value >>= 7;
+      size++;
+    }
+    return size;
+  }
+  static void add_uint32_field(uint32_t &total_size, uint32_t field_id_size, uint32_t value, bool force) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + varint(value);
+  }
+  static void add_uint64_field(uint32_t &total_size, uint32_t field_id_size, uint64_t value, bool force) {
+    if (value == 0 && !force)
+      return;
+    total_size += field_id_size + varint(value);
+  }
+  template<typename T> static void add_enum_field(uint32_t &total_size, uint32_t field_id_size, T value, bool force) {
+    add_uint32_field(total_size, field_id_size, static_cast<uint32_t>(value), force);
+  }
+  static void add_int32_field(uint32_t &total_size, uint32_t field_id_size, int32_t value, bool force) {
+    if (value < 0) {
+      add_int64_field(total_size, field_id_size, value, force);
+      return;
+    }
+    add_uint32_field(total_size, field_id_size, static_cast<uint32_t>(value), force);
+  }
+  static void add_int64_field(uint32_t &total_size, uint32_t field_id_size, int64_t value, bool force) {
+    add_uint64_field(total_size, field_id_size, static_cast<uint64_t>(value), force);
+  }
+  static void add_sint32_field(uint32_t &total_size, uint32_t field_id_size, int32_t value, bool force) {
+    uint32_t uvalue;
+    if (value < 0)
+      uvalue = ~(value << 1);
+    else
+      uvalue = value << 1;
+    add_uint32_field(total_size, field_id_size, uvalue, force);
+  }
+  static void add_bool_field(uint32_t &total_size, uint32_t field_id_size, bool value, bool force) {
+    if (!value && !force)
+      return;
+    total_size += field_id_size + 1;
+  }
+  /// fixed32/sfixed32/float (N=4) and fixed64/sfixed64/double (N=8) fields.
+  template<uint32_t N>
+  static void add_fixed_field(uint32_t &total_size, uint32_t field_id_size, bool is_nonzero, bool force) {
+    if (!is_nonzero && !force)
+      return;
+    total_size += field_id_size + N;
+  }
+  static void add_string_field(uint32_t &total_size, uint32_t field_id_size, const std::string &value, bool force) {
+    const uint32_t len = value.size();
+    if (len == 0 && !force)
+      return;
+    total_size += field_id_size + varint(len) + len;
+  }
+  template<class C>
+  static void add_message_field(uint32_t &total_size, uint32_t field_id_size, const C &value, bool force) {
+    // nested messages are always encoded, even if they are empty
+    uint32_t nested_length = 0;
+    value.calculate_size(nested_length);
+    total_size += field_id_size + varint(nested_length) + nested_length;
+  }
+};
+
 class ProtoMessage {
  public:
   virtual void encode(ProtoWriteBuffer buffer) const = 0;
+  /// Add the size of this message when encoded to total_size.
+  virtual void calculate_size(uint32_t &total_size) const = 0;
   void decode(const uint8_t *buffer, size_t length);
   std::string dump() const;
   virtual void dump_to(std::string &out) const = 0;
@@ -263,12 +349,15 @@ class ProtoService {
   virtual void on_fatal_error() = 0;
   virtual void on_unauthenticated_access() = 0;
   virtual void on_no_setup_connection() = 0;
-  virtual ProtoWriteBuffer create_buffer() = 0;
+  /// Create a buffer for a message with room for (at least) reserve_size bytes.
+  virtual ProtoWriteBuffer create_buffer(uint32_t reserve_size) = 0;
   virtual bool send_buffer(ProtoWriteBuffer buffer, uint32_t message_type) = 0;
   virtual bool read_message(uint32_t msg_size, uint32_t msg_type, uint8_t *msg_data) = 0;
 
   template<class C> bool send_message_(const C &msg, uint32_t message_type) {
-    auto buffer = this->create_buffer();
+    uint32_t msg_size = 0;
+    msg.calculate_size(msg_size);
+    auto buffer = this->create_buffer(msg_size);
     msg.encode(buffer);
     return this->send_buffer(buffer, message_type);
   }
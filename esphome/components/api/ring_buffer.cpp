@@ -0,0 +1,112 @@
+#include "ring_buffer.h"
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace api {
+
+RingBuffer::RingBuffer(size_t initial_capacity, size_t max_capacity)
+    : data_(new uint8_t[initial_capacity]), capacity_(initial_capacity), max_capacity_(max_capacity) {
+#ifdef ARDUINO_ARCH_ESP32
+  this->lock_ = xSemaphoreCreateMutex();
+#endif
+}
+RingBuffer::~RingBuffer() {
+#ifdef ARDUINO_ARCH_ESP32
+  vSemaphoreDelete(this->lock_);
+#endif
+}
+
+RingBuffer::LockGuard::LockGuard(const RingBuffer *parent) : parent_(parent) {
+#ifdef ARDUINO_ARCH_ESP32
+  xSemaphoreTake(this->parent_->lock_, portMAX_DELAY);
+#endif
+}
+RingBuffer::LockGuard::~LockGuard() {
+#ifdef ARDUINO_ARCH_ESP32
+  xSemaphoreGive(this->parent_->lock_);
+#endif
+}
+
+bool RingBuffer::push(const uint8_t *data, size_t len) {
+  LockGuard lock(this);
+  if (this->size_ + len > this->capacity_ && !this->grow_(this->size_ + len))
+    return false;
+
+  size_t tail = this->head_ + this->size_;
+  if (tail >= this->capacity_)
+    tail -= this->capacity_;
+  // first part up to the end of the storage, rest from the start
+  const size_t first = std::min(len, this->capacity_ - tail);
+  memcpy(&this->data_[tail], data, first);
+  memcpy(&this->data_[0], data + first, len - first);
+  this->size_ += len;
+  return true;
+}
+size_t RingBuffer::peek(uint8_t *out, size_t offset, size_t len) const {
+  LockGuard lock(this);
+  return this->peek_(out, offset, len);
+}
+size_t RingBuffer::peek_(uint8_t *out, size_t offset, size_t len) const {
+  if (offset >= this->size_)
+    return 0;
+  len = std::min(len, this->size_ - offset);
+  size_t start = this->head_ + offset;
+  if (start >= this->capacity_)
+    start -= this->capacity_;
+  const size_t first = std::min(len, this->capacity_ - start);
+  memcpy(out, &this->data_[start], first);
+  memcpy(out + first, &this->data_[0], len - first);
+  return len;
+}
+uint8_t *RingBuffer::view(size_t offset, size_t len, std::vector<uint8_t> &scratch) {
+  LockGuard lock(this);
+  size_t start = this->head_ + offset;
+  if (start >= this->capacity_)
+    start -= this->capacity_;
+  if (start + len <= this->capacity_)
+    return &this->data_[start];
+
+  scratch.resize(len);
+  this->peek_(scratch.data(), offset, len);
+  return scratch.data();
+}
+void RingBuffer::consume(size_t len) {
+  LockGuard lock(this);
+  this->retired_.clear();
+  if (len >= this->size_) {
+    this->head_ = 0;
+    this->size_ = 0;
+    return;
+  }
+  this->head_ += len;
+  if (this->head_ >= this->capacity_)
+    this->head_ -= this->capacity_;
+  this->size_ -= len;
+}
+void RingBuffer::clear() {
+  LockGuard lock(this);
+  this->retired_.clear();
+  this->head_ = 0;
+  this->size_ = 0;
+}
+bool RingBuffer::grow_(size_t min_capacity) {
+  if (min_capacity > this->max_capacity_)
+    return false;
+  size_t new_capacity = this->capacity_;
+  while (new_capacity < min_capacity)
+    new_capacity *= 2;
+  new_capacity = std::min(new_capacity, this->max_capacity_);
+
+  std::unique_ptr<uint8_t[]> new_data(new uint8_t[new_capacity]);
+  this->peek_(new_data.get(), 0, this->size_);
+  // the main loop may be decoding a message from the old storage right now
+  this->retired_.push_back(std::move(this->data_));
+  this->data_ = std::move(new_data);
+  this->capacity_ = new_capacity;
+  this->head_ = 0;
+  return true;
+}
+
+}  // namespace api
+}  // namespace esphome
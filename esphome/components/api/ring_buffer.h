@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#endif
+
+namespace esphome {
+namespace api {
+
+/** Byte ring buffer for data received from API clients.
+ *
+ * Consuming data from the front is O(1), so parsing many pipelined messages doesn't shift the remaining
+ * bytes around. The capacity starts small and is doubled (up to max_capacity) only if more data is
+ * received at once than fits.
+ *
+ * On the ESP32 push() runs in the AsyncTCP task while everything else runs in the main loop, so all
+ * accesses to the storage are guarded by a mutex.
+ */
+class RingBuffer {
+ public:
+  RingBuffer(size_t initial_capacity, size_t max_capacity);
+  RingBuffer(const RingBuffer &) = delete;
+  RingBuffer &operator=(const RingBuffer &) = delete;
+  ~RingBuffer();
+
+  size_t size() const { return this->size_; }
+  bool empty() const { return this->size_ == 0; }
+  size_t capacity() const { return this->capacity_; }
+
+  /// Append data to the back, false if it would exceed the maximum capacity.
+  bool push(const uint8_t *data, size_t len);
+  /// Copy up to len bytes starting offset bytes from the front to out, returns the number of bytes copied.
+  size_t peek(uint8_t *out, size_t offset, size_t len) const;
+  /** Get a contiguous view of len bytes starting offset bytes from the front.
+   *
+   * Points directly into the ring buffer unless the range wraps around the end, then the bytes are copied
+   * to scratch. The view is valid until the next call to consume() or clear(), storage replaced by a
+   * push() in the meantime is only freed then.
+   */
+  uint8_t *view(size_t offset, size_t len, std::vector<uint8_t> &scratch);
+  /// Remove len bytes from the front.
+  void consume(size_t len);
+  void clear();
+
+ protected:
+  /// Holds the mutex while in scope, does nothing on the ESP8266 where TCP callbacks don't preempt the loop.
+  class LockGuard {
+   public:
+    explicit LockGuard(const RingBuffer *parent);
+    ~LockGuard();
+
+   protected:
+    const RingBuffer *parent_;
+  };
+
+  bool grow_(size_t min_capacity);
+  size_t peek_(uint8_t *out, size_t offset, size_t len) const;
+
+  std::unique_ptr<uint8_t[]> data_;
+  /// Storage replaced by grow_(), a view returned by view() may still point into it.
+  std::vector<std::unique_ptr<uint8_t[]>> retired_;
+  size_t capacity_;
+  size_t max_capacity_;
+  /// Index of the first byte.
+  size_t head_{0};
+  size_t size_{0};
+#ifdef ARDUINO_ARCH_ESP32
+  SemaphoreHandle_t lock_;
+#endif
+};
+
+}  // namespace api
+}  // namespace esphome
@@ -1,5 +1,6 @@
 #include "debug_component.h"
 #include "esphome/core/log.h"
+#include "esphome/core/application.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/version.h"
@@ -23,6 +24,10 @@ void DebugComponent::dump_config() {
   ESP_LOGD(TAG, "ESPHome version %s", ESPHOME_VERSION);
   this->free_heap_ = ESP.getFreeHeap();
   ESP_LOGD(TAG, "Free Heap Size: %u bytes", this->free_heap_);
+#ifdef USE_TICKLESS_LOOP
+  ESP_LOGD(TAG, "Tickless Loop: Iterations=%u Skipped=%u Wake-ups=%u", App.get_loop_iterations(),
+           App.get_skipped_loop_iterations(), App.get_loop_wakeups());
+#endif
 
   const char *flash_mode;
   switch (ESP.getFlashChipMode()) {
@@ -8,6 +8,11 @@ namespace display {
 
 static const char *TAG = "display";
 
+/// With more separate areas than this, changed areas are merged with the closest one.
+static const size_t MAX_DIRTY_RECTS = 8;
+/// Number of strings per font whose layout is kept.
+static const size_t TEXT_LAYOUT_CACHE_SIZE = 8;
+
 const Color COLOR_OFF(0, 0, 0, 0);
 const Color COLOR_ON(255, 255, 255, 255);
 
@@ -85,14 +90,10 @@ void HOT DisplayBuffer::line(int x1, int y1, int x2, int y2, Color color) {
   }
 }
 void HOT DisplayBuffer::horizontal_line(int x, int y, int width, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = x; i < x + width; i++)
-    this->draw_pixel_at(i, y, color);
+  this->filled_rectangle(x, y, width, 1, color);
 }
 void HOT DisplayBuffer::vertical_line(int x, int y, int height, Color color) {
-  // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
-  for (int i = y; i < y + height; i++)
-    this->draw_pixel_at(x, i, color);
+  this->filled_rectangle(x, y, 1, height, color);
 }
 void DisplayBuffer::rectangle(int x1, int y1, int width, int height, Color color) {
   this->horizontal_line(x1, y1, width, color);
@@ -100,11 +101,12 @@ void DisplayBuffer::rectangle(int x1, int y1, int width, int height, Color color
   this->vertical_line(x1, y1, height, color);
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
-void DisplayBuffer::filled_rectangle(int x1, int y1, int width, int height, Color color) {
-  // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
-  for (int i = y1; i < y1 + height; i++) {
-    this->horizontal_line(x1, i, width, color);
-  }
+void HOT DisplayBuffer::filled_rectangle(int x1, int y1, int width, int height, Color color) {
+  PixelMapping mapping;
+  if (!this->map_block_(x1, y1, width, height, &mapping))
+    return;
+  this->fill_mapped_rect_(mapping, mapping.x_begin, mapping.x_end, mapping.y_begin, mapping.y_end, color);
+  App.feed_wdt();
 }
 void HOT DisplayBuffer::circle(int center_x, int center_xy, int radius, Color color) {
   int dx = -radius;
@@ -136,10 +138,6 @@ void DisplayBuffer::filled_circle(int center_x, int center_y, int radius, Color
   int e2;
 
   do {
-    this->draw_pixel_at(center_x - dx, center_y + dy, color);
-    this->draw_pixel_at(center_x + dx, center_y + dy, color);
-    this->draw_pixel_at(center_x + dx, center_y - dy, color);
-    this->draw_pixel_at(center_x - dx, center_y - dy, color);
     int hline_width = 2 * (-dx) + 1;
     this->horizontal_line(center_x + dx, center_y + dy, hline_width, color);
     this->horizontal_line(center_x + dx, center_y - dy, hline_width, color);
@@ -157,45 +155,17 @@ void DisplayBuffer::filled_circle(int center_x, int center_y, int radius, Color
 }
 
 void DisplayBuffer::print(int x, int y, Font *font, Color color, TextAlign align, const char *text) {
+  const TextLayout &layout = font->layout(text);
   int x_start, y_start;
-  int width, height;
-  this->get_text_bounds(x, y, text, font, align, &x_start, &y_start, &width, &height);
-
-  int i = 0;
-  int x_at = x_start;
-  while (text[i] != '\0') {
-    int match_length;
-    int glyph_n = font->match_next_glyph(text + i, &match_length);
-    if (glyph_n < 0) {
-      // Unknown char, skip
-      ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", text[i]);
-      if (!font->get_glyphs().empty()) {
-        uint8_t glyph_width = font->get_glyphs()[0].width_;
-        for (int glyph_x = 0; glyph_x < glyph_width; glyph_x++)
-          for (int glyph_y = 0; glyph_y < height; glyph_y++)
-            this->draw_pixel_at(glyph_x + x_at, glyph_y + y_start, color);
-        x_at += glyph_width;
-      }
+  align_text_(x, y, align, layout.width, font->get_height(), font->get_baseline(), &x_start, &y_start);
 
-      i++;
+  for (const auto &item : layout.items) {
+    if (item.glyph < 0) {
+      // Unknown char, drawn as a box
+      this->filled_rectangle(x_start + item.x, y_start, font->get_glyphs()[0].width_, font->get_height(), color);
       continue;
     }
-
-    const Glyph &glyph = font->get_glyphs()[glyph_n];
-    int scan_x1, scan_y1, scan_width, scan_height;
-    glyph.scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
-
-    for (int glyph_x = scan_x1; glyph_x < scan_x1 + scan_width; glyph_x++) {
-      for (int glyph_y = scan_y1; glyph_y < scan_y1 + scan_height; glyph_y++) {
-        if (glyph.get_pixel(glyph_x, glyph_y)) {
-          this->draw_pixel_at(glyph_x + x_at, glyph_y + y_start, color);
-        }
-      }
-    }
-
-    x_at += glyph.width_ + glyph.offset_x_;
-
-    i += match_length;
+    this->draw_glyph_(x_start + item.x, y_start, font->get_glyphs()[item.glyph], color);
   }
 }
 void DisplayBuffer::vprintf_(int x, int y, Font *font, Color color, TextAlign align, const char *format, va_list arg) {
@@ -206,45 +176,283 @@ void DisplayBuffer::vprintf_(int x, int y, Font *font, Color color, TextAlign al
 }
 
 void DisplayBuffer::image(int x, int y, Image *image, Color color_on, Color color_off) {
+  if (image->get_compression() == IMAGE_COMPRESSION_RLE) {
+    this->draw_compressed_image_(x, y, image, color_on, color_off);
+    return;
+  }
+
+  PixelMapping mapping;
   switch (image->get_type()) {
     case IMAGE_TYPE_BINARY:
-      for (int img_x = 0; img_x < image->get_width(); img_x++) {
-        for (int img_y = 0; img_y < image->get_height(); img_y++) {
-          this->draw_pixel_at(x + img_x, y + img_y, image->get_pixel(img_x, img_y) ? color_on : color_off);
-        }
-      }
+      this->draw_bitmap_(x, y, image->get_data_start(), image->get_width(), image->get_height(), color_on, color_off,
+                         false);
       break;
-    case IMAGE_TYPE_GRAYSCALE:
-      for (int img_x = 0; img_x < image->get_width(); img_x++) {
-        for (int img_y = 0; img_y < image->get_height(); img_y++) {
-          this->draw_pixel_at(x + img_x, y + img_y, image->get_grayscale_pixel(img_x, img_y));
-        }
-      }
+    case IMAGE_TYPE_GRAYSCALE: {
+      if (!this->map_block_(x, y, image->get_width(), image->get_height(), &mapping))
+        break;
+      const uint8_t *data = image->get_data_start();
+      const int width = image->get_width();
+      mapping.for_each([this, data, width](int img_x, int img_y, int abs_x, int abs_y) {
+        const uint8_t gray = pgm_read_byte(data + img_x + img_y * width);
+        this->draw_absolute_pixel_internal(abs_x, abs_y, Color(gray, gray, gray, gray));
+      });
+      App.feed_wdt();
       break;
-    case IMAGE_TYPE_RGB24:
-      for (int img_x = 0; img_x < image->get_width(); img_x++) {
-        for (int img_y = 0; img_y < image->get_height(); img_y++) {
-          this->draw_pixel_at(x + img_x, y + img_y, image->get_color_pixel(img_x, img_y));
-        }
+    }
+    case IMAGE_TYPE_RGB24: {
+      if (!this->map_block_(x, y, image->get_width(), image->get_height(), &mapping))
+        break;
+      const uint8_t *data = image->get_data_start();
+      const int width = image->get_width();
+      mapping.for_each([this, data, width](int img_x, int img_y, int abs_x, int abs_y) {
+        const uint8_t *pixel = data + (img_x + img_y * width) * 3;
+        this->draw_absolute_pixel_internal(
+            abs_x, abs_y, Color(pgm_read_byte(pixel), pgm_read_byte(pixel + 1), pgm_read_byte(pixel + 2)));
+      });
+      App.feed_wdt();
+      break;
+    }
+    case IMAGE_TYPE_RGB565: {
+      Rgb565Blit blit{};
+      if (!this->map_block_(x, y, image->get_width(), image->get_height(), &blit.mapping))
+        break;
+      blit.data = image->get_data_start();
+      blit.stride = image->get_width() * 2u;
+      blit.transparent = image->has_transparency();
+      this->draw_absolute_rgb565_bitmap_internal(blit);
+      App.feed_wdt();
+      break;
+    }
+  }
+}
+void DisplayBuffer::draw_compressed_image_(int x, int y, Image *image, Color color_on, Color color_off) {
+  PixelMapping mapping;
+  if (!this->map_block_(x, y, image->get_width(), image->get_height(), &mapping))
+    return;
+  const int width = image->get_width();
+
+  if (image->get_type() == IMAGE_TYPE_BINARY) {
+    // decode one row at a time and draw it as a one row bitmap
+    const uint32_t stride = (width + 7u) / 8u;
+    std::vector<uint8_t> row(stride);
+    RunLengthDecoder decoder(image->get_data_start(), 1);
+    decoder.skip(mapping.y_begin * stride);
+    BitmapBlit blit{};
+    blit.mapping = mapping;
+    blit.mapping.y_begin = 0;
+    blit.mapping.y_end = 1;
+    blit.data = row.data();
+    blit.stride = stride;
+    blit.color_on = color_on;
+    blit.color_off = color_off;
+    blit.transparent = false;
+    for (int img_y = mapping.y_begin; img_y < mapping.y_end; img_y++) {
+      for (auto &byte : row)
+        byte = pgm_read_byte(decoder.next());
+      blit.mapping.origin_x = mapping.origin_x + img_y * mapping.row_dx;
+      blit.mapping.origin_y = mapping.origin_y + img_y * mapping.row_dy;
+      this->draw_absolute_bitmap_internal(blit);
+    }
+    App.feed_wdt();
+    return;
+  }
+
+  if (image->get_type() == IMAGE_TYPE_RGB565) {
+    // decode one row at a time, so that it can be copied to 16 bit buffers like an uncompressed one
+    std::vector<uint8_t> row(width * 2u);
+    RunLengthDecoder decoder(image->get_data_start(), 2);
+    decoder.skip(mapping.y_begin * width);
+    Rgb565Blit blit{};
+    blit.mapping = mapping;
+    blit.mapping.y_begin = 0;
+    blit.mapping.y_end = 1;
+    blit.data = row.data();
+    blit.stride = row.size();
+    blit.transparent = image->has_transparency();
+    for (int img_y = mapping.y_begin; img_y < mapping.y_end; img_y++) {
+      for (int i = 0; i < width; i++) {
+        const uint8_t *pixel = decoder.next();
+        row[i * 2] = pgm_read_byte(pixel);
+        row[i * 2 + 1] = pgm_read_byte(pixel + 1);
       }
+      blit.mapping.origin_x = mapping.origin_x + img_y * mapping.row_dx;
+      blit.mapping.origin_y = mapping.origin_y + img_y * mapping.row_dy;
+      this->draw_absolute_rgb565_bitmap_internal(blit);
+    }
+    App.feed_wdt();
+    return;
+  }
+
+  const bool rgb = image->get_type() == IMAGE_TYPE_RGB24;
+  RunLengthDecoder decoder(image->get_data_start(), image->get_element_size());
+  decoder.skip(mapping.y_begin * width);
+  for (int img_y = mapping.y_begin; img_y < mapping.y_end; img_y++) {
+    decoder.skip(mapping.x_begin);
+    int abs_x = mapping.origin_x + mapping.x_begin * mapping.column_dx + img_y * mapping.row_dx;
+    int abs_y = mapping.origin_y + mapping.x_begin * mapping.column_dy + img_y * mapping.row_dy;
+    for (int img_x = mapping.x_begin; img_x < mapping.x_end; img_x++) {
+      const uint8_t *pixel = decoder.next();
+      Color color;
+      if (rgb) {
+        color = Color(pgm_read_byte(pixel), pgm_read_byte(pixel + 1), pgm_read_byte(pixel + 2));
+      } else {
+        const uint8_t gray = pgm_read_byte(pixel);
+        color = Color(gray, gray, gray, gray);
+      }
+      this->draw_absolute_pixel_internal(abs_x, abs_y, color);
+      abs_x += mapping.column_dx;
+      abs_y += mapping.column_dy;
+    }
+    decoder.skip(width - mapping.x_end);
+  }
+  App.feed_wdt();
+}
+bool DisplayBuffer::map_block_(int x, int y, int width, int height, PixelMapping *mapping) {
+  mapping->x_begin = std::max(0, -x);
+  mapping->x_end = std::min(width, this->get_width() - x);
+  mapping->y_begin = std::max(0, -y);
+  mapping->y_end = std::min(height, this->get_height() - y);
+  if (mapping->x_begin >= mapping->x_end || mapping->y_begin >= mapping->y_end)
+    return false;
+
+  // same transformation as in draw_pixel_at(), for the origin and one step along a row or column of the block
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+    default:
+      mapping->origin_x = x;
+      mapping->origin_y = y;
+      mapping->column_dx = 1;
+      mapping->column_dy = 0;
+      mapping->row_dx = 0;
+      mapping->row_dy = 1;
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      mapping->origin_x = this->get_width_internal() - y - 1;
+      mapping->origin_y = x;
+      mapping->column_dx = 0;
+      mapping->column_dy = 1;
+      mapping->row_dx = -1;
+      mapping->row_dy = 0;
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      mapping->origin_x = this->get_width_internal() - x - 1;
+      mapping->origin_y = this->get_height_internal() - y - 1;
+      mapping->column_dx = -1;
+      mapping->column_dy = 0;
+      mapping->row_dx = 0;
+      mapping->row_dy = -1;
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      mapping->origin_x = y;
+      mapping->origin_y = this->get_height_internal() - x - 1;
+      mapping->column_dx = 0;
+      mapping->column_dy = -1;
+      mapping->row_dx = 1;
+      mapping->row_dy = 0;
       break;
   }
+  return true;
+}
+void DisplayBuffer::fill_mapped_rect_(const PixelMapping &mapping, int x_begin, int x_end, int y_begin, int y_end,
+                                      Color color) {
+  // the corners in absolute coordinates
+  const int ax1 = mapping.origin_x + x_begin * mapping.column_dx + y_begin * mapping.row_dx;
+  const int ay1 = mapping.origin_y + x_begin * mapping.column_dy + y_begin * mapping.row_dy;
+  const int ax2 = mapping.origin_x + (x_end - 1) * mapping.column_dx + (y_end - 1) * mapping.row_dx;
+  const int ay2 = mapping.origin_y + (x_end - 1) * mapping.column_dy + (y_end - 1) * mapping.row_dy;
+  this->fill_absolute_rect_internal(std::min(ax1, ax2), std::min(ay1, ay2), abs(ax2 - ax1) + 1, abs(ay2 - ay1) + 1,
+                                    color);
+}
+void DisplayBuffer::draw_glyph_(int x, int y, const Glyph &glyph, Color color) {
+  if (glyph.format_ == GLYPH_FORMAT_BITMAP) {
+    this->draw_bitmap_(x + glyph.offset_x_, y + glyph.offset_y_, glyph.data_, glyph.width_, glyph.height_, color,
+                       COLOR_OFF, true);
+    return;
+  }
+  if (glyph.format_ == GLYPH_FORMAT_ALPHA2 || glyph.format_ == GLYPH_FORMAT_ALPHA4) {
+    AlphaBlit blit{};
+    if (!this->map_block_(x + glyph.offset_x_, y + glyph.offset_y_, glyph.width_, glyph.height_, &blit.mapping))
+      return;
+    blit.data = glyph.data_;
+    blit.bits_per_pixel = glyph.get_bits_per_pixel();
+    blit.stride = (glyph.width_ * blit.bits_per_pixel + 7u) / 8u;
+    blit.color = color;
+    const int max_level = (1 << blit.bits_per_pixel) - 1;
+    for (int level = 0; level <= max_level; level++)
+      blit.alpha[level] = (level * 32 + max_level / 2) / max_level;
+    this->draw_absolute_alpha_bitmap_internal(blit);
+    App.feed_wdt();
+    return;
+  }
+
+  PixelMapping mapping;
+  if (!this->map_block_(x + glyph.offset_x_, y + glyph.offset_y_, glyph.width_, glyph.height_, &mapping))
+    return;
+  // every run (repeated over a group of rows) is one rectangle
+  glyph.for_each_run_([this, &mapping, color](int run_x, int run_y, int length, int rows) {
+    const int x_begin = std::max(run_x, mapping.x_begin);
+    const int x_end = std::min(run_x + length, mapping.x_end);
+    const int y_begin = std::max(run_y, mapping.y_begin);
+    const int y_end = std::min(run_y + rows, mapping.y_end);
+    if (x_begin < x_end && y_begin < y_end)
+      this->fill_mapped_rect_(mapping, x_begin, x_end, y_begin, y_end, color);
+  });
+  App.feed_wdt();
+}
+void DisplayBuffer::draw_bitmap_(int x, int y, const uint8_t *data, int width, int height, Color color_on,
+                                 Color color_off, bool transparent) {
+  BitmapBlit blit{};
+  if (!this->map_block_(x, y, width, height, &blit.mapping))
+    return;
+  blit.data = data;
+  blit.stride = (width + 7u) / 8u;
+  blit.color_on = color_on;
+  blit.color_off = color_off;
+  blit.transparent = transparent;
+  this->draw_absolute_bitmap_internal(blit);
+  App.feed_wdt();
+}
+void DisplayBuffer::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  for (int i = y; i < y + height; i++) {
+    for (int j = x; j < x + width; j++)
+      this->draw_absolute_pixel_internal(j, i, color);
+  }
+}
+void DisplayBuffer::draw_absolute_bitmap_internal(const BitmapBlit &blit) {
+  blit.for_each_pixel([this, &blit](int x, int y, bool on) {
+    this->draw_absolute_pixel_internal(x, y, on ? blit.color_on : blit.color_off);
+  });
+}
+
+void DisplayBuffer::draw_absolute_alpha_bitmap_internal(const AlphaBlit &blit) {
+  blit.for_each_pixel([this, &blit](int x, int y, uint8_t alpha) {
+    if (alpha >= 16)
+      this->draw_absolute_pixel_internal(x, y, blit.color);
+  });
+}
+void DisplayBuffer::draw_absolute_rgb565_bitmap_internal(const Rgb565Blit &blit) {
+  blit.for_each_pixel([this](int x, int y, uint16_t color565) {
+    this->draw_absolute_pixel_internal(x, y, ColorUtil::rgb565_to_color(color565));
+  });
 }
 
 void DisplayBuffer::get_text_bounds(int x, int y, const char *text, Font *font, TextAlign align, int *x1, int *y1,
                                     int *width, int *height) {
   int x_offset, baseline;
   font->measure(text, width, &x_offset, &baseline, height);
-
+  align_text_(x, y, align, *width, *height, baseline, x1, y1);
+}
+void DisplayBuffer::align_text_(int x, int y, TextAlign align, int width, int height, int baseline, int *x1,
+                                int *y1) {
   auto x_align = TextAlign(int(align) & 0x18);
   auto y_align = TextAlign(int(align) & 0x07);
 
   switch (x_align) {
     case TextAlign::RIGHT:
-      *x1 = x - *width;
+      *x1 = x - width;
       break;
     case TextAlign::CENTER_HORIZONTAL:
-      *x1 = x - (*width) / 2;
+      *x1 = x - width / 2;
       break;
     case TextAlign::LEFT:
     default:
@@ -255,13 +463,13 @@ void DisplayBuffer::get_text_bounds(int x, int y, const char *text, Font *font,
 
   switch (y_align) {
     case TextAlign::BOTTOM:
-      *y1 = y - *height;
+      *y1 = y - height;
       break;
     case TextAlign::BASELINE:
       *y1 = y - baseline;
       break;
     case TextAlign::CENTER_VERTICAL:
-      *y1 = y - (*height) / 2;
+      *y1 = y - height / 2;
       break;
     case TextAlign::TOP:
     default:
@@ -326,6 +534,108 @@ void DisplayBuffer::do_update_() {
     (*this->writer_)(*this);
   }
 }
+void DisplayBuffer::init_dirty_tiles_(uint8_t bits_per_pixel, uint8_t tile_width, uint8_t tile_height,
+                                      uint8_t rows_per_line) {
+  this->tile_bits_per_pixel_ = bits_per_pixel;
+  this->tile_width_ = tile_width;
+  this->tile_height_ = tile_height;
+  this->tile_rows_per_line_ = rows_per_line;
+  const int tiles_x = (this->get_width_internal() + tile_width - 1) / tile_width;
+  const int tiles_y = (this->get_height_internal() + tile_height - 1) / tile_height;
+  this->tile_hashes_.assign(tiles_x * tiles_y, 0);
+  this->tile_hashes_valid_ = false;
+}
+const std::vector<Rect> &DisplayBuffer::find_dirty_rects_() {
+  this->dirty_rects_.clear();
+  const int height = this->get_height_internal();
+  if (this->tile_hashes_.empty()) {
+    this->add_dirty_rect_(0, 0, this->get_width_internal(), height);
+    return this->dirty_rects_;
+  }
+
+  const int tiles_x = (this->get_width_internal() + this->tile_width_ - 1) / this->tile_width_;
+  const int tiles_y = (height + this->tile_height_ - 1) / this->tile_height_;
+  for (int tile_y = 0; tile_y < tiles_y; tile_y++) {
+    const int y = tile_y * this->tile_height_;
+    const int h = std::min(int(this->tile_height_), height - y);
+    for (int tile_x = 0; tile_x < tiles_x; tile_x++) {
+      if (!this->tile_changed_(tile_x, tile_y))
+        continue;
+      // send runs of changed tiles as one rectangle
+      const int begin = tile_x;
+      while (++tile_x < tiles_x && this->tile_changed_(tile_x, tile_y)) {
+      }
+      const int x = begin * this->tile_width_;
+      const int w = std::min(tile_x * this->tile_width_, this->get_width_internal()) - x;
+      this->add_dirty_rect_(x, y, w, h);
+    }
+  }
+  this->tile_hashes_valid_ = true;
+  ESP_LOGVV(TAG, "%zu changed areas", this->dirty_rects_.size());
+  return this->dirty_rects_;
+}
+bool HOT DisplayBuffer::tile_changed_(int tile_x, int tile_y) {
+  const int width = this->get_width_internal();
+  const int x = tile_x * this->tile_width_;
+  const int y = tile_y * this->tile_height_;
+  const uint32_t stride = (width * this->tile_bits_per_pixel_ + 7u) / 8u;
+  const uint32_t offset = (x * this->tile_bits_per_pixel_) / 8u;
+  const uint32_t length = (std::min(int(this->tile_width_), width - x) * this->tile_bits_per_pixel_ + 7u) / 8u;
+  const int line_begin = y / this->tile_rows_per_line_;
+  const int y_end = std::min(y + this->tile_height_, this->get_height_internal());
+  const int line_end = (y_end + this->tile_rows_per_line_ - 1) / this->tile_rows_per_line_;
+
+  // FNV-1a
+  uint32_t hash = 2166136261UL;
+  for (int line = line_begin; line < line_end; line++) {
+    const uint8_t *data = this->buffer_ + line * stride + offset;
+    for (uint32_t i = 0; i < length; i++) {
+      hash ^= data[i];
+      hash *= 16777619UL;
+    }
+  }
+
+  uint32_t &previous = this->tile_hashes_[tile_y * ((width + this->tile_width_ - 1) / this->tile_width_) + tile_x];
+  const bool changed = !this->tile_hashes_valid_ || previous != hash;
+  previous = hash;
+  return changed;
+}
+void DisplayBuffer::add_dirty_rect_(int x, int y, int w, int h) {
+  for (auto &rect : this->dirty_rects_) {
+    if (rect.x == x && rect.w == w && rect.y + rect.h == y) {
+      // continues the area of the tile row above
+      rect.h += h;
+      return;
+    }
+    if (x >= rect.x && x + w <= rect.x + rect.w && y >= rect.y && y + h <= rect.y + rect.h)
+      return;
+  }
+  if (this->dirty_rects_.size() < MAX_DIRTY_RECTS) {
+    this->dirty_rects_.push_back(Rect{int16_t(x), int16_t(y), int16_t(w), int16_t(h)});
+    return;
+  }
+
+  // every area costs a few commands, rather send some unchanged pixels along with the one that grows the least
+  Rect *best = nullptr;
+  int best_growth = 0;
+  for (auto &rect : this->dirty_rects_) {
+    const int x1 = std::min(x, int(rect.x));
+    const int y1 = std::min(y, int(rect.y));
+    const int x2 = std::max(x + w, rect.x + rect.w);
+    const int y2 = std::max(y + h, rect.y + rect.h);
+    const int growth = (x2 - x1) * (y2 - y1) - rect.w * rect.h;
+    if (best == nullptr || growth < best_growth) {
+      best = &rect;
+      best_growth = growth;
+    }
+  }
+  const int x1 = std::min(x, int(best->x));
+  const int y1 = std::min(y, int(best->y));
+  best->w = std::max(x + w, best->x + best->w) - x1;
+  best->h = std::max(y + h, best->y + best->h) - y1;
+  best->x = x1;
+  best->y = y1;
+}
 #ifdef USE_TIME
 void DisplayBuffer::strftime(int x, int y, Font *font, Color color, TextAlign align, const char *format,
                              time::ESPTime time) {
@@ -346,23 +656,52 @@ void DisplayBuffer::strftime(int x, int y, Font *font, const char *format, time:
 #endif
 
 Glyph::Glyph(const char *a_char, const uint8_t *data_start, uint32_t offset, int offset_x, int offset_y, int width,
-             int height)
+             int height, GlyphFormat format)
     : char_(a_char),
       data_(data_start + offset),
       offset_x_(offset_x),
       offset_y_(offset_y),
       width_(width),
-      height_(height) {}
+      height_(height),
+      format_(format) {}
 bool Glyph::get_pixel(int x, int y) const {
   const int x_data = x - this->offset_x_;
   const int y_data = y - this->offset_y_;
   if (x_data < 0 || x_data >= this->width_ || y_data < 0 || y_data >= this->height_)
     return false;
+  if (this->format_ == GLYPH_FORMAT_RUN_LENGTH) {
+    bool found = false;
+    this->for_each_run_([x_data, y_data, &found](int run_x, int run_y, int length, int rows) {
+      if (y_data >= run_y && y_data < run_y + rows && x_data >= run_x && x_data < run_x + length)
+        found = true;
+    });
+    return found;
+  }
+  if (this->format_ == GLYPH_FORMAT_ALPHA2 || this->format_ == GLYPH_FORMAT_ALPHA4) {
+    // pixels with at least half coverage count as set
+    const uint8_t bits = this->get_bits_per_pixel();
+    const uint32_t bit = x_data * bits;
+    const uint8_t byte = pgm_read_byte(this->data_ + y_data * ((this->width_ * bits + 7u) / 8u) + bit / 8u);
+    const uint8_t level = (byte >> (8 - bits - (bit % 8u))) & ((1 << bits) - 1);
+    return level * 2 >= (1 << bits);
+  }
   const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
   const uint32_t pos = x_data + y_data * width_8;
   return pgm_read_byte(this->data_ + (pos / 8u)) & (0x80 >> (pos % 8u));
 }
 const char *Glyph::get_char() const { return this->char_; }
+uint8_t Glyph::get_bits_per_pixel() const {
+  switch (this->format_) {
+    case GLYPH_FORMAT_ALPHA2:
+      return 2;
+    case GLYPH_FORMAT_ALPHA4:
+      return 4;
+    case GLYPH_FORMAT_BITMAP:
+    case GLYPH_FORMAT_RUN_LENGTH:
+    default:
+      return 1;
+  }
+}
 bool Glyph::compare_to(const char *str) const {
   // 1 -> this->char_
   // 2 -> str
@@ -411,8 +750,35 @@ int Font::match_next_glyph(const char *str, int *match_length) {
   return lo;
 }
 void Font::measure(const char *str, int *width, int *x_offset, int *baseline, int *height) {
+  const TextLayout &layout = this->layout(str);
   *baseline = this->baseline_;
   *height = this->bottom_;
+  *x_offset = layout.x_offset;
+  *width = layout.width;
+}
+const TextLayout &Font::layout(const char *str) {
+  TextLayout *entry = nullptr;
+  for (auto &cached : this->layout_cache_) {
+    if (cached.text == str) {
+      entry = &cached;
+      break;
+    }
+    if (entry == nullptr || cached.last_used < entry->last_used)
+      entry = &cached;
+  }
+  if (entry == nullptr || entry->text != str) {
+    if (this->layout_cache_.size() < TEXT_LAYOUT_CACHE_SIZE) {
+      this->layout_cache_.emplace_back();
+      entry = &this->layout_cache_.back();
+    }
+    this->layout_(str, entry);
+  }
+  entry->last_used = ++this->layout_counter_;
+  return *entry;
+}
+void Font::layout_(const char *str, TextLayout *layout) {
+  layout->text = str;
+  layout->items.clear();
   int i = 0;
   int min_x = 0;
   bool has_char = false;
@@ -422,13 +788,17 @@ void Font::measure(const char *str, int *width, int *x_offset, int *baseline, in
     int glyph_n = this->match_next_glyph(str + i, &match_length);
     if (glyph_n < 0) {
       // Unknown char, skip
-      if (!this->get_glyphs().empty())
+      ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", str[i]);
+      if (!this->get_glyphs().empty()) {
+        layout->items.push_back({-1, int16_t(x)});
         x += this->get_glyphs()[0].width_;
+      }
       i++;
       continue;
     }
 
     const Glyph &glyph = this->glyphs_[glyph_n];
+    layout->items.push_back({int16_t(glyph_n), int16_t(x)});
     if (!has_char)
       min_x = glyph.offset_x_;
     else
@@ -438,78 +808,113 @@ void Font::measure(const char *str, int *width, int *x_offset, int *baseline, in
     i += match_length;
     has_char = true;
   }
-  *x_offset = min_x;
-  *width = x - min_x;
+  layout->x_offset = min_x;
+  layout->width = x - min_x;
 }
 const std::vector<Glyph> &Font::get_glyphs() const { return this->glyphs_; }
 Font::Font(std::vector<Glyph> &&glyphs, int baseline, int bottom)
     : glyphs_(std::move(glyphs)), baseline_(baseline), bottom_(bottom) {}
 
+void RunLengthDecoder::skip(uint32_t count) {
+  while (count > 0) {
+    if (this->remaining_ == 0)
+      this->start_run_();
+    const uint8_t skipped = std::min<uint32_t>(count, this->remaining_);
+    this->remaining_ -= skipped;
+    count -= skipped;
+    if (!this->repeat_)
+      this->pos_ += skipped * this->element_size_;
+    else if (this->remaining_ == 0)
+      this->pos_ += this->element_size_;
+  }
+}
+
+const uint8_t *Image::get_element_(uint32_t index) const {
+  const uint8_t element_size = this->get_element_size();
+  if (this->compression_ == IMAGE_COMPRESSION_NONE)
+    return this->get_data_start() + index * element_size;
+  RunLengthDecoder decoder(this->get_data_start(), element_size);
+  decoder.skip(index);
+  return decoder.next();
+}
 bool Image::get_pixel(int x, int y) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return false;
   const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
   const uint32_t pos = x + y * width_8;
-  return pgm_read_byte(this->data_start_ + (pos / 8u)) & (0x80 >> (pos % 8u));
+  return pgm_read_byte(this->get_element_(pos / 8u)) & (0x80 >> (pos % 8u));
 }
 Color Image::get_color_pixel(int x, int y) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return 0;
-  const uint32_t pos = (x + y * this->width_) * 3;
-  const uint32_t color32 = (pgm_read_byte(this->data_start_ + pos + 2) << 0) |
-                           (pgm_read_byte(this->data_start_ + pos + 1) << 8) |
-                           (pgm_read_byte(this->data_start_ + pos + 0) << 16);
+  const uint8_t *pixel = this->get_element_(x + y * this->width_);
+  if (this->type_ == IMAGE_TYPE_RGB565) {
+    const uint16_t color565 = (pgm_read_byte(pixel) << 8) | pgm_read_byte(pixel + 1);
+    if (this->transparency_ && color565 == IMAGE_TRANSPARENT_565)
+      return 0;
+    return ColorUtil::rgb565_to_color(color565);
+  }
+  const uint32_t color32 =
+      (pgm_read_byte(pixel + 2) << 0) | (pgm_read_byte(pixel + 1) << 8) | (pgm_read_byte(pixel + 0) << 16);
   return Color(color32);
 }
 Color Image::get_grayscale_pixel(int x, int y) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return 0;
-  const uint32_t pos = (x + y * this->width_);
-  const uint8_t gray = pgm_read_byte(this->data_start_ + pos);
+  const uint8_t gray = pgm_read_byte(this->get_element_(x + y * this->width_));
   return Color(gray | gray << 8 | gray << 16 | gray << 24);
 }
 int Image::get_width() const { return this->width_; }
 int Image::get_height() const { return this->height_; }
 ImageType Image::get_type() const { return this->type_; }
-Image::Image(const uint8_t *data_start, int width, int height, ImageType type)
-    : width_(width), height_(height), type_(type), data_start_(data_start) {}
-
-bool Animation::get_pixel(int x, int y) const {
-  if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
-    return false;
-  const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
-  const uint32_t frame_index = this->height_ * width_8 * this->current_frame_;
-  if (frame_index >= this->width_ * this->height_ * this->animation_frame_count_)
-    return false;
-  const uint32_t pos = x + y * width_8 + frame_index;
-  return pgm_read_byte(this->data_start_ + (pos / 8u)) & (0x80 >> (pos % 8u));
-}
-Color Animation::get_color_pixel(int x, int y) const {
-  if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
-    return 0;
-  const uint32_t frame_index = this->width_ * this->height_ * this->current_frame_;
-  if (frame_index >= this->width_ * this->height_ * this->animation_frame_count_)
-    return 0;
-  const uint32_t pos = (x + y * this->width_ + frame_index) * 3;
-  const uint32_t color32 = (pgm_read_byte(this->data_start_ + pos + 2) << 0) |
-                           (pgm_read_byte(this->data_start_ + pos + 1) << 8) |
-                           (pgm_read_byte(this->data_start_ + pos + 0) << 16);
-  return Color(color32);
-}
-Color Animation::get_grayscale_pixel(int x, int y) const {
-  if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
-    return 0;
-  const uint32_t frame_index = this->width_ * this->height_ * this->current_frame_;
-  if (frame_index >= this->width_ * this->height_ * this->animation_frame_count_)
-    return 0;
-  const uint32_t pos = (x + y * this->width_ + frame_index);
-  const uint8_t gray = pgm_read_byte(this->data_start_ + pos);
-  return Color(gray | gray << 8 | gray << 16 | gray << 24);
+ImageCompression Image::get_compression() const { return this->compression_; }
+uint8_t Image::get_element_size() const {
+  switch (this->type_) {
+    case IMAGE_TYPE_RGB24:
+      return 3;
+    case IMAGE_TYPE_RGB565:
+      return 2;
+    default:
+      return 1;
+  }
 }
-Animation::Animation(const uint8_t *data_start, int width, int height, uint32_t animation_frame_count, ImageType type)
-    : Image(data_start, width, height, type), animation_frame_count_(animation_frame_count) {
+void Image::set_transparency(bool transparency) { this->transparency_ = transparency; }
+bool Image::has_transparency() const { return this->transparency_; }
+const uint8_t *Image::get_data_start() const { return this->data_start_; }
+Image::Image(const uint8_t *data_start, int width, int height, ImageType type, ImageCompression compression)
+    : width_(width), height_(height), type_(type), compression_(compression), data_start_(data_start) {}
+
+Animation::Animation(const uint8_t *data_start, int width, int height, uint32_t animation_frame_count, ImageType type,
+                     ImageCompression compression)
+    : Image(data_start, width, height, type, compression), animation_frame_count_(animation_frame_count) {
   current_frame_ = 0;
 }
+const uint8_t *Animation::get_data_start() const {
+  if (this->compression_ == IMAGE_COMPRESSION_RLE) {
+    // the frames have different sizes, their offsets are at the start of the data
+    const uint8_t *offset = this->data_start_ + this->current_frame_ * 4;
+    return this->data_start_ + (pgm_read_byte(offset) | pgm_read_byte(offset + 1) << 8 |
+                                pgm_read_byte(offset + 2) << 16 | uint32_t(pgm_read_byte(offset + 3)) << 24);
+  }
+
+  uint32_t frame_size;
+  switch (this->type_) {
+    case IMAGE_TYPE_BINARY:
+      frame_size = (this->width_ + 7u) / 8u * this->height_;
+      break;
+    case IMAGE_TYPE_GRAYSCALE:
+      frame_size = this->width_ * this->height_;
+      break;
+    case IMAGE_TYPE_RGB565:
+      frame_size = this->width_ * this->height_ * 2;
+      break;
+    case IMAGE_TYPE_RGB24:
+    default:
+      frame_size = this->width_ * this->height_ * 3;
+      break;
+  }
+  return this->data_start_ + frame_size * this->current_frame_;
+}
 int Animation::get_animation_frame_count() const { return this->animation_frame_count_; }
 int Animation::get_current_frame() const { return this->current_frame_; }
 void Animation::next_frame() {
@@ -68,7 +68,45 @@ extern const Color COLOR_OFF;
 /// Turn the pixel ON.
 extern const Color COLOR_ON;
 
-enum ImageType { IMAGE_TYPE_BINARY = 0, IMAGE_TYPE_GRAYSCALE = 1, IMAGE_TYPE_RGB24 = 2 };
+/** How the pixels of an image are stored.
+ *
+ * - BINARY: rows of (width + 7) / 8 bytes, the most significant bit first.
+ * - GRAYSCALE: one byte per pixel.
+ * - RGB24: three bytes per pixel, red first.
+ * - RGB565: two bytes per pixel, big-endian like in the buffers of 16 bit color displays. In images with
+ *   transparency, IMAGE_TRANSPARENT_565 marks the transparent pixels.
+ */
+enum ImageType { IMAGE_TYPE_BINARY = 0, IMAGE_TYPE_GRAYSCALE = 1, IMAGE_TYPE_RGB24 = 2, IMAGE_TYPE_RGB565 = 3 };
+
+/// The color of transparent pixels in IMAGE_TYPE_RGB565 images, opaque pixels of this color are stored as black.
+static const uint16_t IMAGE_TRANSPARENT_565 = 0x0020;
+
+/** How the pixel data of an image is stored.
+ *
+ * - NONE: the raw pixels.
+ * - RLE: the pixels split into runs, row by row (like PackBits). Every run starts with a control byte, 0-127 for
+ *   1-128 elements which follow literally, 128-255 for one element which is repeated 2-129 times. An element is a
+ *   pixel (3 bytes for RGB24, 2 for RGB565), or for binary images one byte of a row. Compressed animations start
+ *   with the offsets of all frames in the data as 32 bit little-endian numbers.
+ */
+enum ImageCompression { IMAGE_COMPRESSION_NONE = 0, IMAGE_COMPRESSION_RLE = 1 };
+
+/** How the pixels of a glyph are stored.
+ *
+ * - BITMAP: rows of (width + 7) / 8 bytes, the most significant bit first.
+ * - RUN_LENGTH: the horizontal runs of set pixels, row by row. Each group of identical rows starts with a byte
+ *   holding the number of rows minus one in the high and the number of runs in the low nibble. Every run is a byte
+ *   with the number of pixels skipped since the end of the previous run in the high and the length of the run in
+ *   the low nibble, or if the high nibble is 0xF, the byte 0xF0 followed by the skip and the length as whole bytes.
+ * - ALPHA2/ALPHA4: anti-aliased, rows of (width * bits + 7) / 8 bytes with the coverage of each pixel in 2 or 4 bits,
+ *   the first pixel in the most significant bits.
+ */
+enum GlyphFormat {
+  GLYPH_FORMAT_BITMAP = 0,
+  GLYPH_FORMAT_RUN_LENGTH = 1,
+  GLYPH_FORMAT_ALPHA2 = 2,
+  GLYPH_FORMAT_ALPHA4 = 3,
+};
 
 enum DisplayRotation {
   DISPLAY_ROTATION_0_DEGREES = 0,
@@ -78,12 +116,134 @@ enum DisplayRotation {
 };
 
 class Font;
+class Glyph;
 class Image;
 class DisplayBuffer;
 class DisplayPage;
 
 using display_writer_t = std::function<void(DisplayBuffer &)>;
 
+/// An area of the display in pixels, in the coordinates of the buffer (without rotation).
+struct Rect {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+};
+
+/** Where the pixels of a block (like an image or a glyph) go in the buffer, with the rotation of the display resolved.
+ *
+ * Pixel [x, y] of the block goes to the absolute position [origin_x + x * column_dx + y * row_dx,
+ * origin_y + x * column_dy + y * row_dy]. Only the part [x_begin, x_end) x [y_begin, y_end) is on the screen.
+ */
+struct PixelMapping {
+  int x_begin;
+  int x_end;
+  int y_begin;
+  int y_end;
+  int origin_x;
+  int origin_y;
+  int column_dx;
+  int column_dy;
+  int row_dx;
+  int row_dy;
+
+  /// Call f(x, y, absolute_x, absolute_y) for every visible pixel of the block, row by row.
+  template<typename F> void for_each(F &&f) const {
+    for (int y = this->y_begin; y < this->y_end; y++) {
+      int abs_x = this->origin_x + this->x_begin * this->column_dx + y * this->row_dx;
+      int abs_y = this->origin_y + this->x_begin * this->column_dy + y * this->row_dy;
+      for (int x = this->x_begin; x < this->x_end; x++) {
+        f(x, y, abs_x, abs_y);
+        abs_x += this->column_dx;
+        abs_y += this->column_dy;
+      }
+    }
+  }
+};
+
+/// A 1 bit per pixel bitmap to draw, stored in PROGMEM as rows of `stride` bytes with the most significant bit first.
+struct BitmapBlit {
+  PixelMapping mapping;
+  const uint8_t *data;
+  uint32_t stride;
+  Color color_on;
+  Color color_off;
+  /// Leave the pixels which are off untouched, like for text.
+  bool transparent;
+
+  /// Call f(absolute_x, absolute_y, on) for every visible pixel which has to be drawn.
+  template<typename F> void for_each_pixel(F &&f) const {
+    uint8_t bits = 0;
+    this->mapping.for_each([&](int x, int y, int abs_x, int abs_y) {
+      if (x == this->mapping.x_begin || (x & 7) == 0)
+        bits = pgm_read_byte(this->data + y * this->stride + x / 8);
+      const bool on = bits & (0x80 >> (x & 7));
+      if (on || !this->transparent)
+        f(abs_x, abs_y, on);
+    });
+  }
+};
+
+/// An anti-aliased glyph to draw, see GLYPH_FORMAT_ALPHA2 and GLYPH_FORMAT_ALPHA4.
+struct AlphaBlit {
+  PixelMapping mapping;
+  const uint8_t *data;
+  uint32_t stride;
+  uint8_t bits_per_pixel;
+  Color color;
+  /// Opacity of the color for each coverage level, from 0 (transparent) to 32 (opaque).
+  uint8_t alpha[16];
+
+  /// Call f(absolute_x, absolute_y, alpha) for every visible pixel which isn't transparent.
+  template<typename F> void for_each_pixel(F &&f) const {
+    const uint8_t mask = (1 << this->bits_per_pixel) - 1;
+    uint8_t bits = 0;
+    this->mapping.for_each([&](int x, int y, int abs_x, int abs_y) {
+      const uint32_t bit = x * this->bits_per_pixel;
+      if (x == this->mapping.x_begin || (bit & 7) == 0)
+        bits = pgm_read_byte(this->data + y * this->stride + bit / 8);
+      const uint8_t alpha = this->alpha[(bits >> (8 - this->bits_per_pixel - (bit & 7))) & mask];
+      if (alpha != 0)
+        f(abs_x, abs_y, alpha);
+    });
+  }
+};
+
+/// An IMAGE_TYPE_RGB565 image to draw, stored in PROGMEM as rows of `stride` bytes.
+struct Rgb565Blit {
+  PixelMapping mapping;
+  const uint8_t *data;
+  uint32_t stride;
+  /// Leave the pixels with the color IMAGE_TRANSPARENT_565 untouched.
+  bool transparent;
+
+  /// Whether the rows of the image are rows on the screen too, so that 16 bit buffers can copy them as they are.
+  bool can_copy_rows() const {
+    return this->mapping.column_dx == 1 && this->mapping.column_dy == 0 && !this->transparent;
+  }
+
+  /// Call f(absolute_x, absolute_y, data, count) for the visible part of every row, only if can_copy_rows().
+  template<typename F> void for_each_row(F &&f) const {
+    const int count = this->mapping.x_end - this->mapping.x_begin;
+    for (int y = this->mapping.y_begin; y < this->mapping.y_end; y++) {
+      f(this->mapping.origin_x + this->mapping.x_begin + y * this->mapping.row_dx,
+        this->mapping.origin_y + y * this->mapping.row_dy, this->data + y * this->stride + this->mapping.x_begin * 2,
+        count);
+    }
+  }
+
+  /// Call f(absolute_x, absolute_y, color565) for every visible pixel which isn't transparent.
+  template<typename F> void for_each_pixel(F &&f) const {
+    this->mapping.for_each([&](int x, int y, int abs_x, int abs_y) {
+      const uint8_t *pixel = this->data + y * this->stride + x * 2;
+      const uint16_t color565 = (pgm_read_byte(pixel) << 8) | pgm_read_byte(pixel + 1);
+      if (!this->transparent || color565 != IMAGE_TRANSPARENT_565)
+        f(abs_x, abs_y, color565);
+    });
+  }
+};
+
 #define LOG_DISPLAY(prefix, type, obj) \
   if (obj != nullptr) { \
     ESP_LOGCONFIG(TAG, prefix type); \
@@ -306,6 +466,53 @@ class DisplayBuffer {
 
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
 
+  /** Fill an area of the buffer, in absolute coordinates (the rotation is already resolved).
+   *
+   * The area is always inside the screen. Drivers override this to work directly on their buffer, by default every
+   * pixel is drawn with draw_absolute_pixel_internal().
+   */
+  virtual void fill_absolute_rect_internal(int x, int y, int width, int height, Color color);
+
+  /** Draw a 1 bit per pixel bitmap like a glyph or binary image, which is clipped to the screen already.
+   *
+   * Drivers override this to work directly on their buffer, by default every pixel is drawn with
+   * draw_absolute_pixel_internal().
+   */
+  virtual void draw_absolute_bitmap_internal(const BitmapBlit &blit);
+
+  /** Blend an anti-aliased glyph into the buffer, which is clipped to the screen already.
+   *
+   * Drivers which can read back their colors override this to blend the color with the background. By default pixels
+   * with at least half coverage are drawn with draw_absolute_pixel_internal(), like a 1 bit per pixel glyph.
+   */
+  virtual void draw_absolute_alpha_bitmap_internal(const AlphaBlit &blit);
+
+  /** Draw an RGB565 image, which is clipped to the screen already.
+   *
+   * Drivers with a 16 bit buffer override this to copy whole rows where the rotation allows it, by default every
+   * pixel is drawn with draw_absolute_pixel_internal().
+   */
+  virtual void draw_absolute_rgb565_bitmap_internal(const Rgb565Blit &blit);
+
+  /// Clip a block of pixels at [x, y] to the screen and compute where its pixels go, false if nothing is visible.
+  bool map_block_(int x, int y, int width, int height, PixelMapping *mapping);
+
+  /// Fill the part [x_begin, x_end) x [y_begin, y_end) of a mapped block, which has to be visible completely.
+  void fill_mapped_rect_(const PixelMapping &mapping, int x_begin, int x_end, int y_begin, int y_end, Color color);
+
+  /// Draw a glyph with the top left corner of its cell at [x, y].
+  void draw_glyph_(int x, int y, const Glyph &glyph, Color color);
+
+  /// Get the top left corner of a text of the given size for the anchor point [x, y].
+  static void align_text_(int x, int y, TextAlign align, int width, int height, int baseline, int *x1, int *y1);
+
+  /// Draw an IMAGE_COMPRESSION_RLE image, decoding it while drawing.
+  void draw_compressed_image_(int x, int y, Image *image, Color color_on, Color color_off);
+
+  /// Draw a 1 bit per pixel bitmap (see BitmapBlit) with its top left corner at [x, y].
+  void draw_bitmap_(int x, int y, const uint8_t *data, int width, int height, Color color_on, Color color_off,
+                    bool transparent);
+
   virtual int get_height_internal() = 0;
 
   virtual int get_width_internal() = 0;
@@ -314,10 +521,38 @@ class DisplayBuffer {
 
   void do_update_();
 
+  /** Track which parts of the buffer change between updates, so that drivers only have to send those.
+   *
+   * The buffer is split into tiles, after each update the contents of every tile are hashed and compared with the
+   * hash from the previous update. The buffer has to consist of lines of (width * bits_per_pixel / 8) bytes, one
+   * line per row of pixels - or one line per 8 rows for displays where each byte is a column of 8 pixels.
+   *
+   * @param bits_per_pixel The number of bits per pixel in a line of the buffer.
+   * @param tile_width The width of a tile in pixels.
+   * @param tile_height The height of a tile in pixels, a multiple of rows_per_line.
+   * @param rows_per_line The number of pixel rows each line of the buffer contains.
+   */
+  void init_dirty_tiles_(uint8_t bits_per_pixel, uint8_t tile_width = 16, uint8_t tile_height = 16,
+                         uint8_t rows_per_line = 1);
+  /** Get the areas which changed since the last call, merged into a few rectangles.
+   *
+   * Without init_dirty_tiles_() (and on the first call) this is the whole screen.
+   */
+  const std::vector<Rect> &find_dirty_rects_();
+  bool tile_changed_(int tile_x, int tile_y);
+  void add_dirty_rect_(int x, int y, int w, int h);
+
   uint8_t *buffer_{nullptr};
   DisplayRotation rotation_{DISPLAY_ROTATION_0_DEGREES};
   optional<display_writer_t> writer_{};
   DisplayPage *page_{nullptr};
+  std::vector<uint32_t> tile_hashes_{};
+  bool tile_hashes_valid_{false};
+  uint8_t tile_bits_per_pixel_{0};
+  uint8_t tile_width_{0};
+  uint8_t tile_height_{0};
+  uint8_t tile_rows_per_line_{1};
+  std::vector<Rect> dirty_rects_{};
 };
 
 class DisplayPage {
@@ -341,12 +576,15 @@ class DisplayPage {
 class Glyph {
  public:
   Glyph(const char *a_char, const uint8_t *data_start, uint32_t offset, int offset_x, int offset_y, int width,
-        int height);
+        int height, GlyphFormat format = GLYPH_FORMAT_BITMAP);
 
   bool get_pixel(int x, int y) const;
 
   const char *get_char() const;
 
+  /// Number of bits of coverage per pixel, more than 1 for anti-aliased glyphs.
+  uint8_t get_bits_per_pixel() const;
+
   bool compare_to(const char *str) const;
 
   int match_length(const char *str) const;
@@ -357,12 +595,51 @@ class Glyph {
   friend Font;
   friend DisplayBuffer;
 
+  /// Call f(x, y, length, rows) for every run of set pixels of a GLYPH_FORMAT_RUN_LENGTH glyph, row group by group.
+  template<typename F> void for_each_run_(F &&f) const {
+    const uint8_t *pos = this->data_;
+    for (int y = 0; y < this->height_;) {
+      const uint8_t group = pgm_read_byte(pos++);
+      const int rows = (group >> 4) + 1;
+      int x = 0;
+      for (int i = group & 0x0F; i > 0; i--) {
+        const uint8_t run = pgm_read_byte(pos++);
+        int skip = run >> 4;
+        int length = run & 0x0F;
+        if (skip == 0x0F) {
+          skip = pgm_read_byte(pos++);
+          length = pgm_read_byte(pos++);
+        }
+        x += skip;
+        f(x, y, length, rows);
+        x += length;
+      }
+      y += rows;
+    }
+  }
+
   const char *char_;
   const uint8_t *data_;
   int offset_x_;
   int offset_y_;
   int width_;
   int height_;
+  GlyphFormat format_;
+};
+
+/// A string split into glyphs, with the position of each glyph relative to the start of the text.
+struct TextLayout {
+  struct Item {
+    /// Index of the glyph in the font, -1 for a character the font doesn't have.
+    int16_t glyph;
+    int16_t x;
+  };
+
+  std::string text;
+  std::vector<Item> items;
+  int width;
+  int x_offset;
+  uint32_t last_used;
 };
 
 class Font {
@@ -379,37 +656,96 @@ class Font {
 
   void measure(const char *str, int *width, int *x_offset, int *baseline, int *height);
 
+  /** Get the glyphs and positions of a string.
+   *
+   * The last few layouts are cached, so printing the same labels on every update doesn't have to look up the glyphs
+   * again. The result is valid until the next call.
+   */
+  const TextLayout &layout(const char *str);
+
   const std::vector<Glyph> &get_glyphs() const;
 
+  int get_baseline() const { return this->baseline_; }
+  int get_height() const { return this->bottom_; }
+
  protected:
+  void layout_(const char *str, TextLayout *layout);
+
   std::vector<Glyph> glyphs_;
   int baseline_;
   int bottom_;
+  std::vector<TextLayout> layout_cache_{};
+  uint32_t layout_counter_{0};
+};
+
+/// Reads the elements of IMAGE_COMPRESSION_RLE data in PROGMEM one after another, without decompressing it anywhere.
+class RunLengthDecoder {
+ public:
+  RunLengthDecoder(const uint8_t *data, uint8_t element_size) : pos_(data), element_size_(element_size) {}
+
+  /// Get the next element, the pointer is into PROGMEM.
+  const uint8_t *next() {
+    if (this->remaining_ == 0)
+      this->start_run_();
+    const uint8_t *element = this->pos_;
+    this->remaining_--;
+    if (!this->repeat_ || this->remaining_ == 0)
+      this->pos_ += this->element_size_;
+    return element;
+  }
+  /// Skip the next count elements.
+  void skip(uint32_t count);
+
+ protected:
+  void start_run_() {
+    const uint8_t control = pgm_read_byte(this->pos_++);
+    this->repeat_ = control & 0x80;
+    this->remaining_ = this->repeat_ ? control - 126 : control + 1;
+  }
+
+  const uint8_t *pos_;
+  uint8_t element_size_;
+  uint8_t remaining_{0};
+  bool repeat_{false};
 };
 
 class Image {
  public:
-  Image(const uint8_t *data_start, int width, int height, ImageType type);
+  Image(const uint8_t *data_start, int width, int height, ImageType type,
+        ImageCompression compression = IMAGE_COMPRESSION_NONE);
+  /// Get the data of the (current frame of the) image in PROGMEM.
+  virtual const uint8_t *get_data_start() const;
+  /// Get a single pixel, this has to decompress the image up to the pixel for compressed images.
   virtual bool get_pixel(int x, int y) const;
   virtual Color get_color_pixel(int x, int y) const;
   virtual Color get_grayscale_pixel(int x, int y) const;
   int get_width() const;
   int get_height() const;
   ImageType get_type() const;
+  ImageCompression get_compression() const;
+  /// Size of the elements of the pixel data: a pixel, or for binary images a byte of a row.
+  uint8_t get_element_size() const;
+  /// Skip the pixels with the color IMAGE_TRANSPARENT_565 when drawing an RGB565 image.
+  void set_transparency(bool transparency);
+  bool has_transparency() const;
 
  protected:
+  /// Get the element (a byte, or a pixel of color images) at index in the pixel data, the pointer is into PROGMEM.
+  const uint8_t *get_element_(uint32_t index) const;
+
   int width_;
   int height_;
   ImageType type_;
+  ImageCompression compression_;
+  bool transparency_{false};
   const uint8_t *data_start_;
 };
 
 class Animation : public Image {
  public:
-  Animation(const uint8_t *data_start, int width, int height, uint32_t animation_frame_count, ImageType type);
-  bool get_pixel(int x, int y) const override;
-  Color get_color_pixel(int x, int y) const override;
-  Color get_grayscale_pixel(int x, int y) const override;
+  Animation(const uint8_t *data_start, int width, int height, uint32_t animation_frame_count, ImageType type,
+            ImageCompression compression = IMAGE_COMPRESSION_NONE);
+  const uint8_t *get_data_start() const override;
 
   int get_animation_frame_count() const;
   int get_current_frame() const;
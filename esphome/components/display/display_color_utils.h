@@ -101,6 +101,23 @@ class ColorUtil {
     return 0;
   }
 
+  /// Expand an RGB565 color, the low bits repeat the high ones so that color_to_565() gives back the same value.
+  static Color rgb565_to_color(uint16_t color565) {
+    const uint8_t red = (color565 >> 11) & 0x1F;
+    const uint8_t green = (color565 >> 5) & 0x3F;
+    const uint8_t blue = color565 & 0x1F;
+    return Color((red << 3) | (red >> 2), (green << 2) | (green >> 4), (blue << 3) | (blue >> 2));
+  }
+
+  /// Blend two RGB565 colors, alpha goes from 0 (only the background) to 32 (only the foreground).
+  static uint16_t blend_565(uint16_t background, uint16_t foreground, uint8_t alpha) {
+    // spread the channels with gaps between them, so that all three can be blended with one multiplication
+    const uint32_t bg = (background | (uint32_t(background) << 16)) & 0x07E0F81F;
+    const uint32_t fg = (foreground | (uint32_t(foreground) << 16)) & 0x07E0F81F;
+    const uint32_t result = (bg + (((fg - bg) * alpha) >> 5)) & 0x07E0F81F;
+    return result | (result >> 16);
+  }
+
   static uint32_t color_to_grayscale4(Color color) {
     uint32_t gs4 = esp_scale8(color.white, 15);
     return gs4;
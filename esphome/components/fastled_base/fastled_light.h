@@ -227,6 +227,10 @@ class FastLEDLightOutput : public light::AddressableLight {
     return {&this->leds_[index].r,      &this->leds_[index].g, &this->leds_[index].b, nullptr,
             &this->effect_data_[index], &this->correction_};
   }
+  bool get_buffer_layout(light::ESPColorBufferLayout *layout) const override {
+    *layout = {this->leds_->raw, sizeof(CRGB), {0, 1, 2, 0}, false};
+    return true;
+  }
 
   CLEDController *controller_{nullptr};
   CRGB *leds_{nullptr};
@@ -12,6 +12,7 @@ MULTI_CONF = True
 
 Font = display.display_ns.class_("Font")
 Glyph = display.display_ns.class_("Glyph")
+GlyphFormat = display.display_ns.enum("GlyphFormat")
 
 
 def validate_glyphs(value):
@@ -75,6 +76,11 @@ DEFAULT_GLYPHS = (
     ' !"%()+,-.:0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ_abcdefghijklmnopqrstuvwxyz°'
 )
 CONF_RAW_DATA_ID = "raw_data_id"
+CONF_BPP = "bpp"
+GLYPH_FORMAT_ALPHA = {
+    2: GlyphFormat.GLYPH_FORMAT_ALPHA2,
+    4: GlyphFormat.GLYPH_FORMAT_ALPHA4,
+}
 
 FONT_SCHEMA = cv.Schema(
     {
@@ -82,6 +88,7 @@ FONT_SCHEMA = cv.Schema(
         cv.Required(CONF_FILE): validate_truetype_file,
         cv.Optional(CONF_GLYPHS, default=DEFAULT_GLYPHS): validate_glyphs,
         cv.Optional(CONF_SIZE, default=20): cv.int_range(min=1),
+        cv.Optional(CONF_BPP, default=1): cv.one_of(1, 2, 4, int=True),
         cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
     }
 )
@@ -89,6 +96,81 @@ FONT_SCHEMA = cv.Schema(
 CONFIG_SCHEMA = cv.All(validate_pillow_installed, FONT_SCHEMA)
 
 
+def encode_bitmap(mask):
+    """Encode a glyph mask as rows of bytes, the most significant bit first."""
+    width, height = mask.size
+    width8 = ((width + 7) // 8) * 8
+    data = [0 for _ in range(height * width8 // 8)]
+    for y in range(height):
+        for x in range(width):
+            if not mask.getpixel((x, y)):
+                continue
+            pos = x + y * width8
+            data[pos // 8] |= 0x80 >> (pos % 8)
+    return data
+
+
+def encode_alpha(mask, bpp):
+    """Encode an 8 bit coverage mask with bpp bits per pixel.
+
+    The first pixel of each row is in the most significant bits of the first byte.
+    """
+    width, height = mask.size
+    max_level = (1 << bpp) - 1
+    stride = (width * bpp + 7) // 8
+    data = [0 for _ in range(height * stride)]
+    for y in range(height):
+        for x in range(width):
+            level = (mask.getpixel((x, y)) * max_level + 127) // 255
+            bit = x * bpp
+            data[y * stride + bit // 8] |= level << (8 - bpp - bit % 8)
+    return data
+
+
+def encode_run_length(mask):
+    """Encode a glyph mask as runs of set pixels (see GlyphFormat in display_buffer.h).
+
+    Returns None if a row has too many runs for the format.
+    """
+    width, height = mask.size
+    rows = []
+    for y in range(height):
+        runs = []
+        x = 0
+        while x < width:
+            if not mask.getpixel((x, y)):
+                x += 1
+                continue
+            start = x
+            while x < width and mask.getpixel((x, y)):
+                x += 1
+            runs.append((start, x - start))
+        rows.append(runs)
+
+    data = []
+    y = 0
+    while y < height:
+        runs = rows[y]
+        if len(runs) > 15:
+            return None
+        count = 1
+        while y + count < height and count < 16 and rows[y + count] == runs:
+            count += 1
+        data.append((count - 1) << 4 | len(runs))
+        last = 0
+        for start, length in runs:
+            skip = start - last
+            if skip < 15 and length < 16:
+                data.append(skip << 4 | length)
+            elif skip < 256 and length < 256:
+                data += [0xF0, skip, length]
+            else:
+                return None
+            last = start + length
+        y += count
+    return data
+
+
 def to_code(config):
     from PIL import ImageFont
 
@@ -103,18 +185,22 @@ def to_code(config):
     glyph_args = {}
     data = []
     for glyph in config[CONF_GLYPHS]:
-        mask = font.getmask(glyph, mode="1")
         _, (offset_x, offset_y) = font.font.getsize(glyph)
+        if config[CONF_BPP] > 1:
+            mask = font.getmask(glyph, mode="L")
+            glyph_data = encode_alpha(mask, config[CONF_BPP])
+            glyph_format = GLYPH_FORMAT_ALPHA[config[CONF_BPP]]
+        else:
+            mask = font.getmask(glyph, mode="1")
+            # use whichever format is smaller, runs are also faster to draw
+            glyph_data = encode_bitmap(mask)
+            glyph_format = GlyphFormat.GLYPH_FORMAT_BITMAP
+            run_length_data = encode_run_length(mask)
+            if run_length_data is not None and len(run_length_data) < len(glyph_data):
+                glyph_data = run_length_data
+                glyph_format = GlyphFormat.GLYPH_FORMAT_RUN_LENGTH
         width, height = mask.size
-        width8 = ((width + 7) // 8) * 8
-        glyph_data = [0 for _ in range(height * width8 // 8)]  # noqa: F812
-        for y in range(height):
-            for x in range(width):
-                if not mask.getpixel((x, y)):
-                    continue
-                pos = x + y * width8
-                glyph_data[pos // 8] |= 0x80 >> (pos % 8)
-        glyph_args[glyph] = (len(data), offset_x, offset_y, width, height)
+        glyph_args[glyph] = (len(data), offset_x, offset_y, width, height, glyph_format)
         data += glyph_data
 
     rhs = [HexInt(x) for x in data]
@@ -84,29 +84,20 @@ void ILI9341Display::update() {
 }
 
 void ILI9341Display::display_() {
-  // we will only update the changed window to the display
-  int w = this->x_high_ - this->x_low_ + 1;
-  int h = this->y_high_ - this->y_low_ + 1;
-
-  set_addr_window_(this->x_low_, this->y_low_, w, h);
-  this->start_data_();
-  uint32_t start_pos = ((this->y_low_ * this->width_) + x_low_);
-  for (uint16_t row = 0; row < h; row++) {
-    for (uint16_t col = 0; col < w; col++) {
-      uint32_t pos = start_pos + (row * width_) + col;
-
-      uint16_t color = convert_to_16bit_color_(buffer_[pos]);
-      this->write_byte(color >> 8);
-      this->write_byte(color);
+  // we will only update the changed areas to the display
+  for (const auto &rect : this->find_dirty_rects_()) {
+    this->set_addr_window_(rect.x, rect.y, rect.w, rect.h);
+    this->start_data_();
+    for (uint16_t row = 0; row < rect.h; row++) {
+      uint32_t pos = (rect.y + row) * this->width_ + rect.x;
+      for (uint16_t col = 0; col < rect.w; col++) {
+        uint16_t color = convert_to_16bit_color_(buffer_[pos++]);
+        this->write_byte(color >> 8);
+        this->write_byte(color);
+      }
     }
+    this->end_data_();
   }
-  this->end_data_();
-
-  // invalidate watermarks
-  this->x_low_ = this->width_;
-  this->y_low_ = this->height_;
-  this->x_high_ = 0;
-  this->y_high_ = 0;
 }
 
 uint16_t ILI9341Display::convert_to_16bit_color_(uint8_t color_8bit) {
@@ -132,10 +123,6 @@ uint8_t ILI9341Display::convert_to_8bit_color_(uint16_t color_16bit) {
 void ILI9341Display::fill(Color color) {
   auto color565 = display::ColorUtil::color_to_565(color);
   memset(this->buffer_, convert_to_8bit_color_(color565), this->get_buffer_length_());
-  this->x_low_ = 0;
-  this->y_low_ = 0;
-  this->x_high_ = this->get_width_internal() - 1;
-  this->y_high_ = this->get_height_internal() - 1;
 }
 
 void ILI9341Display::fill_internal_(Color color) {
@@ -155,17 +142,32 @@ void HOT ILI9341Display::draw_absolute_pixel_internal(int x, int y, Color color)
   if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
     return;
 
-  // low and high watermark may speed up drawing from buffer
-  this->x_low_ = (x < this->x_low_) ? x : this->x_low_;
-  this->y_low_ = (y < this->y_low_) ? y : this->y_low_;
-  this->x_high_ = (x > this->x_high_) ? x : this->x_high_;
-  this->y_high_ = (y > this->y_high_) ? y : this->y_high_;
-
   uint32_t pos = (y * width_) + x;
   auto color565 = display::ColorUtil::color_to_565(color);
   buffer_[pos] = convert_to_8bit_color_(color565);
 }
 
+void HOT ILI9341Display::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  const uint8_t color8 = convert_to_8bit_color_(display::ColorUtil::color_to_565(color));
+  for (int row = y; row < y + height; row++)
+    memset(this->buffer_ + row * this->width_ + x, color8, width);
+}
+
+void HOT ILI9341Display::draw_absolute_bitmap_internal(const display::BitmapBlit &blit) {
+  const uint8_t color_on = convert_to_8bit_color_(display::ColorUtil::color_to_565(blit.color_on));
+  const uint8_t color_off = convert_to_8bit_color_(display::ColorUtil::color_to_565(blit.color_off));
+  blit.for_each_pixel([this, color_on, color_off](int x, int y, bool on) {
+    this->buffer_[y * this->width_ + x] = on ? color_on : color_off;
+  });
+}
+
+void HOT ILI9341Display::draw_absolute_rgb565_bitmap_internal(const display::Rgb565Blit &blit) {
+  // the buffer holds 8 bit colors, which are converted from RGB565 anyway
+  blit.for_each_pixel([this](int x, int y, uint16_t color565) {
+    this->buffer_[y * this->width_ + x] = convert_to_8bit_color_(color565);
+  });
+}
+
 // should return the total size: return this->get_width_internal() * this->get_height_internal() * 2 // 16bit color
 // values per bit is huge
 uint32_t ILI9341Display::get_buffer_length_() { return this->get_width_internal() * this->get_height_internal(); }
@@ -39,10 +39,14 @@ class ILI9341Display : public PollingComponent,
   void setup() override {
     this->setup_pins_();
     this->initialize();
+    this->init_dirty_tiles_(8);
   }
 
  protected:
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_rect_internal(int x, int y, int width, int height, Color color) override;
+  void draw_absolute_bitmap_internal(const display::BitmapBlit &blit) override;
+  void draw_absolute_rgb565_bitmap_internal(const display::Rgb565Blit &blit) override;
   void setup_pins_();
 
   void init_lcd_(const uint8_t *init_cmd);
@@ -57,10 +61,6 @@ class ILI9341Display : public PollingComponent,
   ILI9341Model model_;
   int16_t width_{320};   ///< Display width as modified by current rotation
   int16_t height_{240};  ///< Display height as modified by current rotation
-  uint16_t x_low_{0};
-  uint16_t y_low_{0};
-  uint16_t x_high_{0};
-  uint16_t y_high_{0};
 
   uint32_t get_buffer_length_();
   int get_width_internal() override;
@@ -17,11 +17,23 @@ IMAGE_TYPE = {
     "BINARY": ImageType.IMAGE_TYPE_BINARY,
     "GRAYSCALE": ImageType.IMAGE_TYPE_GRAYSCALE,
     "RGB24": ImageType.IMAGE_TYPE_RGB24,
+    "RGB565": ImageType.IMAGE_TYPE_RGB565,
+}
+
+ImageCompression = display.display_ns.enum("ImageCompression")
+IMAGE_COMPRESSION = {
+    "NONE": ImageCompression.IMAGE_COMPRESSION_NONE,
+    "RLE": ImageCompression.IMAGE_COMPRESSION_RLE,
 }
 
 Image_ = display.display_ns.class_("Image")
 
 CONF_RAW_DATA_ID = "raw_data_id"
+CONF_COMPRESSION = "compression"
+CONF_USE_TRANSPARENCY = "use_transparency"
+
+# the color of transparent pixels in RGB565 images, see IMAGE_TRANSPARENT_565
+TRANSPARENT_565 = 0x0020
 
 IMAGE_SCHEMA = cv.Schema(
     {
@@ -32,11 +44,89 @@ IMAGE_SCHEMA = cv.Schema(
         cv.Optional(CONF_DITHER, default="NONE"): cv.one_of(
             "NONE", "FLOYDSTEINBERG", upper=True
         ),
+        cv.Optional(CONF_COMPRESSION, default="NONE"): cv.enum(
+            IMAGE_COMPRESSION, upper=True
+        ),
+        cv.Optional(CONF_USE_TRANSPARENCY, default=False): cv.boolean,
         cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
     }
 )
 
-CONFIG_SCHEMA = cv.All(font.validate_pillow_installed, IMAGE_SCHEMA)
+
+def validate_transparency(config):
+    if config[CONF_USE_TRANSPARENCY] and config[CONF_TYPE] != "RGB565":
+        raise cv.Invalid(
+            "Transparency is only supported for RGB565 images",
+            path=[CONF_USE_TRANSPARENCY],
+        )
+    return config
+
+
+CONFIG_SCHEMA = cv.All(
+    font.validate_pillow_installed, IMAGE_SCHEMA, validate_transparency
+)
+
+
+def element_size(image_type):
+    """Size of the elements IMAGE_COMPRESSION_RLE works on.
+
+    That's a pixel, or a byte of a row for binary images.
+    """
+    return {"RGB24": 3, "RGB565": 2}.get(image_type, 1)
+
+
+def encode_rgb565(image, transparency):
+    """Encode a PIL image as big-endian RGB565 pixels, like 16 bit buffers store them.
+
+    With transparency, mostly transparent pixels get the color TRANSPARENT_565 and
+    opaque ones of that color become black.
+    """
+    data = []
+    for red, green, blue, alpha in image.convert("RGBA").getdata():
+        color = (red >> 3) << 11 | (green >> 2) << 5 | (blue >> 3)
+        if transparency:
+            if alpha < 0x80:
+                color = TRANSPARENT_565
+            elif color == TRANSPARENT_565:
+                color = 0
+        data += [color >> 8, color & 0xFF]
+    return data
+
+
+def compress_rle(data, size):
+    """Compress pixel data with the run-length encoding of IMAGE_COMPRESSION_RLE."""
+    elements = [tuple(data[i : i + size]) for i in range(0, len(data), size)]
+    # a repeated single byte is only shorter than a literal from 3 bytes on
+    min_run = 2 if size > 1 else 3
+    out = []
+    literal = []
+
+    def flush_literal():
+        if literal:
+            out.append(len(literal) - 1)
+            for element in literal:
+                out.extend(element)
+            literal.clear()
+
+    i = 0
+    while i < len(elements):
+        run = 1
+        while (
+            i + run < len(elements) and run < 129 and elements[i + run] == elements[i]
+        ):
+            run += 1
+        if run >= min_run:
+            flush_literal()
+            out.append(run + 126)
+            out.extend(elements[i])
+            i += run
+        else:
+            literal.append(elements[i])
+            if len(literal) == 128:
+                flush_literal()
+            i += 1
+    flush_literal()
+    return out
 
 
 def to_code(config):
@@ -83,6 +173,9 @@ def to_code(config):
             data[pos] = pix[2]
             pos += 1
 
+    elif config[CONF_TYPE] == "RGB565":
+        data = encode_rgb565(image, config[CONF_USE_TRANSPARENCY])
+
     elif config[CONF_TYPE] == "BINARY":
         image = image.convert("1", dither=dither)
         width8 = ((width + 7) // 8) * 8
@@ -94,8 +187,27 @@ def to_code(config):
                 pos = x + y * width8
                 data[pos // 8] |= 0x80 >> (pos % 8)
 
+    compression = config[CONF_COMPRESSION]
+    if compression == "RLE":
+        compressed = compress_rle(data, element_size(config[CONF_TYPE]))
+        if len(compressed) < len(data):
+            data = compressed
+        else:
+            _LOGGER.info(
+                "Compressing image %s doesn't save space, storing it uncompressed",
+                config[CONF_ID],
+            )
+            compression = "NONE"
+
     rhs = [HexInt(x) for x in data]
     prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
-    cg.new_Pvariable(
-        config[CONF_ID], prog_arr, width, height, IMAGE_TYPE[config[CONF_TYPE]]
+    var = cg.new_Pvariable(
+        config[CONF_ID],
+        prog_arr,
+        width,
+        height,
+        IMAGE_TYPE[config[CONF_TYPE]],
+        IMAGE_COMPRESSION[compression],
     )
+    if config[CONF_USE_TRANSPARENCY]:
+        cg.add(var.set_transparency(True))
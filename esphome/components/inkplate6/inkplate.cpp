@@ -119,6 +119,52 @@ void HOT Inkplate6::draw_absolute_pixel_internal(int x, int y, Color color) {
     this->partial_buffer_[pos] = (~pixelMaskLUT[x_sub] & current) | (color.is_on() ? 0 : pixelMaskLUT[x_sub]);
   }
 }
+void HOT Inkplate6::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  if (this->greyscale_) {
+    const uint8_t gs = ((color.red * 2126 / 10000) + (color.green * 7152 / 10000) + (color.blue * 722 / 10000)) >> 5;
+    for (int row = y; row < y + height; row++) {
+      uint8_t *data = this->buffer_ + row * (this->get_width_internal() / 2);
+      for (int col = x; col < x + width; col++) {
+        const int x_sub = col % 2;
+        data[col / 2] = (pixelMaskGLUT[x_sub] & data[col / 2]) | (x_sub ? gs : gs << 4);
+      }
+    }
+  } else {
+    const uint8_t fill = color.is_on() ? 0x00 : 0xFF;
+    for (int row = y; row < y + height; row++) {
+      uint8_t *data = this->partial_buffer_ + row * (this->get_width_internal() / 8);
+      for (int col = x; col < x + width; col++) {
+        const uint8_t mask = pixelMaskLUT[col % 8];
+        data[col / 8] = (~mask & data[col / 8]) | (fill & mask);
+      }
+    }
+  }
+}
+void HOT Inkplate6::draw_absolute_bitmap_internal(const display::BitmapBlit &blit) {
+  if (this->greyscale_) {
+    const Color &c_on = blit.color_on;
+    const Color &c_off = blit.color_off;
+    const uint8_t gs_on = ((c_on.red * 2126 / 10000) + (c_on.green * 7152 / 10000) + (c_on.blue * 722 / 10000)) >> 5;
+    const uint8_t gs_off =
+        ((c_off.red * 2126 / 10000) + (c_off.green * 7152 / 10000) + (c_off.blue * 722 / 10000)) >> 5;
+    const uint32_t stride = this->get_width_internal() / 2;
+    blit.for_each_pixel([this, stride, gs_on, gs_off](int x, int y, bool on) {
+      const uint8_t gs = on ? gs_on : gs_off;
+      const int x_sub = x % 2;
+      uint8_t &data = this->buffer_[x / 2 + y * stride];
+      data = (pixelMaskGLUT[x_sub] & data) | (x_sub ? gs : gs << 4);
+    });
+  } else {
+    const uint8_t fill_on = blit.color_on.is_on() ? 0x00 : 0xFF;
+    const uint8_t fill_off = blit.color_off.is_on() ? 0x00 : 0xFF;
+    const uint32_t stride = this->get_width_internal() / 8;
+    blit.for_each_pixel([this, stride, fill_on, fill_off](int x, int y, bool on) {
+      const uint8_t mask = pixelMaskLUT[x % 8];
+      uint8_t &data = this->partial_buffer_[x / 8 + y * stride];
+      data = (~mask & data) | ((on ? fill_on : fill_off) & mask);
+    });
+  }
+}
 void Inkplate6::dump_config() {
   LOG_DISPLAY("", "Inkplate", this);
   ESP_LOGCONFIG(TAG, "  Greyscale: %s", YESNO(this->greyscale_));
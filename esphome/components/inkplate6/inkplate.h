@@ -79,6 +79,8 @@ class Inkplate6 : public PollingComponent, public display::DisplayBuffer, public
 
  protected:
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_rect_internal(int x, int y, int width, int height, Color color) override;
+  void draw_absolute_bitmap_internal(const display::BitmapBlit &blit) override;
   void display1b_();
   void display3b_();
   void initialize_();
@@ -37,6 +37,8 @@ from .types import (  # noqa
     LightTurnOffTrigger,
 )
 
+CONF_EXACT_TRANSITIONS = "exact_transitions"
+
 CODEOWNERS = ["@esphome/core"]
 IS_PLATFORM_COMPONENT = True
 
@@ -98,6 +100,7 @@ ADDRESSABLE_LIGHT_SCHEMA = RGB_LIGHT_SCHEMA.extend(
             [cv.percentage], cv.Length(min=3, max=4)
         ),
         cv.Optional(CONF_POWER_SUPPLY): cv.use_id(power_supply.PowerSupply),
+        cv.Optional(CONF_EXACT_TRANSITIONS): cv.boolean,
     }
 )
 
@@ -134,6 +137,9 @@ def setup_light_core_(light_var, output_var, config):
         var_ = yield cg.get_variable(config[CONF_POWER_SUPPLY])
         cg.add(output_var.set_power_supply(var_))
 
+    if CONF_EXACT_TRANSITIONS in config:
+        cg.add(output_var.set_exact_transitions(config[CONF_EXACT_TRANSITIONS]))
+
     if CONF_MQTT_ID in config:
         mqtt_ = cg.new_Pvariable(config[CONF_MQTT_ID], light_var)
         yield mqtt.register_mqtt_component(mqtt_, config)
@@ -1,6 +1,8 @@
 #include "addressable_light.h"
 #include "esphome/core/log.h"
 
+#include <cstring>
+
 namespace esphome {
 namespace light {
 
@@ -74,6 +76,8 @@ Color ESPHSVColor::to_rgb() const {
 }
 
 void ESPRangeView::set(const Color &color) {
+  if (this->parent_->fill_range_(this->begin_, this->end_, color))
+    return;
   for (int32_t i = this->begin_; i < this->end_; i++) {
     (*this->parent_)[i] = color;
   }
@@ -105,21 +109,52 @@ void ESPRangeView::set_effect_data(uint8_t effect_data) {
     c.set_effect_data(effect_data);
 }
 void ESPRangeView::fade_to_white(uint8_t amnt) {
+  if (this->parent_->transform_range_(this->begin_, this->end_, [=](Color c) { return c.fade_to_white(amnt); }))
+    return;
   for (auto c : *this)
     c.fade_to_white(amnt);
 }
 void ESPRangeView::fade_to_black(uint8_t amnt) {
+  if (this->parent_->transform_range_(this->begin_, this->end_, [=](Color c) { return c.fade_to_black(amnt); }))
+    return;
   for (auto c : *this)
     c.fade_to_black(amnt);
 }
 void ESPRangeView::lighten(uint8_t delta) {
+  if (this->parent_->transform_range_(this->begin_, this->end_, [=](Color c) { return c.lighten(delta); }))
+    return;
   for (auto c : *this)
     c.lighten(delta);
 }
 void ESPRangeView::darken(uint8_t delta) {
+  if (this->parent_->transform_range_(this->begin_, this->end_, [=](Color c) { return c.darken(delta); }))
+    return;
   for (auto c : *this)
     c.darken(delta);
 }
+void ESPRangeView::fill_rainbow(uint16_t hue, uint16_t step, uint8_t saturation, uint8_t value) {
+  auto color_at = [=](uint8_t h) { return ESPHSVColor(h, saturation, value).to_rgb(); };
+  if (this->parent_->gradient_range_(this->begin_, this->end_, hue, step, color_at))
+    return;
+  for (auto led : *this) {
+    const Color color = color_at(hue >> 8);
+    led.set_rgb(color.r, color.g, color.b);
+    hue += step;
+  }
+}
+void ESPRangeView::fill_palette(const uint8_t *palette, uint16_t index, uint16_t step) {
+  auto color_at = [=](uint8_t i) {
+    const uint8_t *rgb = palette + 3 * i;
+    return Color(pgm_read_byte(rgb), pgm_read_byte(rgb + 1), pgm_read_byte(rgb + 2));
+  };
+  if (this->parent_->gradient_range_(this->begin_, this->end_, index, step, color_at))
+    return;
+  for (auto led : *this) {
+    const Color color = color_at(index >> 8);
+    led.set_rgb(color.r, color.g, color.b);
+    index += step;
+  }
+}
 ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {
   // If size doesn't match, error (todo warning)
   if (rhs.size() != this->size())
@@ -135,6 +170,9 @@ ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {
   if (rhs.begin_ == this->begin_)
     return *this;
 
+  if (this->parent_->copy_range_(this->begin_, rhs.begin_, this->size()))
+    return *this;
+
   if (rhs.begin_ > this->begin_) {
     // Copy from left
     for (int32_t i = 0; i < this->size(); i++) {
@@ -164,8 +202,8 @@ void AddressableLight::call_setup() {
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
   this->set_interval(5000, [this]() {
     const char *name = this->state_parent_ == nullptr ? "" : this->state_parent_->get_name().c_str();
-    ESP_LOGVV(TAG, "Addressable Light '%s' (effect_active=%s next_show=%s)", name, YESNO(this->effect_active_),
-              YESNO(this->next_show_));
+    ESP_LOGVV(TAG, "Addressable Light '%s' (effect_active=%s next_show=%s dirty=%s)", name,
+              YESNO(this->effect_active_), YESNO(this->next_show_), YESNO(!this->dirty_.is_empty()));
     for (int i = 0; i < this->size(); i++) {
       auto color = this->get(i);
       ESP_LOGVV(TAG, "  [%2d] Color: R=%3u G=%3u B=%3u W=%3u", i, color.get_red_raw(), color.get_green_raw(),
@@ -176,6 +214,114 @@ void AddressableLight::call_setup() {
 #endif
 }
 
+bool AddressableLight::fill_range_(int32_t begin, int32_t end, const Color &color) {
+  ESPColorBufferLayout layout;
+  if (begin >= end || !this->get_buffer_layout(&layout))
+    return false;
+
+  const Color corrected = this->correction_.color_correct(color);
+  uint8_t *const first = layout.data + begin * layout.stride;
+  for (uint8_t i = 0; i < (layout.has_white ? 4 : 3); i++)
+    first[layout.offsets[i]] = corrected.raw[i];
+  // keep doubling the part that's already filled
+  const size_t total = (end - begin) * layout.stride;
+  size_t filled = layout.stride;
+  while (filled < total) {
+    const size_t len = std::min(filled, total - filled);
+    memcpy(first + filled, first, len);
+    filled += len;
+  }
+  this->mark_dirty_(begin, end);
+  return true;
+}
+bool AddressableLight::copy_range_(int32_t dst, int32_t src, int32_t count) {
+  ESPColorBufferLayout layout;
+  if (!this->get_buffer_layout(&layout))
+    return false;
+  // raw copy, also avoids the loss from uncorrecting and correcting the colors again
+  memmove(layout.data + dst * layout.stride, layout.data + src * layout.stride, count * layout.stride);
+  this->mark_dirty_(dst, dst + count);
+  return true;
+}
+template<uint8_t STRIDE>
+static void HOT map_leds(uint8_t *data, const uint8_t *src, int32_t count, const uint8_t *t0, const uint8_t *t1,
+                         const uint8_t *t2, const uint8_t *t3) {
+  for (int32_t i = 0; i < count; i++, data += STRIDE, src += STRIDE) {
+    data[0] = t0[src[0]];
+    data[1] = t1[src[1]];
+    data[2] = t2[src[2]];
+    if (STRIDE == 4)
+      data[3] = t3[src[3]];
+  }
+}
+void AddressableLight::map_range_(const ESPColorBufferLayout &layout, const uint8_t *src, int32_t begin,
+                                  int32_t end) {
+  // tables in the order of the bytes of a LED
+  const uint8_t *tables[4] = {nullptr, nullptr, nullptr, nullptr};
+  for (uint8_t i = 0; i < (layout.has_white ? 4 : 3); i++)
+    tables[layout.offsets[i]] = this->transform_tables_ + 256 * i;
+
+  uint8_t *data = layout.data + begin * layout.stride;
+  src += begin * layout.stride;
+  if (layout.stride == 4) {
+    map_leds<4>(data, src, end - begin, tables[0], tables[1], tables[2], tables[3]);
+  } else {
+    map_leds<3>(data, src, end - begin, tables[0], tables[1], tables[2], nullptr);
+  }
+  this->mark_dirty_(begin, end);
+}
+void HOT AddressableLight::gradient_leds_(const ESPColorBufferLayout &layout, int32_t begin, int32_t end,
+                                          uint16_t index, uint16_t step) {
+  const uint8_t *tables = this->transform_tables_;
+  const uint8_t red = layout.offsets[0], green = layout.offsets[1], blue = layout.offsets[2];
+  uint8_t *data = layout.data + begin * layout.stride;
+  for (int32_t i = begin; i < end; i++, data += layout.stride, index += step) {
+    const uint8_t at = index >> 8;
+    data[red] = tables[at];
+    data[green] = tables[256 + at];
+    data[blue] = tables[512 + at];
+  }
+  this->mark_dirty_(begin, end);
+}
+static inline uint8_t blend8(uint8_t from, uint8_t to, uint16_t amount) {
+  return (from * (256 - amount) + to * amount) >> 8;
+}
+bool AddressableLight::exact_transition_(LightTransformer *transformer, const Color &target) {
+  ESPColorBufferLayout layout;
+  if (!this->exact_transitions_ || !this->get_buffer_layout(&layout))
+    return false;
+
+  const size_t bytes = this->size() * layout.stride;
+  if (this->transition_snapshot_ == nullptr)
+    this->transition_snapshot_ = new uint8_t[bytes];
+  if (transformer != this->snapshot_transformer_ || transformer->get_start_time() != this->snapshot_start_time_) {
+    // first frame of a new transition (or one that interrupted the last one)
+    memcpy(this->transition_snapshot_, layout.data, bytes);
+    this->snapshot_transformer_ = transformer;
+    this->snapshot_start_time_ = transformer->get_start_time();
+  }
+
+  // 0 (start colors) to 256 (target)
+  const float progress = LightTransitionTransformer::smoothed_progress(transformer->get_progress());
+  const auto amount = static_cast<uint16_t>(roundf(progress * 256.0f));
+  auto blend = [=](Color c) {
+    return Color(blend8(c.r, target.r, amount), blend8(c.g, target.g, amount), blend8(c.b, target.b, amount),
+                 blend8(c.w, target.w, amount));
+  };
+  if (this->size() >= BULK_TRANSFORM_MIN_LEDS) {
+    this->calculate_transform_tables_(blend);
+    this->map_range_(layout, this->transition_snapshot_, 0, this->size());
+    return true;
+  }
+  const uint8_t *offsets = layout.offsets;
+  for (int32_t i = 0; i < this->size(); i++) {
+    const uint8_t *start = this->transition_snapshot_ + i * layout.stride;
+    Color color(start[offsets[0]], start[offsets[1]], start[offsets[2]], layout.has_white ? start[offsets[3]] : 0);
+    (*this)[i] = blend(this->correction_.color_uncorrect(color));
+  }
+  return true;
+}
+
 Color esp_color_from_light_color_values(LightColorValues val) {
   auto r = static_cast<uint8_t>(roundf(val.get_red() * 255.0f));
   auto g = static_cast<uint8_t>(roundf(val.get_green() * 255.0f));
@@ -205,16 +351,6 @@ void AddressableLight::write_state(LightState *state) {
     // instead of using a unified transition for all LEDs, we use the current state each LED as the
     // start. Warning: ugly
 
-    // We can't use a direct lerp smoothing here though - that would require creating a copy of the original
-    // state of each LED at the start of the transition
-    // Instead, we "fake" the look of the LERP by using an exponential average over time and using
-    // dynamically-calculated alpha values to match the look of the
-
-    float new_progress = state->transformer_->get_progress();
-    float prev_smoothed = LightTransitionTransformer::smoothed_progress(last_transition_progress_);
-    float new_smoothed = LightTransitionTransformer::smoothed_progress(new_progress);
-    this->last_transition_progress_ = new_progress;
-
     auto end_values = state->transformer_->get_end_values();
     Color target_color = esp_color_from_light_color_values(end_values);
 
@@ -225,6 +361,21 @@ void AddressableLight::write_state(LightState *state) {
     // w is not scaled by brightness
     target_color.w = orig_w;
 
+    if (this->exact_transition_(state->transformer_.get(), target_color)) {
+      this->schedule_show();
+      return;
+    }
+
+    // Without a copy of the original state of each LED at the start of the transition (see
+    // set_exact_transitions()) we can't use a direct lerp smoothing here.
+    // Instead, we "fake" the look of the LERP by using an exponential average over time and using
+    // dynamically-calculated alpha values to match the look of the
+
+    float new_progress = state->transformer_->get_progress();
+    float prev_smoothed = LightTransitionTransformer::smoothed_progress(last_transition_progress_);
+    float new_smoothed = LightTransitionTransformer::smoothed_progress(new_progress);
+    this->last_transition_progress_ = new_progress;
+
     float denom = (1.0f - new_smoothed);
     float alpha = denom == 0.0f ? 0.0f : (new_smoothed - prev_smoothed) / denom;
 
@@ -246,8 +397,10 @@ void AddressableLight::write_state(LightState *state) {
       uint8_t inv_alpha8 = 255 - alpha8;
       Color add = target_color * alpha8;
 
-      for (auto led : *this)
-        led = add + led.get() * inv_alpha8;
+      if (!this->transform_range_(0, this->size(), [=](Color c) { return add + c * inv_alpha8; })) {
+        for (auto led : *this)
+          led = add + led.get() * inv_alpha8;
+      }
     }
   }
 
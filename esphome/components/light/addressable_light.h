@@ -138,6 +138,21 @@ class ESPColorSettable {
   }
 };
 
+/// Range of LEDs [begin, end) whose colors changed since the light was last shown.
+struct ESPDirtyRange {
+  int32_t begin{INT32_MAX};
+  int32_t end{0};
+
+  bool is_empty() const { return this->begin >= this->end; }
+  void add(int32_t from, int32_t to) {
+    if (from < this->begin)
+      this->begin = from;
+    if (to > this->end)
+      this->end = to;
+  }
+  void clear() { *this = ESPDirtyRange(); }
+};
+
 class ESPColorView : public ESPColorSettable {
  public:
   ESPColorView(uint8_t *red, uint8_t *green, uint8_t *blue, uint8_t *white, uint8_t *effect_data,
@@ -157,13 +172,17 @@ class ESPColorView : public ESPColorSettable {
     return *this;
   }
   void set(const Color &color) override { this->set_rgbw(color.r, color.g, color.b, color.w); }
-  void set_red(uint8_t red) override { *this->red_ = this->color_correction_->color_correct_red(red); }
-  void set_green(uint8_t green) override { *this->green_ = this->color_correction_->color_correct_green(green); }
-  void set_blue(uint8_t blue) override { *this->blue_ = this->color_correction_->color_correct_blue(blue); }
+  void set_red(uint8_t red) override { this->set_raw_(this->red_, this->color_correction_->color_correct_red(red)); }
+  void set_green(uint8_t green) override {
+    this->set_raw_(this->green_, this->color_correction_->color_correct_green(green));
+  }
+  void set_blue(uint8_t blue) override {
+    this->set_raw_(this->blue_, this->color_correction_->color_correct_blue(blue));
+  }
   void set_white(uint8_t white) override {
     if (this->white_ == nullptr)
       return;
-    *this->white_ = this->color_correction_->color_correct_white(white);
+    this->set_raw_(this->white_, this->color_correction_->color_correct_white(white));
   }
   void set_effect_data(uint8_t effect_data) override {
     if (this->effect_data_ == nullptr)
@@ -199,14 +218,42 @@ class ESPColorView : public ESPColorSettable {
   void raw_set_color_correction(const ESPColorCorrection *color_correction) {
     this->color_correction_ = color_correction;
   }
+  /// Record changes of this LED (at index) in dirty, unless the view already reports them to another light.
+  void raw_set_dirty_range(ESPDirtyRange *dirty, int32_t index) {
+    if (this->dirty_ != nullptr)
+      return;
+    this->dirty_ = dirty;
+    this->index_ = index;
+  }
 
  protected:
+  void set_raw_(uint8_t *channel, uint8_t value) {
+    if (*channel == value)
+      return;
+    *channel = value;
+    if (this->dirty_ != nullptr)
+      this->dirty_->add(this->index_, this->index_ + 1);
+  }
+
   uint8_t *const red_;
   uint8_t *const green_;
   uint8_t *const blue_;
   uint8_t *const white_;
   uint8_t *const effect_data_;
   const ESPColorCorrection *color_correction_;
+  ESPDirtyRange *dirty_{nullptr};
+  int32_t index_{0};
+};
+
+/// Where an output stores the LED colors, which allows AddressableLight to process many LEDs at once.
+struct ESPColorBufferLayout {
+  /// The first byte of the first LED.
+  uint8_t *data;
+  /// Number of bytes per LED.
+  uint8_t stride;
+  /// Position of the red, green, blue and (if has_white) white byte within the bytes of a LED.
+  uint8_t offsets[4];
+  bool has_white;
 };
 
 class AddressableLight;
@@ -250,6 +297,14 @@ class ESPRangeView : public ESPColorSettable {
   void fade_to_black(uint8_t amnt) override;
   void lighten(uint8_t delta) override;
   void darken(uint8_t delta) override;
+  /** Set the LEDs to consecutive colors of the HSV rainbow.
+   *
+   * The hue of the first LED is hue / 256, each following LED advances it by step / 256. Only the RGB channels
+   * are set, like set_hsv().
+   */
+  void fill_rainbow(uint16_t hue, uint16_t step, uint8_t saturation = 255, uint8_t value = 255);
+  /// Like fill_rainbow(), with the colors of a palette of 256 RGB colors (3 bytes each, in PROGMEM).
+  void fill_palette(const uint8_t *palette, uint16_t index, uint16_t step);
   int32_t size() const { return this->end_ - this->begin_; }
 
  protected:
@@ -278,8 +333,8 @@ class ESPRangeIterator {
 class AddressableLight : public LightOutput, public Component {
  public:
   virtual int32_t size() const = 0;
-  ESPColorView operator[](int32_t index) const { return this->get_view_internal(interpret_index(index, this->size())); }
-  ESPColorView get(int32_t index) { return this->get_view_internal(interpret_index(index, this->size())); }
+  ESPColorView operator[](int32_t index) const { return this->get_view_(interpret_index(index, this->size())); }
+  ESPColorView get(int32_t index) { return this->get_view_(interpret_index(index, this->size())); }
   virtual void clear_effect_data() = 0;
   ESPRangeView range(int32_t from, int32_t to) {
     from = interpret_index(from, this->size());
@@ -318,7 +373,14 @@ class AddressableLight : public LightOutput, public Component {
     this->correction_.calculate_gamma_table(state->get_gamma_correct());
     this->state_parent_ = state;
   }
+  /** Show the LEDs in the next loop, even if no changes were recorded.
+   *
+   * Changes made through the views (operator[], range(), ...) are tracked and shown automatically, this is only
+   * required after writing to the buffer of the output directly.
+   */
   void schedule_show() { this->next_show_ = true; }
+  /// Keep a copy of the colors at the start of a transition to interpolate exactly (needs one byte per channel).
+  void set_exact_transitions(bool exact_transitions) { this->exact_transitions_ = exact_transitions; }
 
 #ifdef USE_POWER_SUPPLY
   void set_power_supply(power_supply::PowerSupply *power_supply) { this->power_.set_parent(power_supply); }
@@ -327,9 +389,10 @@ class AddressableLight : public LightOutput, public Component {
   void call_setup() override;
 
  protected:
-  bool should_show_() const { return this->effect_active_ || this->next_show_; }
+  bool should_show_() const { return this->next_show_ || !this->dirty_.is_empty(); }
   void mark_shown_() {
     this->next_show_ = false;
+    this->dirty_.clear();
 #ifdef USE_POWER_SUPPLY
     for (auto c : *this) {
       if (c.get().is_on()) {
@@ -341,9 +404,87 @@ class AddressableLight : public LightOutput, public Component {
 #endif
   }
   virtual ESPColorView get_view_internal(int32_t index) const = 0;
+  ESPColorView get_view_(int32_t index) const {
+    ESPColorView view = this->get_view_internal(index);
+    view.raw_set_dirty_range(&this->dirty_, index);
+    return view;
+  }
+  void mark_dirty_(int32_t begin, int32_t end) { this->dirty_.add(begin, end); }
+  /** Describe the buffer holding the colors, if they are stored in one contiguous buffer.
+   *
+   * Enables the bulk operations on ranges of LEDs, all bytes of a LED must be color channels.
+   */
+  virtual bool get_buffer_layout(ESPColorBufferLayout *layout) const { return false; }
+
+  friend ESPRangeView;
+  /// Set LEDs [begin, end) to a color, returns false if the output doesn't support it.
+  bool fill_range_(int32_t begin, int32_t end, const Color &color);
+  /// Copy count LEDs from src to dst (the ranges may overlap), returns false if the output doesn't support it.
+  bool copy_range_(int32_t dst, int32_t src, int32_t count);
+  /** Set each LED in [begin, end) to transform(LED color), for a transform that handles each channel on its own.
+   *
+   * For larger ranges this evaluates the transform (including the color (un)correction) only once for each of
+   * the 256 possible values of a channel and then maps the raw bytes with these tables. Returns false if this
+   * isn't worth it or the output doesn't support it.
+   */
+  template<typename F> bool transform_range_(int32_t begin, int32_t end, F &&transform) {
+    ESPColorBufferLayout layout;
+    if (end - begin < BULK_TRANSFORM_MIN_LEDS || !this->get_buffer_layout(&layout))
+      return false;
+    this->calculate_transform_tables_(transform);
+    this->map_range_(layout, layout.data, begin, end);
+    return true;
+  }
+  /// Fill transform_tables_ with the raw values of transform(color) for all raw values of a channel.
+  template<typename F> void calculate_transform_tables_(F &&transform) {
+    this->calculate_color_tables_(
+        [&](uint8_t i) { return transform(this->correction_.color_uncorrect(Color(i, i, i, i))); });
+  }
+  /// Fill transform_tables_ with the raw values of color_at(i) for i = 0..255.
+  template<typename F> void calculate_color_tables_(F &&color_at) {
+    if (this->transform_tables_ == nullptr)
+      this->transform_tables_ = new uint8_t[4 * 256];
+    uint8_t *tables = this->transform_tables_;
+    for (uint16_t i = 0; i < 256; i++) {
+      Color color = color_at(i);
+      tables[i] = this->correction_.color_correct_red(color.red);
+      tables[256 + i] = this->correction_.color_correct_green(color.green);
+      tables[512 + i] = this->correction_.color_correct_blue(color.blue);
+      tables[768 + i] = this->correction_.color_correct_white(color.white);
+    }
+  }
+  /** Set the RGB channels of LED i in [begin, end) to color_at((index + i * step) / 256).
+   *
+   * For larger ranges, each of the 256 colors is calculated and corrected only once. Returns false if this isn't
+   * worth it or the output doesn't support it.
+   */
+  template<typename F> bool gradient_range_(int32_t begin, int32_t end, uint16_t index, uint16_t step, F &&color_at) {
+    ESPColorBufferLayout layout;
+    if (end - begin < BULK_TRANSFORM_MIN_LEDS || !this->get_buffer_layout(&layout))
+      return false;
+    this->calculate_color_tables_(color_at);
+    this->gradient_leds_(layout, begin, end, index, step);
+    return true;
+  }
+  /// Set the RGB bytes of LEDs [begin, end) to the values in transform_tables_ at (index + i * step) / 256.
+  void gradient_leds_(const ESPColorBufferLayout &layout, int32_t begin, int32_t end, uint16_t index, uint16_t step);
+  /// Set the bytes of LEDs [begin, end) to the values in transform_tables_ of the bytes in src (laid out like data).
+  void map_range_(const ESPColorBufferLayout &layout, const uint8_t *src, int32_t begin, int32_t end);
+  /** Set the LEDs to the point of the transition between their colors at its start and target.
+   *
+   * The colors at the start are copied once per transition, so unlike the approximation in write_state() the
+   * result only depends on the progress. Returns false if exact transitions are disabled or not supported.
+   */
+  bool exact_transition_(LightTransformer *transformer, const Color &target);
+
+  /// Below this many LEDs, calculating the tables for transform_range_() and gradient_range_() is more expensive
+  /// than calculating the colors of the LEDs.
+  static const int32_t BULK_TRANSFORM_MIN_LEDS = 256;
 
   bool effect_active_{false};
   bool next_show_{true};
+  /// LEDs changed through views, mutable because the const operator[] hands out views that write to it.
+  mutable ESPDirtyRange dirty_{};
   ESPColorCorrection correction_{};
 #ifdef USE_POWER_SUPPLY
   power_supply::PowerSupplyRequester power_;
@@ -351,6 +492,12 @@ class AddressableLight : public LightOutput, public Component {
   LightState *state_parent_{nullptr};
   float last_transition_progress_{0.0f};
   float accumulated_alpha_{0.0f};
+  uint8_t *transform_tables_{nullptr};
+  bool exact_transitions_{false};
+  /// Raw colors at the start of the transition identified by snapshot_transformer_ and snapshot_start_time_.
+  uint8_t *transition_snapshot_{nullptr};
+  const LightTransformer *snapshot_transformer_{nullptr};
+  uint32_t snapshot_start_time_{0};
 };
 
 }  // namespace light
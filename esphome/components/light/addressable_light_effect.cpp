@@ -0,0 +1,57 @@
+#include "addressable_light_effect.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace light {
+
+static const char *TAG = "light.addressable_effect";
+
+void AddressableLightEffect::start_internal() {
+  this->get_addressable_()->set_effect_active(true);
+  this->get_addressable_()->clear_effect_data();
+  this->stats_ = {};
+  this->next_frame_ = millis();
+  this->start();
+}
+void AddressableLightEffect::stop() {
+  this->get_addressable_()->set_effect_active(false);
+  if (this->stats_.frames == 0)
+    return;
+  ESP_LOGV(TAG, "'%s': %u frames (%u dropped, %u overruns), render time avg %u us, max %u us",
+           this->name_.c_str(), this->stats_.frames, this->stats_.dropped_frames, this->stats_.overruns,
+           static_cast<uint32_t>(this->stats_.total_render_us / this->stats_.frames), this->stats_.max_render_us);
+}
+void AddressableLightEffect::apply() {
+  const uint32_t now = millis();
+  if (this->update_interval_ != 0) {
+    if (static_cast<int32_t>(now - this->next_frame_) < 0)
+      return;
+    // The schedule isn't based on the time of the last frame, so the frame rate doesn't depend on how late in
+    // the loop the frames are rendered. Only when a whole frame is missed, the schedule restarts from now.
+    const uint32_t late = now - this->next_frame_;
+    if (late >= this->update_interval_) {
+      this->stats_.dropped_frames += late / this->update_interval_;
+      this->next_frame_ = now;
+    }
+    this->next_frame_ += this->update_interval_;
+  }
+
+  LightColorValues color = this->state_->remote_values;
+  // not using any color correction etc. that will be handled by the addressable layer
+  Color current_color =
+      Color(static_cast<uint8_t>(color.get_red() * 255), static_cast<uint8_t>(color.get_green() * 255),
+            static_cast<uint8_t>(color.get_blue() * 255), static_cast<uint8_t>(color.get_white() * 255));
+  const uint32_t start = micros();
+  this->apply(*this->get_addressable_(), current_color);
+  const uint32_t render_us = micros() - start;
+
+  this->stats_.frames++;
+  this->stats_.total_render_us += render_us;
+  if (render_us > this->stats_.max_render_us)
+    this->stats_.max_render_us = render_us;
+  if (this->update_interval_ != 0 && render_us > this->update_interval_ * 1000)
+    this->stats_.overruns++;
+}
+
+}  // namespace light
+}  // namespace esphome
@@ -25,27 +25,41 @@ inline static int16_t sin16_c(uint16_t theta) {
 }
 inline static uint8_t half_sin8(uint8_t v) { return sin16_c(uint16_t(v) * 128u) >> 8; }
 
+/// Frame statistics of an addressable effect since it was started.
+struct AddressableLightEffectStats {
+  uint32_t frames;
+  /// Frames that weren't rendered because the previous one was late by a whole update interval or more.
+  uint32_t dropped_frames;
+  /// Frames that took longer to render than the update interval.
+  uint32_t overruns;
+  /// 64 bits, a 32-bit sum of render times would wrap after about 72 minutes of rendering.
+  uint64_t total_render_us;
+  uint32_t max_render_us;
+};
+
 class AddressableLightEffect : public LightEffect {
  public:
   explicit AddressableLightEffect(const std::string &name) : LightEffect(name) {}
-  void start_internal() override {
-    this->get_addressable_()->set_effect_active(true);
-    this->get_addressable_()->clear_effect_data();
-    this->start();
-  }
-  void stop() override { this->get_addressable_()->set_effect_active(false); }
+  void start_internal() override;
+  void stop() override;
   virtual void apply(AddressableLight &it, const Color &current_color) = 0;
-  void apply() override {
-    LightColorValues color = this->state_->remote_values;
-    // not using any color correction etc. that will be handled by the addressable layer
-    Color current_color =
-        Color(static_cast<uint8_t>(color.get_red() * 255), static_cast<uint8_t>(color.get_green() * 255),
-              static_cast<uint8_t>(color.get_blue() * 255), static_cast<uint8_t>(color.get_white() * 255));
-    this->apply(*this->get_addressable_(), current_color);
-  }
+  /** Render a frame if one is due, frames are scheduled at a fixed rate of one per update interval.
+   *
+   * Every effect keeps its own schedule, there's no coordination between the effects of several strips. A frame
+   * is always rendered completely in one call, since the light shows its whole buffer in its next loop() and a
+   * partially rendered frame would be visible.
+   */
+  void apply() override;
+  /// Time between frames in ms, 0 renders a frame on every loop() of the light.
+  void set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
+  const AddressableLightEffectStats &get_stats() const { return this->stats_; }
 
  protected:
   AddressableLight *get_addressable_() const { return (AddressableLight *) this->state_->get_output(); }
+
+  uint32_t update_interval_{0};
+  uint32_t next_frame_{0};
+  AddressableLightEffectStats stats_{};
 };
 
 class AddressableLambdaLightEffect : public AddressableLightEffect {
@@ -53,21 +67,17 @@ class AddressableLambdaLightEffect : public AddressableLightEffect {
   AddressableLambdaLightEffect(const std::string &name,
                                const std::function<void(AddressableLight &, Color, bool initial_run)> &f,
                                uint32_t update_interval)
-      : AddressableLightEffect(name), f_(f), update_interval_(update_interval) {}
+      : AddressableLightEffect(name), f_(f) {
+    this->set_update_interval(update_interval);
+  }
   void start() override { this->initial_run_ = true; }
   void apply(AddressableLight &it, const Color &current_color) override {
-    const uint32_t now = millis();
-    if (now - this->last_run_ >= this->update_interval_) {
-      this->last_run_ = now;
-      this->f_(it, current_color, this->initial_run_);
-      this->initial_run_ = false;
-    }
+    this->f_(it, current_color, this->initial_run_);
+    this->initial_run_ = false;
   }
 
  protected:
   std::function<void(AddressableLight &, Color, bool initial_run)> f_;
-  uint32_t update_interval_;
-  uint32_t last_run_{0};
   bool initial_run_;
 };
 
@@ -75,23 +85,23 @@ class AddressableRainbowLightEffect : public AddressableLightEffect {
  public:
   explicit AddressableRainbowLightEffect(const std::string &name) : AddressableLightEffect(name) {}
   void apply(AddressableLight &it, const Color &current_color) override {
-    ESPHSVColor hsv;
-    hsv.value = 255;
-    hsv.saturation = 240;
     uint16_t hue = (millis() * this->speed_) % 0xFFFF;
     const uint16_t add = 0xFFFF / this->width_;
-    for (auto var : it) {
-      hsv.hue = hue >> 8;
-      var = hsv;
-      hue += add;
+    if (this->palette_ != nullptr) {
+      it.all().fill_palette(this->palette_, hue, add);
+    } else {
+      it.all().fill_rainbow(hue, add, 240, 255);
     }
   }
   void set_speed(uint32_t speed) { this->speed_ = speed; }
   void set_width(uint16_t width) { this->width_ = width; }
+  /// Cycle through a palette of 256 RGB colors (see ESPRangeView::fill_palette()) instead of the HSV rainbow.
+  void set_palette(const uint8_t *palette) { this->palette_ = palette; }
 
  protected:
   uint32_t speed_{10};
   uint16_t width_{50};
+  const uint8_t *palette_{nullptr};
 };
 
 struct AddressableColorWipeEffectColor {
@@ -273,10 +283,6 @@ class AddressableFireworksEffect : public AddressableLightEffect {
     it.all() = COLOR_BLACK;
   }
   void apply(AddressableLight &it, const Color &current_color) override {
-    const uint32_t now = millis();
-    if (now - this->last_update_ < this->update_interval_)
-      return;
-    this->last_update_ = now;
     // "invert" the fade out parameter so that higher values make fade out faster
     const uint8_t fade_out_mult = 255u - this->fade_out_rate_;
     for (auto view : it) {
@@ -300,30 +306,24 @@ class AddressableFireworksEffect : public AddressableLightEffect {
       }
     }
   }
-  void set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
   void set_spark_probability(float spark_probability) { this->spark_probability_ = spark_probability; }
   void set_use_random_color(bool random_color) { this->use_random_color_ = random_color; }
   void set_fade_out_rate(uint8_t fade_out_rate) { this->fade_out_rate_ = fade_out_rate; }
 
  protected:
   uint8_t fade_out_rate_{};
-  uint32_t update_interval_{};
-  uint32_t last_update_{0};
   float spark_probability_{};
   bool use_random_color_{};
 };
 
 class AddressableFlickerEffect : public AddressableLightEffect {
  public:
-  explicit AddressableFlickerEffect(const std::string &name) : AddressableLightEffect(name) {}
+  explicit AddressableFlickerEffect(const std::string &name) : AddressableLightEffect(name) {
+    this->update_interval_ = 16;
+  }
   void apply(AddressableLight &it, const Color &current_color) override {
-    const uint32_t now = millis();
     const uint8_t intensity = this->intensity_;
     const uint8_t inv_intensity = 255 - intensity;
-    if (now - this->last_update_ < this->update_interval_)
-      return;
-
-    this->last_update_ = now;
     fast_random_set_seed(random_uint32());
     for (auto var : it) {
       const uint8_t flicker = fast_random_8() % intensity;
@@ -334,12 +334,9 @@ class AddressableFlickerEffect : public AddressableLightEffect {
       var = (var.get() * inv_intensity) + (current_color * intensity);
     }
   }
-  void set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
   void set_intensity(float intensity) { this->intensity_ = static_cast<uint8_t>(roundf(intensity * 255.0f)); }
 
  protected:
-  uint32_t update_interval_{16};
-  uint32_t last_update_{0};
   uint8_t intensity_{13};
 };
 
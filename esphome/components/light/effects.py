@@ -23,6 +23,7 @@ from esphome.const import (
     CONF_RANDOM,
     CONF_SEQUENCE,
 )
+from esphome.core import HexInt
 from esphome.util import Registry
 from .types import (
     LambdaLightEffect,
@@ -54,6 +55,8 @@ CONF_PROGRESS_INTERVAL = "progress_interval"
 CONF_SPARK_PROBABILITY = "spark_probability"
 CONF_USE_RANDOM_COLOR = "use_random_color"
 CONF_FADE_OUT_RATE = "fade_out_rate"
+CONF_PALETTE = "palette"
+CONF_PALETTE_ID = "palette_id"
 CONF_STROBE = "strobe"
 CONF_FLICKER = "flicker"
 CONF_ADDRESSABLE_LAMBDA = "addressable_lambda"
@@ -283,15 +286,57 @@ def addressable_lambda_effect_to_code(config, effect_id):
     {
         cv.Optional(CONF_SPEED, default=10): cv.uint32_t,
         cv.Optional(CONF_WIDTH, default=50): cv.uint32_t,
+        cv.Optional(CONF_PALETTE): cv.All(
+            cv.ensure_list(
+                {
+                    cv.Required(CONF_RED): cv.percentage,
+                    cv.Required(CONF_GREEN): cv.percentage,
+                    cv.Required(CONF_BLUE): cv.percentage,
+                }
+            ),
+            cv.Length(min=2),
+        ),
+        cv.GenerateID(CONF_PALETTE_ID): cv.declare_id(cg.uint8),
+        cv.Optional(
+            CONF_UPDATE_INTERVAL, default="16ms"
+        ): cv.positive_time_period_milliseconds,
     },
 )
 def addressable_rainbow_effect_to_code(config, effect_id):
     var = cg.new_Pvariable(effect_id, config[CONF_NAME])
     cg.add(var.set_speed(config[CONF_SPEED]))
     cg.add(var.set_width(config[CONF_WIDTH]))
+    cg.add(var.set_update_interval(config[CONF_UPDATE_INTERVAL]))
+    if CONF_PALETTE in config:
+        stops = [
+            [color[CONF_RED], color[CONF_GREEN], color[CONF_BLUE]]
+            for color in config[CONF_PALETTE]
+        ]
+        data = [HexInt(x) for x in generate_palette(stops)]
+        palette = cg.progmem_array(config[CONF_PALETTE_ID], data)
+        cg.add(var.set_palette(palette))
     yield var
 
 
+def generate_palette(stops):
+    """Interpolate 256 RGB colors (3 bytes each) between evenly spaced color stops.
+
+    The stops are given as [red, green, blue] in the range 0-1. The palette wraps around
+    from the last stop to the first one, so that cycling through it has no seam.
+    """
+    data = []
+    for i in range(256):
+        pos = i * len(stops) / 256
+        index = int(pos)
+        frac = pos - index
+        start = stops[index]
+        end = stops[(index + 1) % len(stops)]
+        for channel in range(3):
+            value = start[channel] + (end[channel] - start[channel]) * frac
+            data.append(int(round(value * 255)))
+    return data
+
+
 @register_addressable_effect(
     "addressable_color_wipe",
     AddressableColorWipeEffect,
@@ -313,12 +358,16 @@ def addressable_rainbow_effect_to_code(config, effect_id):
             CONF_ADD_LED_INTERVAL, default="0.1s"
         ): cv.positive_time_period_milliseconds,
         cv.Optional(CONF_REVERSE, default=False): cv.boolean,
+        cv.Optional(
+            CONF_UPDATE_INTERVAL, default="16ms"
+        ): cv.positive_time_period_milliseconds,
     },
 )
 def addressable_color_wipe_effect_to_code(config, effect_id):
     var = cg.new_Pvariable(effect_id, config[CONF_NAME])
     cg.add(var.set_add_led_interval(config[CONF_ADD_LED_INTERVAL]))
     cg.add(var.set_reverse(config[CONF_REVERSE]))
+    cg.add(var.set_update_interval(config[CONF_UPDATE_INTERVAL]))
     colors = []
     for color in config.get(CONF_COLORS, []):
         colors.append(
@@ -345,12 +394,16 @@ def addressable_color_wipe_effect_to_code(config, effect_id):
             CONF_MOVE_INTERVAL, default="0.1s"
         ): cv.positive_time_period_milliseconds,
         cv.Optional(CONF_SCAN_WIDTH, default=1): cv.int_range(min=1),
+        cv.Optional(
+            CONF_UPDATE_INTERVAL, default="16ms"
+        ): cv.positive_time_period_milliseconds,
     },
 )
 def addressable_scan_effect_to_code(config, effect_id):
     var = cg.new_Pvariable(effect_id, config[CONF_NAME])
     cg.add(var.set_move_interval(config[CONF_MOVE_INTERVAL]))
     cg.add(var.set_scan_width(config[CONF_SCAN_WIDTH]))
+    cg.add(var.set_update_interval(config[CONF_UPDATE_INTERVAL]))
     yield var
 
 
@@ -363,12 +416,16 @@ def addressable_scan_effect_to_code(config, effect_id):
         cv.Optional(
             CONF_PROGRESS_INTERVAL, default="4ms"
         ): cv.positive_time_period_milliseconds,
+        cv.Optional(
+            CONF_UPDATE_INTERVAL, default="16ms"
+        ): cv.positive_time_period_milliseconds,
     },
 )
 def addressable_twinkle_effect_to_code(config, effect_id):
     var = cg.new_Pvariable(effect_id, config[CONF_NAME])
     cg.add(var.set_twinkle_probability(config[CONF_TWINKLE_PROBABILITY]))
     cg.add(var.set_progress_interval(config[CONF_PROGRESS_INTERVAL]))
+    cg.add(var.set_update_interval(config[CONF_UPDATE_INTERVAL]))
     yield var
 
 
@@ -381,12 +438,16 @@ def addressable_twinkle_effect_to_code(config, effect_id):
         cv.Optional(
             CONF_PROGRESS_INTERVAL, default="32ms"
         ): cv.positive_time_period_milliseconds,
+        cv.Optional(
+            CONF_UPDATE_INTERVAL, default="16ms"
+        ): cv.positive_time_period_milliseconds,
     },
 )
 def addressable_random_twinkle_effect_to_code(config, effect_id):
     var = cg.new_Pvariable(effect_id, config[CONF_NAME])
     cg.add(var.set_twinkle_probability(config[CONF_TWINKLE_PROBABILITY]))
     cg.add(var.set_progress_interval(config[CONF_PROGRESS_INTERVAL]))
+    cg.add(var.set_update_interval(config[CONF_UPDATE_INTERVAL]))
     yield var
 
 
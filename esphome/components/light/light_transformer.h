@@ -33,6 +33,8 @@ class LightTransformer {
 
   float get_progress() { return clamp((millis() - this->start_time_) / float(this->length_), 0.0f, 1.0f); }
 
+  uint32_t get_start_time() const { return this->start_time_; }
+
  protected:
   const LightColorValues &get_start_values_() const { return this->start_values_; }
 
@@ -7,6 +7,7 @@ from esphome.automation import LambdaAction
 from esphome.const import (
     CONF_ARGS,
     CONF_BAUD_RATE,
+    CONF_BINARY_LOGS,
     CONF_FORMAT,
     CONF_HARDWARE_UART,
     CONF_ID,
@@ -98,12 +99,32 @@ LoggerMessageTrigger = logger_ns.class_(
 )
 
 CONF_ESP8266_STORE_LOG_STRINGS_IN_FLASH = "esp8266_store_log_strings_in_flash"
+CONF_ASYNC_BUFFER_SIZE = "async_buffer_size"
+
+
+def validate_async_buffer_size(config):
+    size = config[CONF_ASYNC_BUFFER_SIZE]
+    if size != 0 and size < 2 * config[CONF_TX_BUFFER_SIZE]:
+        raise cv.Invalid(
+            "async_buffer_size must be 0 (disabled) or at least twice tx_buffer_size "
+            "({} bytes)".format(2 * config[CONF_TX_BUFFER_SIZE])
+        )
+    return config
+
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
             cv.GenerateID(): cv.declare_id(Logger),
             cv.Optional(CONF_BAUD_RATE, default=115200): cv.positive_int,
-            cv.Optional(CONF_TX_BUFFER_SIZE, default=512): cv.validate_bytes,
+            cv.Optional(CONF_TX_BUFFER_SIZE, default=512): cv.All(
+                cv.validate_bytes, cv.int_range(max=0xFFFE)
+            ),
+            cv.Optional(CONF_ASYNC_BUFFER_SIZE, default=0): cv.validate_bytes,
+            # Send logs to API clients as format string IDs and raw arguments. Only formats
+            # written as string literals at the ESP_LOGx call are in the string table, the
+            # device sends other messages (formats built with macros, ESP-IDF logs) as text.
+            cv.Optional(CONF_BINARY_LOGS, default=False): cv.boolean,
             cv.Optional(CONF_HARDWARE_UART, default="UART0"): uart_selection,
             cv.Optional(CONF_LEVEL, default="DEBUG"): is_log_level,
             cv.Optional(CONF_LOGS, default={}): cv.Schema(
@@ -123,6 +144,7 @@ CONFIG_SCHEMA = cv.All(
         }
     ).extend(cv.COMPONENT_SCHEMA),
     validate_local_no_higher_than_global,
+    validate_async_buffer_size,
 )
 
 
@@ -136,6 +158,10 @@ def to_code(config):
     )
     log = cg.Pvariable(config[CONF_ID], rhs)
     cg.add(log.pre_setup())
+    if config[CONF_BINARY_LOGS]:
+        cg.add_define("USE_BINARY_LOGGING")
+    if config[CONF_ASYNC_BUFFER_SIZE] != 0:
+        cg.add(log.set_async_buffer_size(config[CONF_ASYNC_BUFFER_SIZE]))
 
     for tag, level in config[CONF_LOGS].items():
         cg.add(log.set_log_level(tag, LOG_LEVELS[level]))
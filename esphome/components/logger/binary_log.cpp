@@ -0,0 +1,279 @@
+#include "binary_log.h"
+
+#ifdef USE_BINARY_LOGGING
+
+#include "esphome/core/esphal.h"
+#include <cstring>
+
+namespace esphome {
+namespace logger {
+
+uint32_t binary_log_format_id(const char *format) {
+  // same as fnv1_hash(), but without creating a std::string
+  uint32_t hash = 2166136261UL;
+  for (const char *c = format; *c != '\0'; c++) {
+    hash *= 16777619UL;
+    hash ^= static_cast<uint8_t>(*c);
+  }
+  return hash;
+}
+bool binary_log_has_format(uint32_t format_id) {
+  size_t begin = 0;
+  size_t end = BINARY_LOG_FORMAT_COUNT;
+  while (begin < end) {
+    const size_t mid = (begin + end) / 2;
+    const uint32_t id = pgm_read_dword(&BINARY_LOG_FORMAT_IDS[mid]);
+    if (id == format_id)
+      return true;
+    if (id < format_id) {
+      begin = mid + 1;
+    } else {
+      end = mid;
+    }
+  }
+  return false;
+}
+
+namespace {
+
+class BinaryLogWriter {
+ public:
+  BinaryLogWriter(uint8_t *buffer, size_t size) : buffer_(buffer), size_(size) {}
+
+  void write_varint(uint64_t value) {
+    do {
+      uint8_t byte = value & 0x7F;
+      value >>= 7;
+      if (value != 0)
+        byte |= 0x80;
+      this->write_byte_(byte);
+    } while (value != 0);
+  }
+  void write_signed(int64_t value) {
+    this->write_varint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+  }
+  void write_float(float value) {
+    uint32_t raw;
+    memcpy(&raw, &value, sizeof(raw));
+    for (uint8_t i = 0; i < 4; i++)
+      this->write_byte_(raw >> (i * 8));
+  }
+  void write_string(const char *value, size_t len) {
+    this->write_varint(len);
+    for (size_t i = 0; i < len; i++)
+      this->write_byte_(value[i]);
+  }
+  /// Marks the end of an argument, returns false if the buffer overflowed since the last call.
+  bool commit() {
+    if (this->overflow_)
+      return false;
+    this->committed_ = this->pos_;
+    return true;
+  }
+  size_t get_committed() const { return this->committed_; }
+
+ protected:
+  void write_byte_(uint8_t byte) {
+    if (this->pos_ >= this->size_) {
+      this->overflow_ = true;
+      return;
+    }
+    this->buffer_[this->pos_++] = byte;
+  }
+
+  uint8_t *buffer_;
+  size_t size_;
+  size_t pos_{0};
+  size_t committed_{0};
+  bool overflow_{false};
+};
+
+enum class LengthModifier : uint8_t { NONE, CHAR, SHORT, LONG, LONG_LONG, INTMAX, SIZE, PTRDIFF, LONG_DOUBLE };
+
+int64_t read_signed(LengthModifier length, va_list &args) {
+  switch (length) {
+    case LengthModifier::LONG:
+      return va_arg(args, long);
+    case LengthModifier::LONG_LONG:
+      return va_arg(args, long long);
+    case LengthModifier::INTMAX:
+      return va_arg(args, intmax_t);
+    case LengthModifier::SIZE:
+    case LengthModifier::PTRDIFF:
+      return va_arg(args, ptrdiff_t);
+    case LengthModifier::CHAR:
+      return static_cast<signed char>(va_arg(args, int));
+    case LengthModifier::SHORT:
+      return static_cast<short>(va_arg(args, int));
+    default:
+      return va_arg(args, int);
+  }
+}
+
+uint64_t read_unsigned(LengthModifier length, va_list &args) {
+  switch (length) {
+    case LengthModifier::LONG:
+      return va_arg(args, unsigned long);
+    case LengthModifier::LONG_LONG:
+      return va_arg(args, unsigned long long);
+    case LengthModifier::INTMAX:
+      return va_arg(args, uintmax_t);
+    case LengthModifier::SIZE:
+    case LengthModifier::PTRDIFF:
+      return va_arg(args, size_t);
+    case LengthModifier::CHAR:
+      return static_cast<unsigned char>(va_arg(args, unsigned int));
+    case LengthModifier::SHORT:
+      return static_cast<unsigned short>(va_arg(args, unsigned int));
+    default:
+      return va_arg(args, unsigned int);
+  }
+}
+
+}  // namespace
+
+size_t encode_binary_log(uint8_t *buffer, size_t size, uint32_t format_id, int line, const char *format,
+                         va_list args) {
+  BinaryLogWriter writer(buffer, size);
+  writer.write_varint(format_id);
+  writer.write_varint(line);
+  if (!writer.commit())
+    return 0;
+
+  // va_list may be an array type, copy it so that it can be passed on by reference
+  va_list ap;
+  va_copy(ap, args);
+  const char *p = format;
+  while (*p != '\0') {
+    if (*p++ != '%')
+      continue;
+    if (*p == '%') {
+      p++;
+      continue;
+    }
+
+    // flags
+    while (*p != '\0' && strchr("-+ #0", *p) != nullptr)
+      p++;
+    // field width
+    if (*p == '*') {
+      writer.write_signed(va_arg(ap, int));
+      p++;
+    }
+    while (*p >= '0' && *p <= '9')
+      p++;
+    // precision, limits how many characters of a string are read
+    int precision = -1;
+    if (*p == '.') {
+      p++;
+      precision = 0;
+      if (*p == '*') {
+        precision = va_arg(ap, int);
+        writer.write_signed(precision);
+        p++;
+      }
+      while (*p >= '0' && *p <= '9')
+        precision = precision * 10 + (*p++ - '0');
+    }
+    // length modifier
+    LengthModifier length = LengthModifier::NONE;
+    switch (*p) {
+      case 'h':
+        p++;
+        length = LengthModifier::SHORT;
+        if (*p == 'h') {
+          p++;
+          length = LengthModifier::CHAR;
+        }
+        break;
+      case 'l':
+        p++;
+        length = LengthModifier::LONG;
+        if (*p == 'l') {
+          p++;
+          length = LengthModifier::LONG_LONG;
+        }
+        break;
+      case 'j':
+        p++;
+        length = LengthModifier::INTMAX;
+        break;
+      case 'z':
+        p++;
+        length = LengthModifier::SIZE;
+        break;
+      case 't':
+        p++;
+        length = LengthModifier::PTRDIFF;
+        break;
+      case 'L':
+        p++;
+        length = LengthModifier::LONG_DOUBLE;
+        break;
+      default:
+        break;
+    }
+
+    // conversion
+    switch (*p) {
+      case 'd':
+      case 'i':
+        writer.write_signed(read_signed(length, ap));
+        break;
+      case 'u':
+      case 'x':
+      case 'X':
+      case 'o':
+        writer.write_varint(read_unsigned(length, ap));
+        break;
+      case 'c':
+        writer.write_varint(static_cast<unsigned char>(va_arg(ap, int)));
+        break;
+      case 'p':
+        writer.write_varint(reinterpret_cast<uintptr_t>(va_arg(ap, void *)));
+        break;
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+      case 'a':
+      case 'A':
+        if (length == LengthModifier::LONG_DOUBLE) {
+          writer.write_float(va_arg(ap, long double));
+        } else {
+          writer.write_float(va_arg(ap, double));
+        }
+        break;
+      case 's': {
+        const char *str = va_arg(ap, const char *);
+        if (str == nullptr)
+          str = "(null)";
+        size_t len = 0;
+        while ((precision < 0 || len < static_cast<size_t>(precision)) && str[len] != '\0')
+          len++;
+        writer.write_string(str, len);
+        break;
+      }
+      case 'n':
+        // writes to its argument, nothing to send
+        (void) va_arg(ap, void *);
+        break;
+      default:
+        // invalid conversion, the rest of the format can't be interpreted
+        va_end(ap);
+        return writer.get_committed();
+    }
+    p++;
+    if (!writer.commit())
+      break;
+  }
+  va_end(ap);
+  return writer.get_committed();
+}
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_BINARY_LOGGING
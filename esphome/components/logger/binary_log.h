@@ -0,0 +1,51 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_BINARY_LOGGING
+
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+namespace logger {
+
+/** Binary (deferred formatting) log messages.
+ *
+ * Instead of the formatted text, a message consists of the ID of its format string followed by the raw
+ * arguments. The text is reconstructed on the host using the string table that is written when the firmware
+ * is compiled (see esphome/binary_log.py). A message is encoded as:
+ *
+ *  - varint: format ID (see binary_log_format_id())
+ *  - varint: source line
+ *  - every argument consumed by the format string, in order:
+ *    - signed integers (d, i and * field widths/precisions): zigzag varint
+ *    - unsigned integers, characters and pointers (u, x, X, o, c, p): varint
+ *    - floating point values (f, F, e, E, g, G, a, A): 4 byte little endian float
+ *    - strings (s): varint length followed by the characters
+ *
+ * Messages that don't fit in the buffer are cut off after the last complete argument.
+ *
+ * Only format strings that appear as string literals in the sources are in the string table, formats built
+ * with macros and messages from ESP-IDF aren't. Those are sent as text instead, see binary_log_has_format().
+ */
+
+/// ID of a format string, the 32-bit FNV-1 hash of its characters.
+uint32_t binary_log_format_id(const char *format);
+
+/// Whether the string table of the firmware contains the format string with this ID.
+bool binary_log_has_format(uint32_t format_id);
+
+/// Sorted IDs of the string table, generated into binary_log_formats.cpp when compiling (see esphome/binary_log.py).
+extern const uint32_t BINARY_LOG_FORMAT_IDS[];
+extern const size_t BINARY_LOG_FORMAT_COUNT;
+
+/// Encode a message into buffer, returns the number of bytes used.
+size_t encode_binary_log(uint8_t *buffer, size_t size, uint32_t format_id, int line, const char *format,
+                         va_list args);
+
+}  // namespace logger
+}  // namespace esphome
+
+#endif  // USE_BINARY_LOGGING
@@ -1,7 +1,12 @@
 #include "logger.h"
+#include "binary_log.h"
+
+#include "esphome/core/application.h"
 
 #ifdef ARDUINO_ARCH_ESP32
 #include <esp_log.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 #endif
 #include <HardwareSerial.h>
 
@@ -46,11 +51,35 @@ void HOT Logger::log_vprintf_(int level, const char *tag, int line, const char *
   if (level > this->level_for(tag))
     return;
 
+  bool binary_log_fallback = false;
+#ifdef USE_BINARY_LOGGING
+  if (this->binary_log_requested_)
+    binary_log_fallback = !this->log_binary_(level, tag, line, format, format, args);
+  if (!binary_log_fallback && !this->is_text_log_needed_())
+    return;
+#endif
+
+  if (this->use_async_()) {
+    AsyncLogRecord *record = this->async_reserve_();
+    if (record == nullptr) {
+      this->async_dropped_++;
+      return;
+    }
+    int ret = vsnprintf(reinterpret_cast<char *>(record + 1), this->tx_buffer_size_ + 1, format, args);
+    record->length = ret < 0 ? 0 : std::min(ret, this->tx_buffer_size_);
+    record->line = line;
+    record->level = level;
+    record->binary_log_fallback = binary_log_fallback;
+    record->tag = tag;
+    this->async_commit_(record);
+    return;
+  }
+
   this->reset_buffer_();
   this->write_header_(level, tag, line);
   this->vprintf_to_buffer_(format, args);
   this->write_footer_();
-  this->log_message_(level, tag);
+  this->log_message_(level, tag, 0, binary_log_fallback);
 }
 #ifdef USE_STORE_LOG_STR_IN_FLASH
 void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStringHelper *format,
@@ -58,41 +87,149 @@ void Logger::log_vprintf_(int level, const char *tag, int line, const __FlashStr
   if (level > this->level_for(tag))
     return;
 
-  this->reset_buffer_();
-  // copy format string
-  const char *format_pgm_p = (PGM_P) format;
-  size_t len = 0;
-  char ch = '.';
-  while (!this->is_buffer_full_() && ch != '\0') {
-    this->tx_buffer_[this->tx_buffer_at_++] = ch = pgm_read_byte(format_pgm_p++);
-  }
-  // Buffer full form copying format
-  if (this->is_buffer_full_())
+  // A queued message is formatted right away, possibly from a log callback while async_drain_() is still
+  // outputting another message from tx_buffer_, so the format string is copied to a separate buffer then.
+  const bool async = this->use_async_();
+  char *format_copy = async ? this->async_format_buffer_ : this->tx_buffer_;
+  const size_t format_size = strlen_P((PGM_P) format) + 1;
+  // Format string doesn't fit in the buffer
+  if (format_size >= size_t(this->tx_buffer_size_))
     return;
+  memcpy_P(format_copy, format, format_size);
+
+  bool binary_log_fallback = false;
+#ifdef USE_BINARY_LOGGING
+  if (this->binary_log_requested_)
+    binary_log_fallback = !this->log_binary_(level, tag, line, format, format_copy, args);
+  if (!binary_log_fallback && !this->is_text_log_needed_())
+    return;
+#endif
+
+  if (async) {
+    AsyncLogRecord *record = this->async_reserve_();
+    if (record == nullptr) {
+      this->async_dropped_++;
+      return;
+    }
+    int ret = vsnprintf(reinterpret_cast<char *>(record + 1), this->tx_buffer_size_ + 1, format_copy, args);
+    record->length = ret < 0 ? 0 : std::min(ret, this->tx_buffer_size_);
+    record->line = line;
+    record->level = level;
+    record->binary_log_fallback = binary_log_fallback;
+    record->tag = tag;
+    this->async_commit_(record);
+    return;
+  }
 
   // length of format string, includes null terminator
+  this->tx_buffer_at_ = format_size;
   uint32_t offset = this->tx_buffer_at_;
 
   // now apply vsnprintf
   this->write_header_(level, tag, line);
   this->vprintf_to_buffer_(this->tx_buffer_, args);
   this->write_footer_();
-  this->log_message_(level, tag, offset);
+  this->log_message_(level, tag, offset, binary_log_fallback);
 }
 #endif
 
 int HOT Logger::level_for(const char *tag) {
-  // Uses std::vector<> for low memory footprint, though the vector
-  // could be sorted to minimize lookup times. This feature isn't used that
-  // much anyway so it doesn't matter too much.
+  if (this->log_levels_.empty())
+    return ESPHOME_LOG_LEVEL;
+
+  // Tags are string literals, so the same tag always has the same address and the string comparisons
+  // below only have to be done once per tag (unless two tags map to the same cache entry).
+  LevelCacheEntry &entry = this->level_cache_[(reinterpret_cast<uintptr_t>(tag) >> 2) % LEVEL_CACHE_SIZE];
+  if (entry.tag == tag)
+    return entry.level;
+
+  int level = ESPHOME_LOG_LEVEL;
   for (auto &it : this->log_levels_) {
     if (it.tag == tag) {
-      return it.level;
+      level = it.level;
+      break;
+    }
+  }
+  entry.level = level;
+  entry.tag = tag;
+  return level;
+}
+bool HOT Logger::use_async_() {
+  if (!this->async_active_)
+    return false;
+#ifdef ARDUINO_ARCH_ESP32
+  // the ring buffer has a single producer, messages from other tasks are written synchronously
+  return xTaskGetCurrentTaskHandle() == this->loop_task_handle_;
+#else
+  return true;
+#endif
+}
+Logger::AsyncLogRecord *HOT Logger::async_reserve_() {
+  const size_t needed = async_record_size_(this->tx_buffer_size_);
+  const size_t head = this->async_head_.load(std::memory_order_relaxed);
+  const size_t tail = this->async_tail_.load(std::memory_order_acquire);
+  // head == tail means empty, so the head must never catch up with the tail
+  if (head >= tail) {
+    // free space is [head, end) and [0, tail)
+    const size_t at_end = this->async_buffer_size_ - head;
+    if (at_end > needed || (at_end == needed && tail != 0))
+      return reinterpret_cast<AsyncLogRecord *>(&this->async_buffer_[head]);
+    if (tail > needed) {
+      // continue at the start, the consumer skips to it when it reads the marker
+      const uint16_t marker = ASYNC_WRAP_MARKER;
+      memcpy(&this->async_buffer_[head], &marker, sizeof(marker));
+      return reinterpret_cast<AsyncLogRecord *>(&this->async_buffer_[0]);
+    }
+    return nullptr;
+  }
+  // free space is [head, tail)
+  if (tail - head > needed)
+    return reinterpret_cast<AsyncLogRecord *>(&this->async_buffer_[head]);
+  return nullptr;
+}
+void HOT Logger::async_commit_(AsyncLogRecord *record) {
+  size_t head = reinterpret_cast<uint8_t *>(record) - this->async_buffer_ + async_record_size_(record->length);
+  if (head == this->async_buffer_size_)
+    head = 0;
+  // publishes the record (and a wrap marker) to the consumer
+  this->async_head_.store(head, std::memory_order_release);
+#ifdef USE_TICKLESS_LOOP
+  App.wake_loop();
+#endif
+}
+void Logger::async_drain_() {
+  size_t tail = this->async_tail_.load(std::memory_order_relaxed);
+  while (tail != this->async_head_.load(std::memory_order_acquire)) {
+    uint16_t length;
+    memcpy(&length, &this->async_buffer_[tail], sizeof(length));
+    if (length == ASYNC_WRAP_MARKER) {
+      tail = 0;
+      this->async_tail_.store(tail, std::memory_order_release);
+      continue;
     }
+
+    // The record stays reserved until the tail is moved, so messages logged from
+    // the log callbacks below can't overwrite it.
+    auto *record = reinterpret_cast<AsyncLogRecord *>(&this->async_buffer_[tail]);
+    this->reset_buffer_();
+    this->write_header_(record->level, record->tag, record->line);
+    this->write_to_buffer_(reinterpret_cast<const char *>(record + 1), record->length);
+    this->write_footer_();
+    this->log_message_(record->level, record->tag, 0, record->binary_log_fallback);
+
+    tail += async_record_size_(length);
+    if (tail == this->async_buffer_size_)
+      tail = 0;
+    this->async_tail_.store(tail, std::memory_order_release);
+  }
+
+  if (this->async_dropped_ != this->async_reported_dropped_) {
+    ESP_LOGW(TAG, "Dropped %u log messages, consider increasing async_buffer_size",
+             this->async_dropped_ - this->async_reported_dropped_);
+    this->async_reported_dropped_ = this->async_dropped_;
   }
-  return ESPHOME_LOG_LEVEL;
 }
-void HOT Logger::log_message_(int level, const char *tag, int offset) {
+void HOT Logger::log_message_(int level, const char *tag, int offset, bool binary_log_fallback) {
   // remove trailing newline
   if (this->tx_buffer_[this->tx_buffer_at_ - 1] == '\n') {
     this->tx_buffer_at_--;
@@ -103,6 +240,11 @@ void HOT Logger::log_message_(int level, const char *tag, int offset) {
   const char *msg = this->tx_buffer_ + offset;
   if (this->baud_rate_ > 0)
     this->hw_serial_->println(msg);
+#ifdef USE_BINARY_LOGGING
+  // restored afterwards, a log callback may log itself
+  const bool previous_fallback = this->binary_log_fallback_;
+  this->binary_log_fallback_ = binary_log_fallback;
+#endif
 #ifdef ARDUINO_ARCH_ESP32
   // Suppress network-logging if memory constrained, but still log to serial
   // ports. In some configurations (eg BLE enabled) there may be some transient
@@ -114,6 +256,9 @@ void HOT Logger::log_message_(int level, const char *tag, int offset) {
 #else
   this->log_callback_.call(level, tag, msg);
 #endif
+#ifdef USE_BINARY_LOGGING
+  this->binary_log_fallback_ = previous_fallback;
+#endif
 }
 
 Logger::Logger(uint32_t baud_rate, size_t tx_buffer_size, UARTSelection uart)
@@ -165,14 +310,73 @@ void Logger::pre_setup() {
 
   ESP_LOGI(TAG, "Log initialized");
 }
+void Logger::loop() {
+  if (!this->async_active_) {
+    // Messages are only queued from here on, so anything logged during early setup is written
+    // out immediately (and not lost if the device crashes before loop() gets to it).
+#ifdef ARDUINO_ARCH_ESP32
+    this->loop_task_handle_ = xTaskGetCurrentTaskHandle();
+#endif
+    this->async_active_ = true;
+  }
+  this->async_drain_();
+}
+void Logger::on_shutdown() {
+  if (this->async_buffer_ == nullptr)
+    return;
+  this->async_drain_();
+  this->async_active_ = false;
+}
 void Logger::set_baud_rate(uint32_t baud_rate) { this->baud_rate_ = baud_rate; }
 void Logger::set_log_level(const std::string &tag, int log_level) {
   this->log_levels_.push_back(LogLevelOverride{tag, log_level});
+  for (auto &entry : this->level_cache_)
+    entry.tag = nullptr;
+}
+void Logger::set_async_buffer_size(size_t async_buffer_size) {
+  // records are aligned, so is the end of the buffer
+  this->async_buffer_size_ = async_buffer_size & ~(alignof(AsyncLogRecord) - 1);
+  this->async_buffer_ = new uint8_t[this->async_buffer_size_];
+#ifdef USE_STORE_LOG_STR_IN_FLASH
+  this->async_format_buffer_ = new char[this->tx_buffer_size_];
+#endif
 }
 UARTSelection Logger::get_uart() const { return this->uart_; }
 void Logger::add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback) {
+#ifdef USE_BINARY_LOGGING
+  this->has_log_callbacks_ = true;
+#endif
   this->log_callback_.add(std::move(callback));
 }
+#ifdef USE_BINARY_LOGGING
+void Logger::add_on_optional_log_callback(std::function<void(int, const char *, const char *)> &&callback) {
+  this->log_callback_.add(std::move(callback));
+}
+void Logger::add_on_binary_log_callback(
+    std::function<void(int, const char *, const uint8_t *, size_t)> &&callback) {
+  if (this->binary_buffer_ == nullptr)
+    this->binary_buffer_ = new uint8_t[this->tx_buffer_size_];
+  this->binary_log_callback_.add(std::move(callback));
+}
+bool HOT Logger::log_binary_(int level, const char *tag, int line, const void *format_key, const char *format,
+                             va_list args) {
+  if (this->binary_buffer_ == nullptr)
+    return true;
+  FormatIdCacheEntry &entry =
+      this->format_id_cache_[(reinterpret_cast<uintptr_t>(format_key) >> 2) % FORMAT_ID_CACHE_SIZE];
+  if (entry.format != format_key) {
+    entry.id = binary_log_format_id(format);
+    entry.known = binary_log_has_format(entry.id);
+    entry.format = format_key;
+  }
+  if (!entry.known)
+    return false;
+  size_t len = encode_binary_log(this->binary_buffer_, this->tx_buffer_size_, entry.id, line, format, args);
+  if (len != 0)
+    this->binary_log_callback_.call(level, tag, this->binary_buffer_, len);
+  return true;
+}
+#endif
 float Logger::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
 const char *LOG_LEVELS[] = {"NONE", "ERROR", "WARN", "INFO", "CONFIG", "DEBUG", "VERBOSE", "VERY_VERBOSE"};
 #ifdef ARDUINO_ARCH_ESP32
@@ -186,6 +390,9 @@ void Logger::dump_config() {
   ESP_LOGCONFIG(TAG, "  Level: %s", LOG_LEVELS[ESPHOME_LOG_LEVEL]);
   ESP_LOGCONFIG(TAG, "  Log Baud Rate: %u", this->baud_rate_);
   ESP_LOGCONFIG(TAG, "  Hardware UART: %s", UART_SELECTIONS[this->uart_]);
+  if (this->async_buffer_ != nullptr) {
+    ESP_LOGCONFIG(TAG, "  Async Buffer Size: %zu", this->async_buffer_size_);
+  }
   for (auto &it : this->log_levels_) {
     ESP_LOGCONFIG(TAG, "  Level for '%s': %s", it.tag.c_str(), LOG_LEVELS[it.level]);
   }
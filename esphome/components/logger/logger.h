@@ -6,6 +6,8 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/defines.h"
 
+#include <atomic>
+
 namespace esphome {
 
 namespace logger {
@@ -40,17 +42,48 @@ class Logger : public Component {
   /// Set the log level of the specified tag.
   void set_log_level(const std::string &tag, int log_level);
 
+  /** Queue log messages in a ring buffer of this size and output them from loop(), 0 disables this.
+   *
+   * Log calls from the main loop then only format the message, writing it to the UART and passing it to
+   * the log callbacks (API, MQTT, ...) happens later. Messages are dropped if the buffer is full.
+   */
+  void set_async_buffer_size(size_t async_buffer_size);
+
   // ========== INTERNAL METHODS ==========
   // (In most use cases you won't need these)
   /// Set up this component.
   void pre_setup();
+  void loop() override;
+  /// loop() only outputs queued messages, so it's only called when set_async_buffer_size() is used.
+  bool has_overridden_loop() const override { return this->async_buffer_ != nullptr; }
   void dump_config() override;
+  void on_shutdown() override;
+  /// Queued messages wake up the loop (see App.wake_loop()), so this never needs to be polled.
+  bool needs_polling() const override { return false; }
 
   int level_for(const char *tag);
 
   /// Register a callback that will be called for every log message sent
   void add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback);
 
+#ifdef USE_BINARY_LOGGING
+  /** Register a callback that is only needed while set_text_log_requested(true), e.g. for remote log subscriptions.
+   *
+   * Messages aren't formatted at all when no one needs their text (serial logging disabled, no other
+   * log callbacks and no text requested).
+   */
+  void add_on_optional_log_callback(std::function<void(int, const char *, const char *)> &&callback);
+  void set_text_log_requested(bool requested) { this->text_log_requested_ = requested; }
+  /// Register a callback for messages in the binary format (see binary_log.h), only encoded while requested.
+  void add_on_binary_log_callback(std::function<void(int, const char *, const uint8_t *, size_t)> &&callback);
+  void set_binary_log_requested(bool requested) { this->binary_log_requested_ = requested; }
+  /** Whether the message currently passed to the log callbacks has no binary form.
+   *
+   * Its format string isn't in the string table (see binary_log_has_format()), so binary subscribers need the text.
+   */
+  bool is_binary_log_fallback() const { return this->binary_log_fallback_; }
+#endif
+
   float get_setup_priority() const override;
 
   void log_vprintf_(int level, const char *tag, int line, const char *format, va_list args);  // NOLINT
@@ -61,7 +94,41 @@ class Logger : public Component {
  protected:
   void write_header_(int level, const char *tag, int line);
   void write_footer_();
-  void log_message_(int level, const char *tag, int offset = 0);
+  /// binary_log_fallback: no binary form of this message was sent, see is_binary_log_fallback().
+  void log_message_(int level, const char *tag, int offset = 0, bool binary_log_fallback = false);
+#ifdef USE_BINARY_LOGGING
+  bool is_text_log_needed_() const {
+    return this->baud_rate_ > 0 || this->has_log_callbacks_ || this->text_log_requested_;
+  }
+  /** Encode and pass a message to the binary log callbacks, format_key identifies the format string.
+   *
+   * Returns false if the format string isn't in the string table, then the message has to be sent as text.
+   */
+  bool log_binary_(int level, const char *tag, int line, const void *format_key, const char *format, va_list args);
+#endif
+
+  /// Header of a message in the async ring buffer, followed by the message itself (null terminated).
+  struct AsyncLogRecord {
+    /// Length of the message without null terminator, ASYNC_WRAP_MARKER if the next record is at the start.
+    uint16_t length;
+    uint16_t line;
+    uint8_t level;
+    bool binary_log_fallback;
+    const char *tag;
+  };
+  static const uint16_t ASYNC_WRAP_MARKER = 0xFFFF;
+  /// Size of a record with a message of the given length, including padding for alignment of the next record.
+  static size_t async_record_size_(size_t length) {
+    const size_t size = sizeof(AsyncLogRecord) + length + 1;
+    return (size + alignof(AsyncLogRecord) - 1) & ~(alignof(AsyncLogRecord) - 1);
+  }
+  /// Whether a message logged now should go to the async ring buffer.
+  bool use_async_();
+  /// Reserve space for a record with a message of up to tx_buffer_size_ characters, nullptr if full.
+  AsyncLogRecord *async_reserve_();
+  void async_commit_(AsyncLogRecord *record);
+  /// Output all queued messages.
+  void async_drain_();
 
   inline bool is_buffer_full_() const { return this->tx_buffer_at_ >= this->tx_buffer_size_; }
   inline int buffer_remaining_capacity_() const { return this->tx_buffer_size_ - this->tx_buffer_at_; }
@@ -112,7 +179,49 @@ class Logger : public Component {
     int level;
   };
   std::vector<LogLevelOverride> log_levels_;
+  /// Results of level_for(), direct-mapped by the tag pointer (tags are string literals).
+  struct LevelCacheEntry {
+    const char *tag;
+    int level;
+  };
+  static const uint8_t LEVEL_CACHE_SIZE = 16;
+  LevelCacheEntry level_cache_[LEVEL_CACHE_SIZE]{};
+
+  // Single producer (the main loop) / single consumer (loop() of this component) ring buffer.
+  uint8_t *async_buffer_{nullptr};
+  size_t async_buffer_size_{0};
+  /// Write position, only modified by the producer.
+  std::atomic<size_t> async_head_{0};
+  /// Read position, only modified by the consumer.
+  std::atomic<size_t> async_tail_{0};
+  uint32_t async_dropped_{0};
+  uint32_t async_reported_dropped_{0};
+  bool async_active_{false};
+#ifdef USE_STORE_LOG_STR_IN_FLASH
+  /// Copy of the format string of a message that is queued, see log_vprintf_().
+  char *async_format_buffer_{nullptr};
+#endif
+#ifdef ARDUINO_ARCH_ESP32
+  void *loop_task_handle_{nullptr};
+#endif
   CallbackManager<void(int, const char *, const char *)> log_callback_{};
+#ifdef USE_BINARY_LOGGING
+  bool has_log_callbacks_{false};
+  bool text_log_requested_{false};
+  bool binary_log_requested_{false};
+  bool binary_log_fallback_{false};
+  uint8_t *binary_buffer_{nullptr};
+  /// Format string IDs, direct-mapped by the format string pointer.
+  struct FormatIdCacheEntry {
+    const void *format;
+    uint32_t id;
+    /// Whether id is in the string table.
+    bool known;
+  };
+  static const uint8_t FORMAT_ID_CACHE_SIZE = 32;
+  FormatIdCacheEntry format_id_cache_[FORMAT_ID_CACHE_SIZE]{};
+  CallbackManager<void(int, const char *, const uint8_t *, size_t)> binary_log_callback_{};
+#endif
 };
 
 extern Logger *global_logger;
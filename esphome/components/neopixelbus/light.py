@@ -29,6 +29,8 @@ ESPNeoPixelOrder = neopixelbus_ns.namespace("ESPNeoPixelOrder")
 NeoRgbFeature = cg.global_ns.NeoRgbFeature
 NeoRgbwFeature = cg.global_ns.NeoRgbwFeature
 
+CONF_DOUBLE_BUFFER = "double_buffer"
+
 
 def validate_type(value):
     value = cv.string(value).upper()
@@ -174,6 +176,7 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_CLOCK_PIN): pins.output_pin,
             cv.Optional(CONF_DATA_PIN): pins.output_pin,
             cv.Required(CONF_NUM_LEDS): cv.positive_not_null_int,
+            cv.Optional(CONF_DOUBLE_BUFFER, default=False): cv.boolean,
         }
     ).extend(cv.COMPONENT_SCHEMA),
     validate,
@@ -203,6 +206,7 @@ def to_code(config):
         )
 
     cg.add(var.set_pixel_order(getattr(ESPNeoPixelOrder, config[CONF_TYPE])))
+    cg.add(var.set_double_buffer(config[CONF_DOUBLE_BUFFER]))
 
     # https://github.com/Makuna/NeoPixelBus/blob/master/library.json
     cg.add_library("NeoPixelBus-esphome", "2.5.7")
@@ -12,6 +12,8 @@
 
 #include "NeoPixelBus.h"
 
+#include <cstring>
+
 namespace esphome {
 namespace neopixelbus {
 
@@ -72,24 +74,51 @@ class NeoPixelBusLightOutputBase : public light::AddressableLight {
     // this->controller_->Begin();
   }
 
+  /** Render into a separate buffer instead of the one of NeoPixelBus.
+   *
+   * With the asynchronous methods (RMT, DMA, UART on ESP8266) the previous frame is still being sent while the next
+   * one is rendered. NeoPixelBus then normally copies the complete frame back into its buffer on every Show() to keep
+   * it up to date, now only the LEDs that changed are copied into it.
+   */
+  void set_double_buffer(bool double_buffer) { this->double_buffer_ = double_buffer; }
+
   // ========== INTERNAL METHODS ==========
   void setup() override {
+    if (this->double_buffer_)
+      this->back_buffer_ = new uint8_t[this->controller_->PixelsSize()]();
     for (int i = 0; i < this->size(); i++) {
       (*this)[i] = Color(0, 0, 0, 0);
     }
 
     this->effect_data_ = new uint8_t[this->size()];
     this->controller_->Begin();
+    // the first Show() has to copy the whole back buffer
+    if (this->back_buffer_ != nullptr)
+      this->mark_dirty_(0, this->size());
   }
 
   void loop() override {
     if (!this->should_show_())
       return;
 
+    if (this->back_buffer_ != nullptr) {
+      // Show() of the asynchronous methods swaps buffers, so the buffer of NeoPixelBus can still hold the frame
+      // before the last one and lacks the changes of the last frame as well
+      light::ESPDirtyRange copy = this->dirty_;
+      copy.add(this->previous_dirty_.begin, this->previous_dirty_.end);
+      this->previous_dirty_ = this->dirty_;
+      if (!copy.is_empty()) {
+        const size_t offset = copy.begin * T_COLOR_FEATURE::PixelSize;
+        memcpy(this->controller_->Pixels() + offset, this->back_buffer_ + offset,
+               (copy.end - copy.begin) * T_COLOR_FEATURE::PixelSize);
+      }
+    }
+
     this->mark_shown_();
     this->controller_->Dirty();
 
-    this->controller_->Show();
+    // the buffers are kept in sync above, no need for NeoPixelBus to copy the whole frame
+    this->controller_->Show(this->back_buffer_ == nullptr);
   }
 
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
@@ -105,9 +134,18 @@ class NeoPixelBusLightOutputBase : public light::AddressableLight {
   }
 
  protected:
+  /// The buffer the colors are rendered into.
+  uint8_t *pixels_() const {
+    return this->back_buffer_ != nullptr ? this->back_buffer_ : this->controller_->Pixels();
+  }
+
   NeoPixelBus<T_COLOR_FEATURE, T_METHOD> *controller_{nullptr};
   uint8_t *effect_data_{nullptr};
   uint8_t rgb_offsets_[4]{0, 1, 2, 3};
+  bool double_buffer_{false};
+  uint8_t *back_buffer_{nullptr};
+  /// LEDs that were changed before the last Show(), only used with the back buffer.
+  light::ESPDirtyRange previous_dirty_{};
 };
 
 template<typename T_METHOD, typename T_COLOR_FEATURE = NeoRgbFeature>
@@ -122,10 +160,17 @@ class NeoPixelRGBLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_COL
 
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override {  // NOLINT
-    uint8_t *base = this->controller_->Pixels() + 3ULL * index;
+    uint8_t *base = this->pixels_() + 3ULL * index;
     return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
                                nullptr, this->effect_data_ + index, &this->correction_);
   }
+  bool get_buffer_layout(light::ESPColorBufferLayout *layout) const override {
+    *layout = {this->pixels_(),
+               3,
+               {this->rgb_offsets_[0], this->rgb_offsets_[1], this->rgb_offsets_[2], 0},
+               false};
+    return true;
+  }
 };
 
 template<typename T_METHOD, typename T_COLOR_FEATURE = NeoRgbwFeature>
@@ -141,10 +186,17 @@ class NeoPixelRGBWLightOutput : public NeoPixelBusLightOutputBase<T_METHOD, T_CO
 
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override {  // NOLINT
-    uint8_t *base = this->controller_->Pixels() + 4ULL * index;
+    uint8_t *base = this->pixels_() + 4ULL * index;
     return light::ESPColorView(base + this->rgb_offsets_[0], base + this->rgb_offsets_[1], base + this->rgb_offsets_[2],
                                base + this->rgb_offsets_[3], this->effect_data_ + index, &this->correction_);
   }
+  bool get_buffer_layout(light::ESPColorBufferLayout *layout) const override {
+    *layout = {this->pixels_(),
+               4,
+               {this->rgb_offsets_[0], this->rgb_offsets_[1], this->rgb_offsets_[2], this->rgb_offsets_[3]},
+               true};
+    return true;
+  }
 };
 
 }  // namespace neopixelbus
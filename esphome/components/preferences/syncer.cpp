@@ -0,0 +1,29 @@
+#include "syncer.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace preferences {
+
+static const char *TAG = "preferences";
+
+void IntervalSyncer::setup() {
+  global_preferences.set_defer_writes(true);
+  this->set_interval("sync", this->write_interval_, []() { global_preferences.sync(); });
+}
+void IntervalSyncer::dump_config() {
+  ESP_LOGCONFIG(TAG, "Preferences:");
+  ESP_LOGCONFIG(TAG, "  Flash Write Interval: %u ms", this->write_interval_);
+#ifdef ARDUINO_ARCH_ESP8266
+  const auto &stats = global_preferences.get_flash_stats();
+  ESP_LOGCONFIG(TAG, "  Records Written: %u", stats.records_written);
+  ESP_LOGCONFIG(TAG, "  Words Written: %u", stats.words_written);
+  ESP_LOGCONFIG(TAG, "  Pages Erased: %u", stats.pages_erased);
+#endif
+}
+void IntervalSyncer::on_safe_shutdown() { global_preferences.sync(); }
+void IntervalSyncer::on_shutdown() { global_preferences.sync(); }
+// before the other components, so that their saves during setup are deferred as well
+float IntervalSyncer::get_setup_priority() const { return setup_priority::BUS; }
+
+}  // namespace preferences
+}  // namespace esphome
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/preferences.h"
+
+namespace esphome {
+namespace preferences {
+
+/// Collects preference changes in RAM and writes them to flash in a fixed interval to reduce flash wear.
+class IntervalSyncer : public Component {
+ public:
+  void set_write_interval(uint32_t write_interval) { this->write_interval_ = write_interval; }
+
+  void setup() override;
+  void dump_config() override;
+  void on_safe_shutdown() override;
+  void on_shutdown() override;
+  float get_setup_priority() const override;
+
+ protected:
+  uint32_t write_interval_;
+};
+
+}  // namespace preferences
+}  // namespace esphome
@@ -0,0 +1,24 @@
+import esphome.config_validation as cv
+import esphome.codegen as cg
+from esphome.const import CONF_ID
+
+DEPENDENCIES = ["logger"]
+
+profiler_ns = cg.esphome_ns.namespace("profiler")
+ProfilerComponent = profiler_ns.class_("ProfilerComponent", cg.PollingComponent)
+
+CONF_RESET_ON_REPORT = "reset_on_report"
+
+CONFIG_SCHEMA = cv.Schema(
+    {
+        cv.GenerateID(): cv.declare_id(ProfilerComponent),
+        cv.Optional(CONF_RESET_ON_REPORT, default=False): cv.boolean,
+    }
+).extend(cv.polling_component_schema("60s"))
+
+
+def to_code(config):
+    cg.add_define("USE_COMPONENT_PROFILER")
+    var = cg.new_Pvariable(config[CONF_ID])
+    yield cg.register_component(var, config)
+    cg.add(var.set_reset_on_report(config[CONF_RESET_ON_REPORT]))
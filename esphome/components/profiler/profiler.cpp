@@ -0,0 +1,41 @@
+#include "profiler.h"
+#include "esphome/core/log.h"
+#include "esphome/core/application.h"
+
+namespace esphome {
+namespace profiler {
+
+static const char *TAG = "profiler";
+
+#ifdef USE_COMPONENT_PROFILER
+static void log_stats(const char *source, const char *name, const TimingStats &stats) {
+  if (stats.get_count() == 0)
+    return;
+  ESP_LOGI(TAG, "  %-24s %-9s count=%u min=%uus avg=%uus max=%uus p99=%uus", source, name, stats.get_count(),
+           stats.get_min(), stats.get_average(), stats.get_max(), stats.get_percentile(99.0f));
+}
+#endif
+
+void ProfilerComponent::update() {
+#ifdef USE_COMPONENT_PROFILER
+  ESP_LOGI(TAG, "Component timings:");
+  for (auto *component : App.get_components()) {
+    ComponentProfile &profile = component->get_profile();
+    const char *source = component->get_component_source();
+    log_stats(source, "loop", profile.loop);
+    log_stats(source, "update", profile.update);
+    log_stats(source, "scheduler", profile.scheduler);
+    if (this->reset_on_report_)
+      profile.reset();
+  }
+#endif
+}
+void ProfilerComponent::dump_config() {
+  ESP_LOGCONFIG(TAG, "Profiler:");
+  LOG_UPDATE_INTERVAL(this);
+  ESP_LOGCONFIG(TAG, "  Reset On Report: %s", YESNO(this->reset_on_report_));
+}
+float ProfilerComponent::get_setup_priority() const { return setup_priority::LATE; }
+
+}  // namespace profiler
+}  // namespace esphome
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "esphome/core/component.h"
+#include "esphome/core/defines.h"
+
+namespace esphome {
+namespace profiler {
+
+/// Periodically logs how much time each component spends in loop(), update() and its timeouts/intervals.
+class ProfilerComponent : public PollingComponent {
+ public:
+  void set_reset_on_report(bool reset_on_report) { this->reset_on_report_ = reset_on_report; }
+
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override;
+
+ protected:
+  bool reset_on_report_{false};
+};
+
+}  // namespace profiler
+}  // namespace esphome
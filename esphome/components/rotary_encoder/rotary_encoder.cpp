@@ -1,5 +1,6 @@
 #include "rotary_encoder.h"
 #include "esphome/core/log.h"
+#include "esphome/core/application.h"
 #include "esphome/core/helpers.h"
 
 namespace esphome {
@@ -118,6 +119,7 @@ void ICACHE_RAM_ATTR HOT RotaryEncoderSensorStore::gpio_intr(RotaryEncoderSensor
     } else {
       *std::prev(first_zero) += rotation_dir;  // store the rotation into the previous slot
     }
+    App.wake_loop();
   }
 
   arg->state = new_state;
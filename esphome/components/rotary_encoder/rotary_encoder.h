@@ -64,6 +64,8 @@ class RotaryEncoderSensor : public sensor::Sensor, public Component {
   void setup() override;
   void dump_config() override;
   void loop() override;
+  /// Rotation is captured by the ISR, which wakes up the main loop. Only the index pin has to be polled.
+  bool needs_polling() const override { return this->pin_i_ != nullptr; }
 
   float get_setup_priority() const override;
 
@@ -24,6 +24,7 @@ from esphome.const import (
     CONF_SEND_FIRST_AT,
     CONF_TO,
     CONF_TRIGGER_ID,
+    CONF_TYPE_ID,
     CONF_UNIT_OF_MEASUREMENT,
     CONF_WINDOW_SIZE,
     CONF_NAME,
@@ -127,6 +128,7 @@ SlidingWindowMovingAverageFilter = sensor_ns.class_(
 ExponentialMovingAverageFilter = sensor_ns.class_(
     "ExponentialMovingAverageFilter", Filter
 )
+StatisticsFilter = sensor_ns.class_("StatisticsFilter", Filter)
 LambdaFilter = sensor_ns.class_("LambdaFilter", Filter)
 OffsetFilter = sensor_ns.class_("OffsetFilter", Filter)
 MultiplyFilter = sensor_ns.class_("MultiplyFilter", Filter)
@@ -139,6 +141,33 @@ OrFilter = sensor_ns.class_("OrFilter", Filter)
 CalibrateLinearFilter = sensor_ns.class_("CalibrateLinearFilter", Filter)
 CalibratePolynomialFilter = sensor_ns.class_("CalibratePolynomialFilter", Filter)
 SensorInRangeCondition = sensor_ns.class_("SensorInRangeCondition", Filter)
+FixedPointFilter = sensor_ns.class_("FixedPointFilter", Filter)
+
+# Filters that have a Q16.16 fixed-point version with the same constructor arguments
+FIXED_POINT_FILTERS = [
+    (OffsetFilter, sensor_ns.class_("FixedPointOffsetFilter", FixedPointFilter)),
+    (MultiplyFilter, sensor_ns.class_("FixedPointMultiplyFilter", FixedPointFilter)),
+    (
+        CalibrateLinearFilter,
+        sensor_ns.class_("FixedPointCalibrateLinearFilter", FixedPointFilter),
+    ),
+    (DeltaFilter, sensor_ns.class_("FixedPointDeltaFilter", FixedPointFilter)),
+    (
+        SlidingWindowMovingAverageFilter,
+        sensor_ns.class_(
+            "FixedPointSlidingWindowMovingAverageFilter", FixedPointFilter
+        ),
+    ),
+    (
+        ExponentialMovingAverageFilter,
+        sensor_ns.class_("FixedPointExponentialMovingAverageFilter", FixedPointFilter),
+    ),
+]
+
+CONF_FIXED_POINT = "fixed_point"
+CONF_MIN = "min"
+CONF_MAX = "max"
+CONF_STDDEV = "stddev"
 
 unit_of_measurement = cv.string_strict
 accuracy_decimals = cv.int_
@@ -159,6 +188,8 @@ SENSOR_SCHEMA = cv.MQTT_COMPONENT_SCHEMA.extend(
             cv.Any(None, cv.positive_time_period_milliseconds),
         ),
         cv.Optional(CONF_FILTERS): validate_filters,
+        # Avoid software floating point in the filters, values must stay within +-32767
+        cv.Optional(CONF_FIXED_POINT): cv.boolean,
         cv.Optional(CONF_ON_VALUE): automation.validate_automation(
             {
                 cv.GenerateID(CONF_TRIGGER_ID): cv.declare_id(SensorStateTrigger),
@@ -231,7 +262,7 @@ def filter_out_filter_to_code(config, filter_id):
 MEDIAN_SCHEMA = cv.All(
     cv.Schema(
         {
-            cv.Optional(CONF_WINDOW_SIZE, default=5): cv.positive_not_null_int,
+            cv.Optional(CONF_WINDOW_SIZE, default=5): cv.int_range(min=1, max=65535),
             cv.Optional(CONF_SEND_EVERY, default=5): cv.positive_not_null_int,
             cv.Optional(CONF_SEND_FIRST_AT, default=1): cv.positive_not_null_int,
         }
@@ -320,6 +351,41 @@ def sliding_window_moving_average_filter_to_code(config, filter_id):
     )
 
 
+STATISTICS_SCHEMA = cv.All(
+    cv.Schema(
+        {
+            cv.Optional(CONF_WINDOW_SIZE, default=15): cv.positive_not_null_int,
+            cv.Optional(CONF_SEND_EVERY, default=15): cv.positive_not_null_int,
+            cv.Optional(CONF_SEND_FIRST_AT, default=1): cv.positive_not_null_int,
+            cv.Optional(CONF_MIN): SENSOR_SCHEMA,
+            cv.Optional(CONF_MAX): SENSOR_SCHEMA,
+            cv.Optional(CONF_STDDEV): SENSOR_SCHEMA,
+        }
+    ),
+    validate_send_first_at,
+)
+
+
+@FILTER_REGISTRY.register("statistics", StatisticsFilter, STATISTICS_SCHEMA)
+def statistics_filter_to_code(config, filter_id):
+    var = cg.new_Pvariable(
+        filter_id,
+        config[CONF_WINDOW_SIZE],
+        config[CONF_SEND_EVERY],
+        config[CONF_SEND_FIRST_AT],
+    )
+    if CONF_MIN in config:
+        sens = yield new_sensor(config[CONF_MIN])
+        cg.add(var.set_min_sensor(sens))
+    if CONF_MAX in config:
+        sens = yield new_sensor(config[CONF_MAX])
+        cg.add(var.set_max_sensor(sens))
+    if CONF_STDDEV in config:
+        sens = yield new_sensor(config[CONF_STDDEV])
+        cg.add(var.set_stddev_sensor(sens))
+    yield var
+
+
 @FILTER_REGISTRY.register(
     "exponential_moving_average",
     ExponentialMovingAverageFilter,
@@ -441,6 +507,16 @@ def calibrate_polynomial_filter_to_code(config, filter_id):
     yield cg.new_Pvariable(filter_id, res)
 
 
+def use_fixed_point_filters(config):
+    """Replace the filters that have a fixed-point version with it."""
+    for conf in config:
+        type_id = conf[CONF_TYPE_ID]
+        for float_type, fixed_type in FIXED_POINT_FILTERS:
+            if type_id.type is float_type:
+                type_id.type = fixed_type
+                break
+
+
 @coroutine
 def build_filters(config):
     yield cg.build_registry_list(FILTER_REGISTRY, config)
@@ -461,6 +537,8 @@ def setup_sensor_core_(var, config):
         cg.add(var.set_accuracy_decimals(config[CONF_ACCURACY_DECIMALS]))
     cg.add(var.set_force_update(config[CONF_FORCE_UPDATE]))
     if config.get(CONF_FILTERS):  # must exist and not be empty
+        if config.get(CONF_FIXED_POINT, False):
+            use_fixed_point_filters(config[CONF_FILTERS])
         filters = yield build_filters(config[CONF_FILTERS])
         cg.add(var.set_filters(filters))
 
@@ -15,6 +15,10 @@ void Filter::input(float value) {
   if (out.has_value())
     this->output(*out);
 }
+void Filter::input_batch(const float *values, size_t count) {
+  for (size_t i = 0; i < count; i++)
+    this->input(values[i]);
+}
 void Filter::output(float value) {
   if (this->next_ == nullptr) {
     ESP_LOGVV(TAG, "Filter(%p)::output(%f) -> SENSOR", this, value);
@@ -24,6 +28,16 @@ void Filter::output(float value) {
     this->next_->input(value);
   }
 }
+void Filter::output_batch(const float *values, size_t count) {
+  if (this->next_ == nullptr) {
+    ESP_LOGVV(TAG, "Filter(%p)::output_batch(%zu values) -> SENSOR", this, count);
+    for (size_t i = 0; i < count; i++)
+      this->parent_->internal_send_state_to_frontend(values[i]);
+  } else {
+    ESP_LOGVV(TAG, "Filter(%p)::output_batch(%zu values) -> %p", this, count, this->next_);
+    this->next_->input_batch(values, count);
+  }
+}
 void Filter::initialize(Sensor *parent, Filter *next) {
   ESP_LOGVV(TAG, "Filter(%p)::initialize(parent=%p next=%p)", this, parent, next);
   this->parent_ = parent;
@@ -41,15 +55,105 @@ uint32_t Filter::calculate_remaining_interval(uint32_t input) {
 
 // MedianFilter
 MedianFilter::MedianFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
+    : send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->set_window_size(window_size);
+}
 void MedianFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MedianFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
+void MedianFilter::set_window_size(size_t window_size) {
+  this->window_size_ = window_size;
+  this->values_.assign(window_size, 0.0f);
+  this->positions_.assign(window_size, 0);
+  // each heap holds at most one more than half of the values, even before they're rebalanced
+  this->lower_.clear();
+  this->lower_.reserve(window_size / 2 + 1);
+  this->upper_.clear();
+  this->upper_.reserve(window_size / 2 + 1);
+  this->count_ = 0;
+  this->oldest_ = 0;
+}
+bool MedianFilter::before_(bool upper, uint16_t a, uint16_t b) const {
+  return upper ? this->values_[a] < this->values_[b] : this->values_[a] > this->values_[b];
+}
+void MedianFilter::place_(bool upper, size_t index, uint16_t slot) {
+  (upper ? this->upper_ : this->lower_)[index] = slot;
+  this->positions_[slot] = upper ? ~index : index;
+}
+size_t MedianFilter::index_of_(uint16_t slot) const {
+  const int16_t position = this->positions_[slot];
+  return position < 0 ? ~position : position;
+}
+void MedianFilter::sift_up_(bool upper, size_t index) {
+  auto &heap = upper ? this->upper_ : this->lower_;
+  const uint16_t slot = heap[index];
+  while (index > 0) {
+    const size_t parent = (index - 1) / 2;
+    if (!this->before_(upper, slot, heap[parent]))
+      break;
+    this->place_(upper, index, heap[parent]);
+    index = parent;
+  }
+  this->place_(upper, index, slot);
+}
+void MedianFilter::sift_down_(bool upper, size_t index) {
+  auto &heap = upper ? this->upper_ : this->lower_;
+  const uint16_t slot = heap[index];
+  while (true) {
+    size_t child = index * 2 + 1;
+    if (child >= heap.size())
+      break;
+    if (child + 1 < heap.size() && this->before_(upper, heap[child + 1], heap[child]))
+      child++;
+    if (!this->before_(upper, heap[child], slot))
+      break;
+    this->place_(upper, index, heap[child]);
+    index = child;
+  }
+  this->place_(upper, index, slot);
+}
+void MedianFilter::push_(bool upper, uint16_t slot) {
+  auto &heap = upper ? this->upper_ : this->lower_;
+  heap.push_back(slot);
+  this->sift_up_(upper, heap.size() - 1);
+}
+uint16_t MedianFilter::pop_(bool upper) {
+  auto &heap = upper ? this->upper_ : this->lower_;
+  const uint16_t top = heap.front();
+  heap.front() = heap.back();
+  heap.pop_back();
+  if (!heap.empty())
+    this->sift_down_(upper, 0);
+  return top;
+}
 optional<float> MedianFilter::new_value(float value) {
-  if (!isnan(value)) {
-    while (this->queue_.size() >= this->window_size_) {
-      this->queue_.pop_front();
+  if (!isnan(value) && this->window_size_ > 0) {
+    if (this->count_ < this->window_size_) {
+      const uint16_t slot = this->count_++;
+      this->values_[slot] = value;
+      this->push_(!this->lower_.empty() && value > this->values_[this->lower_.front()], slot);
+      // the lower heap has the same number of values as the upper one or one more
+      if (this->lower_.size() > this->upper_.size() + 1) {
+        this->push_(true, this->pop_(false));
+      } else if (this->upper_.size() > this->lower_.size()) {
+        this->push_(false, this->pop_(true));
+      }
+    } else {
+      // replace the oldest value, it stays in its heap
+      const uint16_t slot = this->oldest_;
+      if (++this->oldest_ == this->window_size_)
+        this->oldest_ = 0;
+      this->values_[slot] = value;
+      const bool upper = this->positions_[slot] < 0;
+      this->sift_up_(upper, this->index_of_(slot));
+      this->sift_down_(upper, this->index_of_(slot));
+      // the new value may belong in the other half, then the tops of the heaps are exchanged
+      if (!this->upper_.empty() && this->values_[this->lower_.front()] > this->values_[this->upper_.front()]) {
+        const uint16_t lower_top = this->lower_.front();
+        this->place_(false, 0, this->upper_.front());
+        this->place_(true, 0, lower_top);
+        this->sift_down_(false, 0);
+        this->sift_down_(true, 0);
+      }
     }
-    this->queue_.push_back(value);
     ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f)", this, value);
   }
 
@@ -57,16 +161,10 @@ optional<float> MedianFilter::new_value(float value) {
     this->send_at_ = 0;
 
     float median = 0.0f;
-    if (!this->queue_.empty()) {
-      std::deque<float> median_queue = this->queue_;
-      sort(median_queue.begin(), median_queue.end());
-
-      size_t queue_size = median_queue.size();
-      if (queue_size % 2) {
-        median = median_queue[queue_size / 2];
-      } else {
-        median = (median_queue[queue_size / 2] + median_queue[(queue_size / 2) - 1]) / 2.0f;
-      }
+    if (this->count_ % 2) {
+      median = this->values_[this->lower_.front()];
+    } else if (this->count_ > 0) {
+      median = (this->values_[this->lower_.front()] + this->values_[this->upper_.front()]) / 2.0f;
     }
 
     ESP_LOGVV(TAG, "MedianFilter(%p)::new_value(%f) SENDING", this, median);
@@ -77,67 +175,53 @@ optional<float> MedianFilter::new_value(float value) {
 
 uint32_t MedianFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
 
-// MinFilter
-MinFilter::MinFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
-void MinFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MinFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
-optional<float> MinFilter::new_value(float value) {
-  if (!isnan(value)) {
-    while (this->queue_.size() >= this->window_size_) {
-      this->queue_.pop_front();
-    }
-    this->queue_.push_back(value);
-    ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f)", this, value);
-  }
-
-  if (++this->send_at_ >= this->send_every_) {
-    this->send_at_ = 0;
-
-    float min = 0.0f;
-    if (!this->queue_.empty()) {
-      std::deque<float>::iterator it = std::min_element(queue_.begin(), queue_.end());
-      min = *it;
-    }
-
-    ESP_LOGVV(TAG, "MinFilter(%p)::new_value(%f) SENDING", this, min);
-    return min;
-  }
-  return {};
+// SlidingWindowExtremeFilter
+SlidingWindowExtremeFilter::SlidingWindowExtremeFilter(size_t window_size, size_t send_every, size_t send_first_at,
+                                                       bool find_max)
+    : find_max_(find_max), send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->set_window_size(window_size);
 }
-
-uint32_t MinFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
-
-// MaxFilter
-MaxFilter::MaxFilter(size_t window_size, size_t send_every, size_t send_first_at)
-    : send_every_(send_every), send_at_(send_every - send_first_at), window_size_(window_size) {}
-void MaxFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
-void MaxFilter::set_window_size(size_t window_size) { this->window_size_ = window_size; }
-optional<float> MaxFilter::new_value(float value) {
-  if (!isnan(value)) {
-    while (this->queue_.size() >= this->window_size_) {
-      this->queue_.pop_front();
+void SlidingWindowExtremeFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
+void SlidingWindowExtremeFilter::set_window_size(size_t window_size) {
+  this->window_size_ = window_size;
+  this->queue_.resize(window_size);
+  this->head_ = 0;
+  this->size_ = 0;
+}
+optional<float> SlidingWindowExtremeFilter::new_value(float value) {
+  if (!isnan(value) && this->window_size_ > 0) {
+    const uint32_t index = this->next_index_++;
+    // drop the values that are no longer in the window
+    while (this->size_ > 0 && index - this->at_(0).index >= this->window_size_) {
+      if (++this->head_ == this->queue_.size())
+        this->head_ = 0;
+      this->size_--;
     }
-    this->queue_.push_back(value);
-    ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f)", this, value);
+    // and the ones that can't be the extreme anymore as long as the new value is in the window
+    while (this->size_ > 0) {
+      const float back = this->at_(this->size_ - 1).value;
+      if (this->find_max_ ? back > value : back < value)
+        break;
+      this->size_--;
+    }
+    this->at_(this->size_++) = Entry{value, index};
+    ESP_LOGVV(TAG, "%sFilter(%p)::new_value(%f)", this->find_max_ ? "Max" : "Min", this, value);
   }
 
   if (++this->send_at_ >= this->send_every_) {
     this->send_at_ = 0;
 
-    float max = 0.0f;
-    if (!this->queue_.empty()) {
-      std::deque<float>::iterator it = std::max_element(queue_.begin(), queue_.end());
-      max = *it;
-    }
+    float extreme = 0.0f;
+    if (this->size_ > 0)
+      extreme = this->at_(0).value;
 
-    ESP_LOGVV(TAG, "MaxFilter(%p)::new_value(%f) SENDING", this, max);
-    return max;
+    ESP_LOGVV(TAG, "%sFilter(%p)::new_value(%f) SENDING", this->find_max_ ? "Max" : "Min", this, extreme);
+    return extreme;
   }
   return {};
 }
 
-uint32_t MaxFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
+uint32_t SlidingWindowExtremeFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
 
 // SlidingWindowMovingAverageFilter
 SlidingWindowMovingAverageFilter::SlidingWindowMovingAverageFilter(size_t window_size, size_t send_every,
@@ -177,8 +261,90 @@ optional<float> SlidingWindowMovingAverageFilter::new_value(float value) {
   return {};
 }
 
+void SlidingWindowMovingAverageFilter::input_batch(const float *values, size_t count) {
+  // qualified calls aren't dispatched virtually and can be inlined
+  this->process_batch_(values, count,
+                       [this](float value) { return this->SlidingWindowMovingAverageFilter::new_value(value); });
+}
+
 uint32_t SlidingWindowMovingAverageFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
 
+// StatisticsFilter
+StatisticsFilter::StatisticsFilter(size_t window_size, size_t send_every, size_t send_first_at)
+    : values_(window_size), send_every_(send_every), send_at_(send_every - send_first_at) {}
+void StatisticsFilter::update_extremes_(float value) {
+  if (!this->extremes_valid_)
+    return;
+  if (isnan(this->min_) || value < this->min_)
+    this->min_ = value;
+  if (isnan(this->max_) || value > this->max_)
+    this->max_ = value;
+}
+void StatisticsFilter::recalculate_() {
+  float sum = 0.0f;
+  this->min_ = this->max_ = NAN;
+  this->extremes_valid_ = true;
+  for (size_t i = 0; i < this->count_; i++) {
+    sum += this->values_[i];
+    this->update_extremes_(this->values_[i]);
+  }
+  this->mean_ = sum / this->count_;
+  this->m2_ = 0.0f;
+  for (size_t i = 0; i < this->count_; i++) {
+    const float diff = this->values_[i] - this->mean_;
+    this->m2_ += diff * diff;
+  }
+}
+optional<float> StatisticsFilter::new_value(float value) {
+  if (!isnan(value) && !this->values_.empty()) {
+    if (this->count_ < this->values_.size()) {
+      this->values_[this->count_++] = value;
+      const float delta = value - this->mean_;
+      this->mean_ += delta / this->count_;
+      this->m2_ += delta * (value - this->mean_);
+      this->update_extremes_(value);
+    } else {
+      // replace the oldest value
+      const float old = this->values_[this->oldest_];
+      this->values_[this->oldest_] = value;
+      if (++this->oldest_ == this->values_.size()) {
+        this->oldest_ = 0;
+        this->recalculate_();
+      } else {
+        const float old_mean = this->mean_;
+        this->mean_ += (value - old) / this->count_;
+        this->m2_ += (value - old) * (value - this->mean_ + old - old_mean);
+        if (this->m2_ < 0.0f)
+          this->m2_ = 0.0f;
+        if (old <= this->min_ || old >= this->max_)
+          this->extremes_valid_ = false;
+        this->update_extremes_(value);
+      }
+    }
+    ESP_LOGVV(TAG, "StatisticsFilter(%p)::new_value(%f) -> mean %f", this, value, this->mean_);
+  }
+
+  if (++this->send_at_ >= this->send_every_) {
+    this->send_at_ = 0;
+    if (this->count_ == 0)
+      return 0.0f;
+    if (!this->extremes_valid_)
+      this->recalculate_();
+
+    ESP_LOGVV(TAG, "StatisticsFilter(%p)::new_value(%f) SENDING mean %f min %f max %f", this, value, this->mean_,
+              this->min_, this->max_);
+    if (this->min_sensor_ != nullptr)
+      this->min_sensor_->publish_state(this->min_);
+    if (this->max_sensor_ != nullptr)
+      this->max_sensor_->publish_state(this->max_);
+    if (this->stddev_sensor_ != nullptr)
+      this->stddev_sensor_->publish_state(sqrtf(this->m2_ / this->count_));
+    return this->mean_;
+  }
+  return {};
+}
+uint32_t StatisticsFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
+
 // ExponentialMovingAverageFilter
 ExponentialMovingAverageFilter::ExponentialMovingAverageFilter(float alpha, size_t send_every)
     : send_every_(send_every), send_at_(send_every - 1), alpha_(alpha) {}
@@ -201,6 +367,10 @@ optional<float> ExponentialMovingAverageFilter::new_value(float value) {
   }
   return {};
 }
+void ExponentialMovingAverageFilter::input_batch(const float *values, size_t count) {
+  this->process_batch_(values, count,
+                       [this](float value) { return this->ExponentialMovingAverageFilter::new_value(value); });
+}
 void ExponentialMovingAverageFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
 void ExponentialMovingAverageFilter::set_alpha(float alpha) { this->alpha_ = alpha; }
 uint32_t ExponentialMovingAverageFilter::expected_interval(uint32_t input) { return input * this->send_every_; }
@@ -220,11 +390,17 @@ optional<float> LambdaFilter::new_value(float value) {
 OffsetFilter::OffsetFilter(float offset) : offset_(offset) {}
 
 optional<float> OffsetFilter::new_value(float value) { return value + this->offset_; }
+void OffsetFilter::input_batch(const float *values, size_t count) {
+  this->process_batch_(values, count, [this](float value) { return value + this->offset_; });
+}
 
 // MultiplyFilter
 MultiplyFilter::MultiplyFilter(float multiplier) : multiplier_(multiplier) {}
 
 optional<float> MultiplyFilter::new_value(float value) { return value * this->multiplier_; }
+void MultiplyFilter::input_batch(const float *values, size_t count) {
+  this->process_batch_(values, count, [this](float value) { return value * this->multiplier_; });
+}
 
 // FilterOutValueFilter
 FilterOutValueFilter::FilterOutValueFilter(float value_to_filter_out) : value_to_filter_out_(value_to_filter_out) {}
@@ -339,6 +515,9 @@ float HeartbeatFilter::get_setup_priority() const { return setup_priority::HARDW
 
 optional<float> CalibrateLinearFilter::new_value(float value) { return value * this->slope_ + this->bias_; }
 CalibrateLinearFilter::CalibrateLinearFilter(float slope, float bias) : slope_(slope), bias_(bias) {}
+void CalibrateLinearFilter::input_batch(const float *values, size_t count) {
+  this->process_batch_(values, count, [this](float value) { return value * this->slope_ + this->bias_; });
+}
 
 optional<float> CalibratePolynomialFilter::new_value(float value) {
   float res = 0.0f;
@@ -349,6 +528,10 @@ optional<float> CalibratePolynomialFilter::new_value(float value) {
   }
   return res;
 }
+void CalibratePolynomialFilter::input_batch(const float *values, size_t count) {
+  this->process_batch_(values, count,
+                       [this](float value) { return this->CalibratePolynomialFilter::new_value(value); });
+}
 
 }  // namespace sensor
 }  // namespace esphome
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <queue>
+#include <vector>
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
 
@@ -32,6 +33,13 @@ class Filter {
 
   void input(float value);
 
+  /** Pass a block of values through the filter, in the same order as with input().
+   *
+   * The default implementation calls input() for each value. Filters that override this process the whole
+   * block in one call and pass their outputs on as a block too, so the chain is walked once per block.
+   */
+  virtual void input_batch(const float *values, size_t count);
+
   /// Return the amount of time that this filter is expected to take based on the input time interval.
   virtual uint32_t expected_interval(uint32_t input);
 
@@ -39,16 +47,43 @@ class Filter {
 
   void output(float value);
 
+  void output_batch(const float *values, size_t count);
+
+  /// Whether this is a FixedPointFilter.
+  virtual bool is_fixed_point() const { return false; }
+
  protected:
   friend Sensor;
 
+  /// Apply `new_value` (returning float or optional<float>) to all values and pass the results on in blocks.
+  template<typename F> void process_batch_(const float *values, size_t count, F &&new_value) {
+    float buffer[16];
+    size_t size = 0;
+    for (size_t i = 0; i < count; i++) {
+      optional<float> out = new_value(values[i]);
+      if (!out.has_value())
+        continue;
+      buffer[size++] = *out;
+      if (size == sizeof(buffer) / sizeof(buffer[0])) {
+        this->output_batch(buffer, size);
+        size = 0;
+      }
+    }
+    if (size != 0)
+      this->output_batch(buffer, size);
+  }
+
   Filter *next_{nullptr};
   Sensor *parent_{nullptr};
 };
 
 /** Simple median filter.
  *
- * Takes the median of the last <send_every> values and pushes it out every <send_every>.
+ * Takes the median of the last <window_size> values and pushes it out every <send_every>.
+ *
+ * The window is stored in a ring buffer that is split into two heaps around the median, a max-heap with the
+ * lower and a min-heap with the upper half of the values. So a new value is added in O(log window_size) and
+ * the median is always at the top of the heaps.
  */
 class MedianFilter : public Filter {
  public:
@@ -65,52 +100,100 @@ class MedianFilter : public Filter {
   optional<float> new_value(float value) override;
 
   void set_send_every(size_t send_every);
+  /// Change the window size, this clears the values in the window.
   void set_window_size(size_t window_size);
 
   uint32_t expected_interval(uint32_t input) override;
 
  protected:
-  std::deque<float> queue_;
+  /// Whether slot a belongs above slot b in the given heap.
+  bool before_(bool upper, uint16_t a, uint16_t b) const;
+  void place_(bool upper, size_t index, uint16_t slot);
+  /// Position of the slot in its heap.
+  size_t index_of_(uint16_t slot) const;
+  void sift_up_(bool upper, size_t index);
+  void sift_down_(bool upper, size_t index);
+  void push_(bool upper, uint16_t slot);
+  uint16_t pop_(bool upper);
+
+  /// Values in the window, indexed by slot. Once the window is full, the oldest slot is replaced.
+  std::vector<float> values_;
+  /// Position of each slot in its heap, bitwise negated for the upper heap.
+  std::vector<int16_t> positions_;
+  std::vector<uint16_t> lower_;
+  std::vector<uint16_t> upper_;
+  size_t count_{0};
+  size_t oldest_{0};
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
 };
 
-/** Simple min filter.
+/** Base class of the min and max filter.
  *
- * Takes the min of the last <send_every> values and pushes it out every <send_every>.
+ * Uses a monotonic queue in a ring buffer: values that can't be the extreme of any later window
+ * anymore (because a newer value is more extreme) are discarded, so the extreme of the current
+ * window is always at the front. A new value is added in amortized O(1).
  */
-class MinFilter : public Filter {
+class SlidingWindowExtremeFilter : public Filter {
  public:
-  /** Construct a MinFilter.
-   *
-   * @param window_size The number of values that the min should be returned from.
-   * @param send_every After how many sensor values should a new one be pushed out.
-   * @param send_first_at After how many values to forward the very first value. Defaults to the first value
-   *   on startup being published on the first *raw* value, so with no filter applied. Must be less than or equal to
-   *   send_every.
-   */
-  explicit MinFilter(size_t window_size, size_t send_every, size_t send_first_at);
+  SlidingWindowExtremeFilter(size_t window_size, size_t send_every, size_t send_first_at, bool find_max);
 
   optional<float> new_value(float value) override;
 
   void set_send_every(size_t send_every);
+  /// Change the window size, this clears the values in the window.
   void set_window_size(size_t window_size);
 
   uint32_t expected_interval(uint32_t input) override;
 
  protected:
-  std::deque<float> queue_;
+  struct Entry {
+    float value;
+    /// Number of the value in the order of arrival.
+    uint32_t index;
+  };
+
+  Entry &at_(size_t i) {
+    size_t pos = this->head_ + i;
+    if (pos >= this->queue_.size())
+      pos -= this->queue_.size();
+    return this->queue_[pos];
+  }
+
+  std::vector<Entry> queue_;
+  size_t head_{0};
+  size_t size_{0};
+  uint32_t next_index_{0};
+  bool find_max_;
   size_t send_every_;
   size_t send_at_;
   size_t window_size_;
 };
 
+/** Simple min filter.
+ *
+ * Takes the min of the last <window_size> values and pushes it out every <send_every>.
+ */
+class MinFilter : public SlidingWindowExtremeFilter {
+ public:
+  /** Construct a MinFilter.
+   *
+   * @param window_size The number of values that the min should be returned from.
+   * @param send_every After how many sensor values should a new one be pushed out.
+   * @param send_first_at After how many values to forward the very first value. Defaults to the first value
+   *   on startup being published on the first *raw* value, so with no filter applied. Must be less than or equal to
+   *   send_every.
+   */
+  explicit MinFilter(size_t window_size, size_t send_every, size_t send_first_at)
+      : SlidingWindowExtremeFilter(window_size, send_every, send_first_at, false) {}
+};
+
 /** Simple max filter.
  *
- * Takes the max of the last <send_every> values and pushes it out every <send_every>.
+ * Takes the max of the last <window_size> values and pushes it out every <send_every>.
  */
-class MaxFilter : public Filter {
+class MaxFilter : public SlidingWindowExtremeFilter {
  public:
   /** Construct a MaxFilter.
    *
@@ -120,20 +203,8 @@ class MaxFilter : public Filter {
    *   on startup being published on the first *raw* value, so with no filter applied. Must be less than or equal to
    *   send_every.
    */
-  explicit MaxFilter(size_t window_size, size_t send_every, size_t send_first_at);
-
-  optional<float> new_value(float value) override;
-
-  void set_send_every(size_t send_every);
-  void set_window_size(size_t window_size);
-
-  uint32_t expected_interval(uint32_t input) override;
-
- protected:
-  std::deque<float> queue_;
-  size_t send_every_;
-  size_t send_at_;
-  size_t window_size_;
+  explicit MaxFilter(size_t window_size, size_t send_every, size_t send_first_at)
+      : SlidingWindowExtremeFilter(window_size, send_every, send_first_at, true) {}
 };
 
 /** Simple sliding window moving average filter.
@@ -154,6 +225,7 @@ class SlidingWindowMovingAverageFilter : public Filter {
   explicit SlidingWindowMovingAverageFilter(size_t window_size, size_t send_every, size_t send_first_at);
 
   optional<float> new_value(float value) override;
+  void input_batch(const float *values, size_t count) override;
 
   void set_send_every(size_t send_every);
   void set_window_size(size_t window_size);
@@ -168,6 +240,54 @@ class SlidingWindowMovingAverageFilter : public Filter {
   size_t window_size_;
 };
 
+/** Statistics of a sliding window in a single filter.
+ *
+ * Passes on the mean of the last <window_size> values every <send_every> values and at the same time
+ * publishes their minimum, maximum and (population) standard deviation to the optional derived sensors.
+ * The values are kept in one ring buffer, the mean and variance are updated incrementally with Welford's
+ * algorithm and recalculated exactly once per pass through the ring so that no rounding errors accumulate.
+ */
+class StatisticsFilter : public Filter {
+ public:
+  /** Construct a StatisticsFilter.
+   *
+   * @param window_size The number of values that the statistics are calculated from.
+   * @param send_every After how many sensor values should a new one be pushed out.
+   * @param send_first_at After how many values to forward the very first value. Must be less than or equal to
+   *   send_every.
+   */
+  StatisticsFilter(size_t window_size, size_t send_every, size_t send_first_at);
+
+  optional<float> new_value(float value) override;
+
+  void set_min_sensor(Sensor *min_sensor) { this->min_sensor_ = min_sensor; }
+  void set_max_sensor(Sensor *max_sensor) { this->max_sensor_ = max_sensor; }
+  void set_stddev_sensor(Sensor *stddev_sensor) { this->stddev_sensor_ = stddev_sensor; }
+
+  uint32_t expected_interval(uint32_t input) override;
+
+ protected:
+  /// Calculate all statistics from the values in the window.
+  void recalculate_();
+  void update_extremes_(float value);
+
+  std::vector<float> values_;
+  size_t count_{0};
+  size_t oldest_{0};
+  float mean_{0.0f};
+  /// Sum of the squared differences from the mean.
+  float m2_{0.0f};
+  float min_{NAN};
+  float max_{NAN};
+  /// Whether min_ and max_ are up to date, the value that was removed from the window might have been one of them.
+  bool extremes_valid_{true};
+  size_t send_every_;
+  size_t send_at_;
+  Sensor *min_sensor_{nullptr};
+  Sensor *max_sensor_{nullptr};
+  Sensor *stddev_sensor_{nullptr};
+};
+
 /** Simple exponential moving average filter.
  *
  * Essentially just takes the average of the last few values using exponentially decaying weights.
@@ -178,6 +298,7 @@ class ExponentialMovingAverageFilter : public Filter {
   ExponentialMovingAverageFilter(float alpha, size_t send_every);
 
   optional<float> new_value(float value) override;
+  void input_batch(const float *values, size_t count) override;
 
   void set_send_every(size_t send_every);
   void set_alpha(float alpha);
@@ -220,6 +341,7 @@ class OffsetFilter : public Filter {
   explicit OffsetFilter(float offset);
 
   optional<float> new_value(float value) override;
+  void input_batch(const float *values, size_t count) override;
 
  protected:
   float offset_;
@@ -231,6 +353,7 @@ class MultiplyFilter : public Filter {
   explicit MultiplyFilter(float multiplier);
 
   optional<float> new_value(float value) override;
+  void input_batch(const float *values, size_t count) override;
 
  protected:
   float multiplier_;
@@ -327,6 +450,7 @@ class CalibrateLinearFilter : public Filter {
  public:
   CalibrateLinearFilter(float slope, float bias);
   optional<float> new_value(float value) override;
+  void input_batch(const float *values, size_t count) override;
 
  protected:
   float slope_;
@@ -337,6 +461,7 @@ class CalibratePolynomialFilter : public Filter {
  public:
   CalibratePolynomialFilter(const std::vector<float> &coefficients) : coefficients_(coefficients) {}
   optional<float> new_value(float value) override;
+  void input_batch(const float *values, size_t count) override;
 
  protected:
   std::vector<float> coefficients_;
@@ -0,0 +1,194 @@
+#include "fixed_point_filter.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace sensor {
+
+static const char *TAG = "sensor.filter";
+
+static fixed_t saturate(int64_t value) {
+  if (value > INT32_MAX)
+    return INT32_MAX;
+  // INT32_MIN is FIXED_NAN
+  if (value <= INT32_MIN)
+    return INT32_MIN + 1;
+  return value;
+}
+
+fixed_t float_to_fixed(float value) {
+  if (isnan(value))
+    return FIXED_NAN;
+  const float scaled = value * 65536.0f;
+  if (scaled >= 2147483647.0f)
+    return INT32_MAX;
+  if (scaled <= -2147483647.0f)
+    return INT32_MIN + 1;
+  return static_cast<fixed_t>(scaled + (scaled < 0.0f ? -0.5f : 0.5f));
+}
+float fixed_to_float(fixed_t value) {
+  if (value == FIXED_NAN)
+    return NAN;
+  return value / 65536.0f;
+}
+
+FixedPointScale::FixedPointScale(float value) {
+  if (value == 0.0f || isnan(value))
+    return;
+  int exponent;
+  const float mantissa = frexpf(value, &exponent);
+  // larger constants saturate every value that isn't 0 anyway
+  if (exponent > 30) {
+    this->mantissa_ = mantissa < 0.0f ? -(1 << 30) : (1 << 30);
+    return;
+  }
+  // smaller constants round every value to 0
+  if (exponent < -32)
+    return;
+  this->mantissa_ = lroundf(ldexpf(mantissa, 30));
+  this->shift_ = 30 - exponent;
+}
+int64_t FixedPointScale::apply(int64_t value) const {
+  const int64_t product = value * this->mantissa_;
+  if (this->shift_ == 0)
+    return product;
+  // round to nearest
+  return (product + (int64_t(1) << (this->shift_ - 1))) >> this->shift_;
+}
+
+// FixedPointFilter
+optional<float> FixedPointFilter::new_value(float value) {
+  fixed_t fixed = float_to_fixed(value);
+  FixedPointFilter *filter = this;
+  while (true) {
+    optional<fixed_t> out = filter->new_fixed_value(fixed);
+    if (!out.has_value())
+      return {};
+    fixed = *out;
+    if (filter->next_ == nullptr || !filter->next_->is_fixed_point())
+      break;
+    filter = static_cast<FixedPointFilter *>(filter->next_);
+  }
+  ESP_LOGVV(TAG, "FixedPointFilter(%p)::new_value(%f) -> %p", this, value, filter);
+
+  if (filter == this)
+    return fixed_to_float(fixed);
+  // skip the fixed-point filters in between, their part is done already
+  filter->output(fixed_to_float(fixed));
+  return {};
+}
+
+// FixedPointOffsetFilter
+FixedPointOffsetFilter::FixedPointOffsetFilter(float offset) : offset_(float_to_fixed(offset)) {}
+optional<fixed_t> FixedPointOffsetFilter::new_fixed_value(fixed_t value) {
+  if (value == FIXED_NAN)
+    return value;
+  return saturate(int64_t(value) + this->offset_);
+}
+
+// FixedPointMultiplyFilter
+FixedPointMultiplyFilter::FixedPointMultiplyFilter(float multiplier) : multiplier_(multiplier) {}
+optional<fixed_t> FixedPointMultiplyFilter::new_fixed_value(fixed_t value) {
+  if (value == FIXED_NAN)
+    return value;
+  return saturate(this->multiplier_.apply(value));
+}
+
+// FixedPointCalibrateLinearFilter
+FixedPointCalibrateLinearFilter::FixedPointCalibrateLinearFilter(float slope, float bias)
+    : slope_(slope), bias_(float_to_fixed(bias)) {}
+optional<fixed_t> FixedPointCalibrateLinearFilter::new_fixed_value(fixed_t value) {
+  if (value == FIXED_NAN)
+    return value;
+  return saturate(this->slope_.apply(value) + this->bias_);
+}
+
+// FixedPointDeltaFilter
+FixedPointDeltaFilter::FixedPointDeltaFilter(float min_delta) : min_delta_(float_to_fixed(min_delta)) {}
+optional<fixed_t> FixedPointDeltaFilter::new_fixed_value(fixed_t value) {
+  if (value == FIXED_NAN)
+    return {};
+  if (this->last_value_ == FIXED_NAN) {
+    return this->last_value_ = value;
+  }
+  const int64_t delta = int64_t(value) - this->last_value_;
+  if ((delta < 0 ? -delta : delta) >= this->min_delta_) {
+    return this->last_value_ = value;
+  }
+  return {};
+}
+
+// FixedPointSlidingWindowMovingAverageFilter
+FixedPointSlidingWindowMovingAverageFilter::FixedPointSlidingWindowMovingAverageFilter(size_t window_size,
+                                                                                       size_t send_every,
+                                                                                       size_t send_first_at)
+    : send_every_(send_every), send_at_(send_every - send_first_at) {
+  this->set_window_size(window_size);
+}
+void FixedPointSlidingWindowMovingAverageFilter::set_send_every(size_t send_every) {
+  this->send_every_ = send_every;
+}
+void FixedPointSlidingWindowMovingAverageFilter::set_window_size(size_t window_size) {
+  this->values_.assign(window_size, 0);
+  this->count_ = 0;
+  this->oldest_ = 0;
+  this->sum_ = 0;
+}
+optional<fixed_t> FixedPointSlidingWindowMovingAverageFilter::new_fixed_value(fixed_t value) {
+  if (value != FIXED_NAN && !this->values_.empty()) {
+    if (this->count_ < this->values_.size()) {
+      this->values_[this->count_++] = value;
+    } else {
+      this->sum_ -= this->values_[this->oldest_];
+      this->values_[this->oldest_] = value;
+      if (++this->oldest_ == this->values_.size())
+        this->oldest_ = 0;
+    }
+    this->sum_ += value;
+  }
+
+  if (++this->send_at_ >= this->send_every_) {
+    this->send_at_ = 0;
+    if (this->count_ == 0)
+      return 0;
+    // round to nearest, the average is always within the range of the values
+    const int64_t count = this->count_;
+    const int64_t half = this->sum_ < 0 ? -count / 2 : count / 2;
+    fixed_t average = (this->sum_ + half) / count;
+    ESP_LOGVV(TAG, "FixedPointSlidingWindowMovingAverageFilter(%p)::new_fixed_value(%d) SENDING %d", this, value,
+              average);
+    return average;
+  }
+  return {};
+}
+uint32_t FixedPointSlidingWindowMovingAverageFilter::expected_interval(uint32_t input) {
+  return input * this->send_every_;
+}
+
+// FixedPointExponentialMovingAverageFilter
+FixedPointExponentialMovingAverageFilter::FixedPointExponentialMovingAverageFilter(float alpha, size_t send_every)
+    : send_every_(send_every), send_at_(send_every - 1), alpha_(alpha) {}
+optional<fixed_t> FixedPointExponentialMovingAverageFilter::new_fixed_value(fixed_t value) {
+  if (value != FIXED_NAN) {
+    if (this->first_value_) {
+      this->accumulator_ = value;
+    } else {
+      // same as alpha * value + (1 - alpha) * accumulator
+      this->accumulator_ = saturate(this->accumulator_ + this->alpha_.apply(int64_t(value) - this->accumulator_));
+    }
+    this->first_value_ = false;
+  }
+
+  if (++this->send_at_ >= this->send_every_) {
+    this->send_at_ = 0;
+    return this->accumulator_;
+  }
+  return {};
+}
+void FixedPointExponentialMovingAverageFilter::set_send_every(size_t send_every) { this->send_every_ = send_every; }
+void FixedPointExponentialMovingAverageFilter::set_alpha(float alpha) { this->alpha_ = FixedPointScale(alpha); }
+uint32_t FixedPointExponentialMovingAverageFilter::expected_interval(uint32_t input) {
+  return input * this->send_every_;
+}
+
+}  // namespace sensor
+}  // namespace esphome
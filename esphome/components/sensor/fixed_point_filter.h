@@ -0,0 +1,140 @@
+#pragma once
+
+#include "filter.h"
+
+namespace esphome {
+namespace sensor {
+
+/** Q16.16 fixed-point number: 16 integer and 16 fractional bits.
+ *
+ * Covers about -32768 to 32768 with a resolution of 1/65536, values outside are saturated.
+ */
+using fixed_t = int32_t;
+/// Stands for NaN in fixed-point values.
+static const fixed_t FIXED_NAN = INT32_MIN;
+
+fixed_t float_to_fixed(float value);
+float fixed_to_float(fixed_t value);
+
+/// A float constant that fixed-point values can be multiplied with without losing the precision of the constant.
+class FixedPointScale {
+ public:
+  explicit FixedPointScale(float value);
+
+  /// Multiply a (possibly widened) fixed-point value with this constant, values must be within +-2^32.
+  int64_t apply(int64_t value) const;
+
+ protected:
+  /// The constant is mantissa_ * 2^-shift_.
+  int32_t mantissa_{0};
+  uint8_t shift_{0};
+};
+
+/** Base class of the filters that are used for sensors with `fixed_point: true`.
+ *
+ * Floating point operations are emulated in software on the ESP8266. Values are converted to fixed-point
+ * when they enter a run of consecutive fixed-point filters and only converted back to float when they leave it.
+ */
+class FixedPointFilter : public Filter {
+ public:
+  optional<float> new_value(float value) override;
+
+  /// Like new_value(), but with fixed-point values.
+  virtual optional<fixed_t> new_fixed_value(fixed_t value) = 0;
+
+  bool is_fixed_point() const override { return true; }
+};
+
+/// Fixed-point version of OffsetFilter.
+class FixedPointOffsetFilter : public FixedPointFilter {
+ public:
+  explicit FixedPointOffsetFilter(float offset);
+
+  optional<fixed_t> new_fixed_value(fixed_t value) override;
+
+ protected:
+  fixed_t offset_;
+};
+
+/// Fixed-point version of MultiplyFilter.
+class FixedPointMultiplyFilter : public FixedPointFilter {
+ public:
+  explicit FixedPointMultiplyFilter(float multiplier);
+
+  optional<fixed_t> new_fixed_value(fixed_t value) override;
+
+ protected:
+  FixedPointScale multiplier_;
+};
+
+/// Fixed-point version of CalibrateLinearFilter.
+class FixedPointCalibrateLinearFilter : public FixedPointFilter {
+ public:
+  FixedPointCalibrateLinearFilter(float slope, float bias);
+
+  optional<fixed_t> new_fixed_value(fixed_t value) override;
+
+ protected:
+  FixedPointScale slope_;
+  fixed_t bias_;
+};
+
+/// Fixed-point version of DeltaFilter.
+class FixedPointDeltaFilter : public FixedPointFilter {
+ public:
+  explicit FixedPointDeltaFilter(float min_delta);
+
+  optional<fixed_t> new_fixed_value(fixed_t value) override;
+
+ protected:
+  fixed_t min_delta_;
+  fixed_t last_value_{FIXED_NAN};
+};
+
+/** Fixed-point version of SlidingWindowMovingAverageFilter.
+ *
+ * The sum of the window is kept exactly, so unlike with floats no error accumulates over time.
+ */
+class FixedPointSlidingWindowMovingAverageFilter : public FixedPointFilter {
+ public:
+  FixedPointSlidingWindowMovingAverageFilter(size_t window_size, size_t send_every, size_t send_first_at);
+
+  optional<fixed_t> new_fixed_value(fixed_t value) override;
+
+  void set_send_every(size_t send_every);
+  /// Change the window size, this clears the values in the window.
+  void set_window_size(size_t window_size);
+
+  uint32_t expected_interval(uint32_t input) override;
+
+ protected:
+  std::vector<fixed_t> values_;
+  size_t count_{0};
+  size_t oldest_{0};
+  int64_t sum_{0};
+  size_t send_every_;
+  size_t send_at_;
+};
+
+/// Fixed-point version of ExponentialMovingAverageFilter.
+class FixedPointExponentialMovingAverageFilter : public FixedPointFilter {
+ public:
+  FixedPointExponentialMovingAverageFilter(float alpha, size_t send_every);
+
+  optional<fixed_t> new_fixed_value(fixed_t value) override;
+
+  void set_send_every(size_t send_every);
+  void set_alpha(float alpha);
+
+  uint32_t expected_interval(uint32_t input) override;
+
+ protected:
+  bool first_value_{true};
+  fixed_t accumulator_{0};
+  size_t send_every_;
+  size_t send_at_;
+  FixedPointScale alpha_;
+};
+
+}  // namespace sensor
+}  // namespace esphome
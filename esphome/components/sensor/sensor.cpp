@@ -18,6 +18,23 @@ void Sensor::publish_state(float state) {
     this->filter_list_->input(state);
   }
 }
+void Sensor::publish_state_batch(const float *states, size_t count) {
+  if (count == 0)
+    return;
+  for (size_t i = 0; i < count; i++) {
+    this->raw_state = states[i];
+    this->raw_callback_.call(states[i]);
+  }
+
+  ESP_LOGV(TAG, "'%s': Received %zu new states", this->name_.c_str(), count);
+
+  if (this->filter_list_ == nullptr) {
+    for (size_t i = 0; i < count; i++)
+      this->internal_send_state_to_frontend(states[i]);
+  } else {
+    this->filter_list_->input_batch(states, count);
+  }
+}
 void Sensor::push_new_value(float state) { this->publish_state(state); }
 std::string Sensor::unit_of_measurement() { return ""; }
 std::string Sensor::icon() { return ""; }
@@ -103,6 +103,16 @@ class Sensor : public Nameable {
    */
   void publish_state(float state);
 
+  /** Publish a block of new states, for example the samples collected during one update.
+   *
+   * Equivalent to calling publish_state() for each of them, but the block is passed through the filters
+   * at once, which is cheaper for filters that support it (see Filter::input_batch()).
+   *
+   * @param states The states in the order they were measured.
+   * @param count The number of states.
+   */
+  void publish_state_batch(const float *states, size_t count);
+
   /** Push a new value to the MQTT front-end.
    *
    * Note: deprecated, please use publish_state.
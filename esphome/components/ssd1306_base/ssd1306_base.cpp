@@ -35,6 +35,7 @@ static const uint8_t SSD1306_NORMAL_DISPLAY = 0xA6;
 
 void SSD1306::setup() {
   this->init_internal_(this->get_buffer_length_());
+  this->init_dirty_tiles_(8, 16, 8, 8);
 
   this->command(SSD1306_COMMAND_DISPLAY_OFF);
   this->command(SSD1306_COMMAND_SET_DISPLAY_CLOCK_DIV);
@@ -95,30 +96,44 @@ void SSD1306::setup() {
   this->turn_on();
 }
 void SSD1306::display() {
-  if (this->is_sh1106_()) {
-    this->write_display_data();
-    return;
-  }
+  const int width = this->get_width_internal();
+  for (const auto &rect : this->find_dirty_rects_()) {
+    // the tiles are whole pages
+    const int page_start = rect.y / 8;
+    const int page_end = (rect.y + rect.h - 1) / 8;
+    const uint8_t *data = this->buffer_ + page_start * width + rect.x;
 
-  this->command(SSD1306_COMMAND_COLUMN_ADDRESS);
-  switch (this->model_) {
-    case SSD1306_MODEL_64_48:
-      this->command(0x20);
-      this->command(0x20 + this->get_width_internal() - 1);
-      break;
-    default:
-      this->command(0);  // Page start address, 0
-      this->command(this->get_width_internal() - 1);
-      break;
-  }
+    if (this->is_sh1106_()) {
+      // the SH1106 only supports page addressing
+      const uint8_t column = rect.x + 2;
+      for (int page = page_start; page <= page_end; page++) {
+        this->command(0xB0 + page);             // row
+        this->command(0x00 | (column & 0x0F));  // lower column
+        this->command(0x10 | (column >> 4));    // higher column
+        this->write_display_data(data, rect.w, 1, width);
+        data += width;
+      }
+      continue;
+    }
+
+    this->command(SSD1306_COMMAND_COLUMN_ADDRESS);
+    switch (this->model_) {
+      case SSD1306_MODEL_64_48:
+        this->command(0x20 + rect.x);
+        this->command(0x20 + rect.x + rect.w - 1);
+        break;
+      default:
+        this->command(rect.x);
+        this->command(rect.x + rect.w - 1);
+        break;
+    }
 
-  this->command(SSD1306_COMMAND_PAGE_ADDRESS);
-  // Page start address, 0
-  this->command(0);
-  // Page end address:
-  this->command((this->get_height_internal() / 8) - 1);
+    this->command(SSD1306_COMMAND_PAGE_ADDRESS);
+    this->command(page_start);
+    this->command(page_end);
 
-  this->write_display_data();
+    this->write_display_data(data, rect.w, page_end - page_start + 1, width);
+  }
 }
 bool SSD1306::is_sh1106_() const {
   return this->model_ == SH1106_MODEL_96_16 || this->model_ == SH1106_MODEL_128_32 ||
@@ -194,6 +209,36 @@ void HOT SSD1306::draw_absolute_pixel_internal(int x, int y, Color color) {
     this->buffer_[pos] &= ~(1 << subpos);
   }
 }
+void HOT SSD1306::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  const int page_end = (y + height - 1) / 8;
+  for (int page = y / 8; page <= page_end; page++) {
+    // the bits of the rows of this page inside the rectangle
+    const int row_begin = std::max(y - page * 8, 0);
+    const int row_end = std::min(y + height - page * 8, 8);
+    const uint8_t mask = (0xFF << row_begin) & (0xFF >> (8 - row_end));
+    uint8_t *data = this->buffer_ + page * this->get_width_internal() + x;
+    if (color.is_on()) {
+      for (int i = 0; i < width; i++)
+        data[i] |= mask;
+    } else {
+      for (int i = 0; i < width; i++)
+        data[i] &= ~mask;
+    }
+  }
+}
+void HOT SSD1306::draw_absolute_bitmap_internal(const display::BitmapBlit &blit) {
+  const int width = this->get_width_internal();
+  const bool color_on = blit.color_on.is_on();
+  const bool color_off = blit.color_off.is_on();
+  blit.for_each_pixel([this, width, color_on, color_off](int x, int y, bool on) {
+    uint8_t &data = this->buffer_[x + (y / 8) * width];
+    if (on ? color_on : color_off) {
+      data |= (1 << (y & 0x07));
+    } else {
+      data &= ~(1 << (y & 0x07));
+    }
+  });
+}
 void SSD1306::fill(Color color) {
   uint8_t fill = color.is_on() ? 0xFF : 0x00;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
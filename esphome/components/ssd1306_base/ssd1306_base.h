@@ -39,12 +39,15 @@ class SSD1306 : public PollingComponent, public display::DisplayBuffer {
 
  protected:
   virtual void command(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  /// Send `lines` runs of `length` bytes, starting at `data` and `stride` bytes apart.
+  virtual void write_display_data(const uint8_t *data, size_t length, size_t lines, size_t stride) = 0;
   void init_reset_();
 
   bool is_sh1106_() const;
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_rect_internal(int x, int y, int width, int height, Color color) override;
+  void draw_absolute_bitmap_internal(const display::BitmapBlit &blit) override;
 
   int get_height_internal() override;
   int get_width_internal() override;
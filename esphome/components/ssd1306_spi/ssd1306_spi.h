@@ -20,7 +20,7 @@ class SPISSD1306 : public ssd1306_base::SSD1306,
  protected:
   void command(uint8_t value) override;
 
-  void write_display_data() override;
+  void write_display_data(const uint8_t *data, size_t length, size_t lines, size_t stride) override;
 
   GPIOPin *dc_pin_;
 };
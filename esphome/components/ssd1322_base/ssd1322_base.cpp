@@ -49,6 +49,7 @@ static const uint8_t SSD1322_SETCOMMANDLOCK_LOCK = 0x16;
 
 void SSD1322::setup() {
   this->init_internal_(this->get_buffer_length_());
+  this->init_dirty_tiles_(8 / SSD1322_PIXELSPERBYTE);
 
   this->command(SSD1322_SETCOMMANDLOCK);
   this->data(SSD1322_SETCOMMANDLOCK_UNLOCK);
@@ -111,15 +112,20 @@ void SSD1322::setup() {
   this->turn_on();          // display ON
 }
 void SSD1322::display() {
-  this->command(SSD1322_SETCOLUMNADDRESS);  // set column address
-  this->data(0x1C);                         // set column start address
-  this->data(0x5B);                         // set column end address
-  this->command(SSD1322_SETROWADDRESS);     // set row address
-  this->data(0x00);                         // set row start address
-  this->data(0x3F);                         // set last row
-  this->command(SSD1322_WRITERAM);          // write
+  const int width = this->get_width_internal();
+  for (const auto &rect : this->find_dirty_rects_()) {
+    // a column address covers 4 pixels, the first one is 0x1C
+    this->command(SSD1322_SETCOLUMNADDRESS);       // set column address
+    this->data(0x1C + rect.x / 4);                 // set column start address
+    this->data(0x1C + (rect.x + rect.w) / 4 - 1);  // set column end address
+    this->command(SSD1322_SETROWADDRESS);          // set row address
+    this->data(rect.y);                            // set row start address
+    this->data(rect.y + rect.h - 1);               // set last row
+    this->command(SSD1322_WRITERAM);               // write
 
-  this->write_display_data();
+    this->write_display_data(this->buffer_ + (rect.y * width + rect.x) / SSD1322_PIXELSPERBYTE,
+                             rect.w / SSD1322_PIXELSPERBYTE, rect.h, width / SSD1322_PIXELSPERBYTE);
+  }
 }
 void SSD1322::update() {
   this->do_update_();
@@ -48,6 +48,7 @@ static const uint8_t SSD1325_COPY = 0x25;
 
 void SSD1325::setup() {
   this->init_internal_(this->get_buffer_length_());
+  this->init_dirty_tiles_(8 / SSD1325_PIXELSPERBYTE);
 
   this->command(SSD1325_DISPLAYOFF);    // display off
   this->command(SSD1325_SETCLOCK);      // set osc division
@@ -119,17 +120,19 @@ void SSD1325::setup() {
   this->turn_on();    // display ON
 }
 void SSD1325::display() {
-  this->command(SSD1325_SETCOLADDR);  // set column address
-  this->command(0x00);                // set column start address
-  this->command(0x3F);                // set column end address
-  this->command(SSD1325_SETROWADDR);  // set row address
-  this->command(0x00);                // set row start address
-  if (this->model_ == SSD1327_MODEL_128_128)
-    this->command(127);  // set last row
-  else
-    this->command(63);  // set last row
+  const int width = this->get_width_internal();
+  for (const auto &rect : this->find_dirty_rects_()) {
+    // one column address for every byte of the buffer
+    this->command(SSD1325_SETCOLADDR);                             // set column address
+    this->command(rect.x / SSD1325_PIXELSPERBYTE);                 // set column start address
+    this->command((rect.x + rect.w) / SSD1325_PIXELSPERBYTE - 1);  // set column end address
+    this->command(SSD1325_SETROWADDR);                             // set row address
+    this->command(rect.y);                                         // set row start address
+    this->command(rect.y + rect.h - 1);                            // set last row
 
-  this->write_display_data();
+    this->write_display_data(this->buffer_ + (rect.y * width + rect.x) / SSD1325_PIXELSPERBYTE,
+                             rect.w / SSD1325_PIXELSPERBYTE, rect.h, width / SSD1325_PIXELSPERBYTE);
+  }
 }
 void SSD1325::update() {
   this->do_update_();
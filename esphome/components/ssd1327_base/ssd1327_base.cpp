@@ -43,6 +43,7 @@ static const uint8_t SSD1327_ACTIVATESCROLL = 0x2F;
 
 void SSD1327::setup() {
   this->init_internal_(this->get_buffer_length_());
+  this->init_dirty_tiles_(8 / SSD1327_PIXELSPERBYTE);
 
   this->turn_off();                             // display OFF
   this->command(SSD1327_SETFRONTCLOCKDIVIDER);  // set osc division
@@ -83,14 +84,19 @@ void SSD1327::setup() {
   this->turn_on();          // display ON
 }
 void SSD1327::display() {
-  this->command(SSD1327_SETCOLUMNADDRESS);  // set column address
-  this->command(0x00);                      // set column start address
-  this->command(0x3F);                      // set column end address
-  this->command(SSD1327_SETROWADDRESS);     // set row address
-  this->command(0x00);                      // set row start address
-  this->command(127);                       // set last row
+  const int width = this->get_width_internal();
+  for (const auto &rect : this->find_dirty_rects_()) {
+    // one column address for every byte of the buffer
+    this->command(SSD1327_SETCOLUMNADDRESS);                       // set column address
+    this->command(rect.x / SSD1327_PIXELSPERBYTE);                 // set column start address
+    this->command((rect.x + rect.w) / SSD1327_PIXELSPERBYTE - 1);  // set column end address
+    this->command(SSD1327_SETROWADDRESS);                          // set row address
+    this->command(rect.y);                                         // set row start address
+    this->command(rect.y + rect.h - 1);                            // set last row
 
-  this->write_display_data();
+    this->write_display_data(this->buffer_ + (rect.y * width + rect.x) / SSD1327_PIXELSPERBYTE,
+                             rect.w / SSD1327_PIXELSPERBYTE, rect.h, width / SSD1327_PIXELSPERBYTE);
+  }
 }
 void SSD1327::update() {
   if (!this->is_failed()) {
@@ -31,12 +31,11 @@ void I2CSSD1327::dump_config() {
   }
 }
 void I2CSSD1327::command(uint8_t value) { this->write_byte(0x00, value); }
-void HOT I2CSSD1327::write_display_data() {
-  for (uint32_t i = 0; i < this->get_buffer_length_();) {
-    uint8_t data[16];
-    for (uint8_t &j : data)
-      j = this->buffer_[i++];
-    this->write_bytes(0x40, data, sizeof(data));
+void HOT I2CSSD1327::write_display_data(const uint8_t *data, size_t length, size_t lines, size_t stride) {
+  for (size_t line = 0; line < lines; line++) {
+    const uint8_t *line_data = data + line * stride;
+    for (size_t i = 0; i < length; i += 16)
+      this->write_bytes(0x40, line_data + i, std::min<size_t>(16, length - i));
   }
 }
 
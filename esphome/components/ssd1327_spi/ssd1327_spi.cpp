@@ -41,7 +41,7 @@ void SPISSD1327::command(uint8_t value) {
     this->cs_->digital_write(true);
   this->disable();
 }
-void HOT SPISSD1327::write_display_data() {
+void HOT SPISSD1327::write_display_data(const uint8_t *data, size_t length, size_t lines, size_t stride) {
   if (this->cs_)
     this->cs_->digital_write(true);
   this->dc_pin_->digital_write(true);
@@ -49,7 +49,8 @@ void HOT SPISSD1327::write_display_data() {
     this->cs_->digital_write(false);
   delay(1);
   this->enable();
-  this->write_array(this->buffer_, this->get_buffer_length_());
+  for (size_t line = 0; line < lines; line++)
+    this->write_array(data + line * stride, length);
   if (this->cs_)
     this->cs_->digital_write(true);
   this->disable();
@@ -46,6 +46,7 @@ static const uint8_t SSD1331_VCOMH = 0xBE;           // Set Vcomh voltge
 
 void SSD1331::setup() {
   this->init_internal_(this->get_buffer_length_());
+  this->init_dirty_tiles_(SSD1331_BYTESPERPIXEL * 8);
 
   this->command(SSD1331_DISPLAYOFF);  // 0xAE
   this->command(SSD1331_SETREMAP);    // 0xA0
@@ -83,13 +84,17 @@ void SSD1331::setup() {
   this->turn_on();    // display ON
 }
 void SSD1331::display() {
-  this->command(SSD1331_SETCOLUMN);  // set column address
-  this->command(0x00);               // set column start address
-  this->command(0x5F);               // set column end address
-  this->command(SSD1331_SETROW);     // set row address
-  this->command(0x00);               // set row start address
-  this->command(0x3F);               // set last row
-  this->write_display_data();
+  const int width = this->get_width_internal();
+  for (const auto &rect : this->find_dirty_rects_()) {
+    this->command(SSD1331_SETCOLUMN);    // set column address
+    this->command(rect.x);               // set column start address
+    this->command(rect.x + rect.w - 1);  // set column end address
+    this->command(SSD1331_SETROW);       // set row address
+    this->command(rect.y);               // set row start address
+    this->command(rect.y + rect.h - 1);  // set last row
+    this->write_display_data(this->buffer_ + (rect.y * width + rect.x) * SSD1331_BYTESPERPIXEL,
+                             rect.w * SSD1331_BYTESPERPIXEL, rect.h, width * SSD1331_BYTESPERPIXEL);
+  }
 }
 void SSD1331::update() {
   this->do_update_();
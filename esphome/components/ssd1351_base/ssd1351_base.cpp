@@ -51,6 +51,7 @@ static const uint8_t SSD1351_STARTSCROLL = 0x9F;
 
 void SSD1351::setup() {
   this->init_internal_(this->get_buffer_length_());
+  this->init_dirty_tiles_(SSD1351_BYTESPERPIXEL * 8);
 
   this->command(SSD1351_COMMANDLOCK);
   this->data(0x12);
@@ -92,14 +93,18 @@ void SSD1351::setup() {
   this->turn_on();    // display ON
 }
 void SSD1351::display() {
-  this->command(SSD1351_SETCOLUMN);  // set column address
-  this->data(0x00);                  // set column start address
-  this->data(0x7F);                  // set column end address
-  this->command(SSD1351_SETROW);     // set row address
-  this->data(0x00);                  // set row start address
-  this->data(0x7F);                  // set last row
-  this->command(SSD1351_WRITERAM);
-  this->write_display_data();
+  const int width = this->get_width_internal();
+  for (const auto &rect : this->find_dirty_rects_()) {
+    this->command(SSD1351_SETCOLUMN);  // set column address
+    this->data(rect.x);                // set column start address
+    this->data(rect.x + rect.w - 1);   // set column end address
+    this->command(SSD1351_SETROW);     // set row address
+    this->data(rect.y);                // set row start address
+    this->data(rect.y + rect.h - 1);   // set last row
+    this->command(SSD1351_WRITERAM);
+    this->write_display_data(this->buffer_ + (rect.y * width + rect.x) * SSD1351_BYTESPERPIXEL,
+                             rect.w * SSD1351_BYTESPERPIXEL, rect.h, width * SSD1351_BYTESPERPIXEL);
+  }
 }
 void SSD1351::update() {
   this->do_update_();
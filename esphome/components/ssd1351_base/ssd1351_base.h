@@ -34,7 +34,8 @@ class SSD1351 : public PollingComponent, public display::DisplayBuffer {
  protected:
   virtual void command(uint8_t value) = 0;
   virtual void data(uint8_t value) = 0;
-  virtual void write_display_data() = 0;
+  /// Send `lines` runs of `length` bytes, starting at `data` and `stride` bytes apart.
+  virtual void write_display_data(const uint8_t *data, size_t length, size_t lines, size_t stride) = 0;
   void init_reset_();
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
@@ -285,6 +285,7 @@ void ST7735::setup() {
 
   this->init_internal_(this->get_buffer_length());
   memset(this->buffer_, 0x00, this->get_buffer_length());
+  this->init_dirty_tiles_(this->eightbitcolor_ ? 8 : 16);
 }
 
 void ST7735::update() {
@@ -319,6 +320,80 @@ void HOT ST7735::draw_absolute_pixel_internal(int x, int y, Color color) {
   }
 }
 
+void HOT ST7735::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  if (this->eightbitcolor_) {
+    const uint8_t color332 = display::ColorUtil::color_to_332(color);
+    for (int row = y; row < y + height; row++)
+      memset(this->buffer_ + row * this->get_width_internal() + x, color332, width);
+  } else {
+    const uint32_t color565 = display::ColorUtil::color_to_565(color);
+    for (int row = y; row < y + height; row++) {
+      uint8_t *data = this->buffer_ + (row * this->get_width_internal() + x) * 2;
+      for (int i = 0; i < width; i++) {
+        *data++ = (color565 >> 8) & 0xff;
+        *data++ = color565 & 0xff;
+      }
+    }
+  }
+}
+
+void HOT ST7735::draw_absolute_bitmap_internal(const display::BitmapBlit &blit) {
+  const int width = this->get_width_internal();
+  if (this->eightbitcolor_) {
+    const uint8_t color_on = display::ColorUtil::color_to_332(blit.color_on);
+    const uint8_t color_off = display::ColorUtil::color_to_332(blit.color_off);
+    blit.for_each_pixel([this, width, color_on, color_off](int x, int y, bool on) {
+      this->buffer_[x + y * width] = on ? color_on : color_off;
+    });
+  } else {
+    const uint16_t color_on = display::ColorUtil::color_to_565(blit.color_on);
+    const uint16_t color_off = display::ColorUtil::color_to_565(blit.color_off);
+    blit.for_each_pixel([this, width, color_on, color_off](int x, int y, bool on) {
+      const uint16_t color565 = on ? color_on : color_off;
+      uint8_t *data = this->buffer_ + (x + y * width) * 2;
+      data[0] = (color565 >> 8) & 0xff;
+      data[1] = color565 & 0xff;
+    });
+  }
+}
+
+void HOT ST7735::draw_absolute_alpha_bitmap_internal(const display::AlphaBlit &blit) {
+  if (this->eightbitcolor_) {
+    display::DisplayBuffer::draw_absolute_alpha_bitmap_internal(blit);
+    return;
+  }
+  const int width = this->get_width_internal();
+  const uint16_t color565 = display::ColorUtil::color_to_565(blit.color);
+  blit.for_each_pixel([this, width, color565](int x, int y, uint8_t alpha) {
+    uint8_t *data = this->buffer_ + (x + y * width) * 2;
+    // most pixels of a glyph are covered completely
+    const uint16_t blended =
+        alpha == 32 ? color565 : display::ColorUtil::blend_565((data[0] << 8) | data[1], color565, alpha);
+    data[0] = (blended >> 8) & 0xff;
+    data[1] = blended & 0xff;
+  });
+}
+
+void HOT ST7735::draw_absolute_rgb565_bitmap_internal(const display::Rgb565Blit &blit) {
+  if (this->eightbitcolor_) {
+    display::DisplayBuffer::draw_absolute_rgb565_bitmap_internal(blit);
+    return;
+  }
+  const int width = this->get_width_internal();
+  if (blit.can_copy_rows()) {
+    // the image stores its pixels just like the buffer
+    blit.for_each_row([this, width](int x, int y, const uint8_t *data, int count) {
+      memcpy_P(this->buffer_ + (x + y * width) * 2, data, count * 2);
+    });
+    return;
+  }
+  blit.for_each_pixel([this, width](int x, int y, uint16_t color565) {
+    uint8_t *data = this->buffer_ + (x + y * width) * 2;
+    data[0] = (color565 >> 8) & 0xff;
+    data[1] = color565 & 0xff;
+  });
+}
+
 void ST7735::init_reset_() {
   if (this->reset_pin_ != nullptr) {
     this->reset_pin_->setup();
@@ -417,44 +492,47 @@ void HOT ST7735::write_display_data_() {
   uint16_t offsetx = colstart_;
   uint16_t offsety = rowstart_;
 
-  uint16_t x1 = offsetx;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = offsety;
-  uint16_t y2 = y1 + get_height_internal() - 1;
-
   this->enable();
 
-  // set column(x) address
-  this->dc_pin_->digital_write(false);
-  this->write_byte(ST77XX_CASET);
-  this->dc_pin_->digital_write(true);
-  this->spi_master_write_addr_(x1, x2);
-
-  // set Page(y) address
-  this->dc_pin_->digital_write(false);
-  this->write_byte(ST77XX_RASET);
-  this->dc_pin_->digital_write(true);
-  this->spi_master_write_addr_(y1, y2);
-
-  //  Memory Write
-  this->dc_pin_->digital_write(false);
-  this->write_byte(ST77XX_RAMWR);
-  this->dc_pin_->digital_write(true);
-
-  if (this->eightbitcolor_) {
-    for (int line = 0; line < this->get_buffer_length(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
-        auto color332 = display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
-                                                     display::ColorBitness::COLOR_BITNESS_332, true);
-
-        auto color = display::ColorUtil::color_to_565(color332);
-
-        this->write_byte((color >> 8) & 0xff);
-        this->write_byte(color & 0xff);
+  for (const auto &rect : this->find_dirty_rects_()) {
+    uint16_t x1 = offsetx + rect.x;
+    uint16_t x2 = x1 + rect.w - 1;
+    uint16_t y1 = offsety + rect.y;
+    uint16_t y2 = y1 + rect.h - 1;
+
+    // set column(x) address
+    this->dc_pin_->digital_write(false);
+    this->write_byte(ST77XX_CASET);
+    this->dc_pin_->digital_write(true);
+    this->spi_master_write_addr_(x1, x2);
+
+    // set Page(y) address
+    this->dc_pin_->digital_write(false);
+    this->write_byte(ST77XX_RASET);
+    this->dc_pin_->digital_write(true);
+    this->spi_master_write_addr_(y1, y2);
+
+    //  Memory Write
+    this->dc_pin_->digital_write(false);
+    this->write_byte(ST77XX_RAMWR);
+    this->dc_pin_->digital_write(true);
+
+    for (int y = rect.y; y < rect.y + rect.h; y++) {
+      const int line = y * this->get_width_internal();
+      if (this->eightbitcolor_) {
+        for (int index = line + rect.x; index < line + rect.x + rect.w; ++index) {
+          auto color332 = display::ColorUtil::to_color(this->buffer_[index], display::ColorOrder::COLOR_ORDER_RGB,
+                                                       display::ColorBitness::COLOR_BITNESS_332, true);
+
+          auto color = display::ColorUtil::color_to_565(color332);
+
+          this->write_byte((color >> 8) & 0xff);
+          this->write_byte(color & 0xff);
+        }
+      } else {
+        this->write_array(this->buffer_ + (line + rect.x) * 2, rect.w * 2);
       }
     }
-  } else {
-    this->write_array(this->buffer_, this->get_buffer_length());
   }
   this->disable();
 }
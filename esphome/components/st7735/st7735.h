@@ -65,6 +65,10 @@ class ST7735 : public PollingComponent,
   void display_init_(const uint8_t *addr);
   void set_addr_window_(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_rect_internal(int x, int y, int width, int height, Color color) override;
+  void draw_absolute_bitmap_internal(const display::BitmapBlit &blit) override;
+  void draw_absolute_alpha_bitmap_internal(const display::AlphaBlit &blit) override;
+  void draw_absolute_rgb565_bitmap_internal(const display::Rgb565Blit &blit) override;
   void spi_master_write_addr_(uint16_t addr1, uint16_t addr2);
   void spi_master_write_color_(uint16_t color, uint16_t size);
 
@@ -113,6 +113,7 @@ void ST7789V::setup() {
 
   this->init_internal_(this->get_buffer_length_());
   memset(this->buffer_, 0x00, this->get_buffer_length_());
+  this->init_dirty_tiles_(16);
 }
 
 void ST7789V::dump_config() {
@@ -134,29 +135,30 @@ void ST7789V::update() {
 void ST7789V::loop() {}
 
 void ST7789V::write_display_data() {
-  uint16_t x1 = 52;   // _offsetx
-  uint16_t x2 = 186;  // _offsetx
-  uint16_t y1 = 40;   // _offsety
-  uint16_t y2 = 279;  // _offsety
+  const uint16_t offset_x = 52;
+  const uint16_t offset_y = 40;
 
   this->enable();
 
-  // set column(x) address
-  this->dc_pin_->digital_write(false);
-  this->write_byte(ST7789_CASET);
-  this->dc_pin_->digital_write(true);
-  this->write_addr_(x1, x2);
-  // set page(y) address
-  this->dc_pin_->digital_write(false);
-  this->write_byte(ST7789_RASET);
-  this->dc_pin_->digital_write(true);
-  this->write_addr_(y1, y2);
-  // write display memory
-  this->dc_pin_->digital_write(false);
-  this->write_byte(ST7789_RAMWR);
-  this->dc_pin_->digital_write(true);
-
-  this->write_array(this->buffer_, this->get_buffer_length_());
+  for (const auto &rect : this->find_dirty_rects_()) {
+    // set column(x) address
+    this->dc_pin_->digital_write(false);
+    this->write_byte(ST7789_CASET);
+    this->dc_pin_->digital_write(true);
+    this->write_addr_(offset_x + rect.x, offset_x + rect.x + rect.w - 1);
+    // set page(y) address
+    this->dc_pin_->digital_write(false);
+    this->write_byte(ST7789_RASET);
+    this->dc_pin_->digital_write(true);
+    this->write_addr_(offset_y + rect.y, offset_y + rect.y + rect.h - 1);
+    // write display memory
+    this->dc_pin_->digital_write(false);
+    this->write_byte(ST7789_RAMWR);
+    this->dc_pin_->digital_write(true);
+
+    for (int y = rect.y; y < rect.y + rect.h; y++)
+      this->write_array(this->buffer_ + (y * this->get_width_internal() + rect.x) * 2, rect.w * 2);
+  }
 
   this->disable();
 }
@@ -270,5 +272,34 @@ void HOT ST7789V::draw_absolute_pixel_internal(int x, int y, Color color) {
   this->buffer_[pos] = color565 & 0xff;
 }
 
+void HOT ST7789V::draw_absolute_alpha_bitmap_internal(const display::AlphaBlit &blit) {
+  const int width = this->get_width_internal();
+  const uint16_t color565 = display::ColorUtil::color_to_565(blit.color);
+  blit.for_each_pixel([this, width, color565](int x, int y, uint8_t alpha) {
+    uint8_t *data = this->buffer_ + (x + y * width) * 2;
+    // most pixels of a glyph are covered completely
+    const uint16_t blended =
+        alpha == 32 ? color565 : display::ColorUtil::blend_565((data[0] << 8) | data[1], color565, alpha);
+    data[0] = (blended >> 8) & 0xff;
+    data[1] = blended & 0xff;
+  });
+}
+
+void HOT ST7789V::draw_absolute_rgb565_bitmap_internal(const display::Rgb565Blit &blit) {
+  const int width = this->get_width_internal();
+  if (blit.can_copy_rows()) {
+    // the image stores its pixels just like the buffer
+    blit.for_each_row([this, width](int x, int y, const uint8_t *data, int count) {
+      memcpy_P(this->buffer_ + (x + y * width) * 2, data, count * 2);
+    });
+    return;
+  }
+  blit.for_each_pixel([this, width](int x, int y, uint16_t color565) {
+    uint8_t *data = this->buffer_ + (x + y * width) * 2;
+    data[0] = (color565 >> 8) & 0xff;
+    data[1] = color565 & 0xff;
+  });
+}
+
 }  // namespace st7789v
 }  // namespace esphome
@@ -145,6 +145,8 @@ class ST7789V : public PollingComponent,
   void draw_filled_rect_(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2, uint16_t color);
 
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void draw_absolute_alpha_bitmap_internal(const display::AlphaBlit &blit) override;
+  void draw_absolute_rgb565_bitmap_internal(const display::Rgb565Blit &blit) override;
 };
 
 }  // namespace st7789v
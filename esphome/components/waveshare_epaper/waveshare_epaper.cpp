@@ -145,6 +145,40 @@ void HOT WaveshareEPaper::draw_absolute_pixel_internal(int x, int y, Color color
   else
     this->buffer_[pos] &= ~(0x80 >> subpos);
 }
+void HOT WaveshareEPaper::fill_absolute_rect_internal(int x, int y, int width, int height, Color color) {
+  // flip logic
+  const uint8_t fill = color.is_on() ? 0x00 : 0xFF;
+  const uint32_t stride = this->get_width_internal() / 8u;
+  for (int row = y; row < y + height; row++) {
+    uint8_t *data = this->buffer_ + row * stride;
+    int col = x;
+    while (col < x + width) {
+      if ((col & 0x07) == 0 && col + 8 <= x + width) {
+        // whole byte
+        data[col / 8u] = fill;
+        col += 8;
+        continue;
+      }
+      const uint8_t mask = 0x80 >> (col & 0x07);
+      data[col / 8u] = (data[col / 8u] & ~mask) | (fill & mask);
+      col++;
+    }
+  }
+}
+void HOT WaveshareEPaper::draw_absolute_bitmap_internal(const display::BitmapBlit &blit) {
+  const int width = this->get_width_internal();
+  // flip logic
+  const bool set_on = !blit.color_on.is_on();
+  const bool set_off = !blit.color_off.is_on();
+  blit.for_each_pixel([this, width, set_on, set_off](int x, int y, bool on) {
+    const uint32_t pos = (x + y * width) / 8u;
+    const uint8_t subpos = x & 0x07;
+    if (on ? set_on : set_off)
+      this->buffer_[pos] |= 0x80 >> subpos;
+    else
+      this->buffer_[pos] &= ~(0x80 >> subpos);
+  });
+}
 uint32_t WaveshareEPaper::get_buffer_length_() { return this->get_width_internal() * this->get_height_internal() / 8u; }
 void WaveshareEPaper::start_command_() {
   this->dc_pin_->digital_write(false);
@@ -37,6 +37,8 @@ class WaveshareEPaper : public PollingComponent,
 
  protected:
   void draw_absolute_pixel_internal(int x, int y, Color color) override;
+  void fill_absolute_rect_internal(int x, int y, int width, int height, Color color) override;
+  void draw_absolute_bitmap_internal(const display::BitmapBlit &blit) override;
 
   bool wait_until_idle_();
 
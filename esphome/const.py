@@ -78,6 +78,7 @@ CONF_BATTERY_VOLTAGE = "battery_voltage"
 CONF_BAUD_RATE = "baud_rate"
 CONF_BELOW = "below"
 CONF_BINARY = "binary"
+CONF_BINARY_LOGS = "binary_logs"
 CONF_BINARY_SENSOR = "binary_sensor"
 CONF_BINARY_SENSORS = "binary_sensors"
 CONF_BINDKEY = "bindkey"
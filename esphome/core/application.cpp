@@ -7,10 +7,20 @@
 #include "esphome/components/status_led/status_led.h"
 #endif
 
+#if defined(USE_TICKLESS_LOOP) && defined(ARDUINO_ARCH_ESP32)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#endif
+
 namespace esphome {
 
 static const char *TAG = "app";
 
+#ifdef USE_TICKLESS_LOOP
+/// Upper bound for how long the tickless main loop sleeps when nothing is scheduled.
+static const uint32_t TICKLESS_MAX_SLEEP = 1000;
+#endif
+
 void Application::register_component_(Component *comp) {
   if (comp == nullptr) {
     ESP_LOGW(TAG, "Tried to register null component!");
@@ -27,6 +37,9 @@ void Application::register_component_(Component *comp) {
 }
 void Application::setup() {
   ESP_LOGI(TAG, "Running through setup()...");
+#if defined(USE_TICKLESS_LOOP) && defined(ARDUINO_ARCH_ESP32)
+  this->loop_task_handle_ = xTaskGetCurrentTaskHandle();
+#endif
   ESP_LOGV(TAG, "Sorting components by setup priority...");
   std::stable_sort(this->components_.begin(), this->components_.end(), [](const Component *a, const Component *b) {
     return a->get_actual_setup_priority() > b->get_actual_setup_priority();
@@ -59,6 +72,14 @@ void Application::setup() {
   ESP_LOGI(TAG, "setup() finished successfully!");
   this->schedule_dump_config();
   this->calculate_looping_components_();
+#ifdef USE_TICKLESS_LOOP
+  size_t polling = 0;
+  for (auto *obj : this->looping_components_)
+    polling += obj->needs_polling();
+  if (polling != 0)
+    ESP_LOGI(TAG, "Tickless loop: %u of %u looping components need polling, the loop only sleeps while none do.",
+             unsigned(polling), unsigned(this->looping_components_.size()));
+#endif
 
   // Dummy function to link some symbols into the binary.
   force_link_symbols();
@@ -66,12 +87,25 @@ void Application::setup() {
 void Application::loop() {
   uint32_t new_app_state = 0;
   const uint32_t start = millis();
+#ifdef USE_TICKLESS_LOOP
+  // wake-ups from here on are handled by this iteration
+#ifdef ARDUINO_ARCH_ESP32
+  // drop a notification left by an earlier wake-up, otherwise the next sleep would end right away
+  ulTaskNotifyTake(pdTRUE, 0);
+#endif
+  this->wake_requested_ = false;
+  this->loop_iterations_++;
+  bool needs_polling = false;
+#endif
 
   this->scheduler.call();
   for (Component *component : this->looping_components_) {
     component->call();
     new_app_state |= component->get_component_state();
     this->app_state_ |= new_app_state;
+#ifdef USE_TICKLESS_LOOP
+    needs_polling |= component->needs_polling();
+#endif
     this->feed_wdt();
   }
   this->app_state_ = new_app_state;
@@ -91,12 +125,29 @@ void Application::loop() {
     if (now - this->last_loop_ < this->loop_interval_)
       delay_time = this->loop_interval_ - (now - this->last_loop_);
 
-    uint32_t next_schedule = this->scheduler.next_schedule_in().value_or(delay_time);
-    // next_schedule is max 0.5*delay_time
-    // otherwise interval=0 schedules result in constant looping with almost no sleep
-    next_schedule = std::max(next_schedule, delay_time / 2);
-    delay_time = std::min(next_schedule, delay_time);
-    delay(delay_time);
+    bool slept = false;
+#ifdef USE_TICKLESS_LOOP
+    const bool dumping_config = this->dump_config_at_ >= 0 && this->dump_config_at_ < this->components_.size();
+    if (!needs_polling && !dumping_config) {
+      // Nothing needs to be polled, sleep until the next scheduled item is due or a component wakes us up
+      uint32_t sleep_time = this->scheduler.next_schedule_in().value_or(TICKLESS_MAX_SLEEP);
+      // same lower bound as below, otherwise interval=0 schedules result in constant looping
+      sleep_time = std::min(std::max(sleep_time, delay_time / 2), TICKLESS_MAX_SLEEP);
+      this->sleep_until_woken_(sleep_time);
+      const uint32_t sleep_end = millis();
+      if (sleep_end - now > delay_time && this->loop_interval_ != 0)
+        this->skipped_loop_iterations_ += (sleep_end - now - delay_time) / this->loop_interval_;
+      slept = true;
+    }
+#endif
+    if (!slept) {
+      uint32_t next_schedule = this->scheduler.next_schedule_in().value_or(delay_time);
+      // next_schedule is max 0.5*delay_time
+      // otherwise interval=0 schedules result in constant looping with almost no sleep
+      next_schedule = std::max(next_schedule, delay_time / 2);
+      delay_time = std::min(next_schedule, delay_time);
+      delay(delay_time);
+    }
   }
   this->last_loop_ = now;
 
@@ -128,6 +179,40 @@ void ICACHE_RAM_ATTR HOT Application::feed_wdt() {
 #endif
   }
 }
+void ICACHE_RAM_ATTR Application::wake_loop() {
+#ifdef USE_TICKLESS_LOOP
+  this->wake_requested_ = true;
+#ifdef ARDUINO_ARCH_ESP32
+  auto *task = static_cast<TaskHandle_t>(this->loop_task_handle_);
+  if (task == nullptr)
+    return;
+  if (xPortInIsrContext()) {
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(task, &higher_priority_task_woken);
+    if (higher_priority_task_woken == pdTRUE)
+      portYIELD_FROM_ISR();
+  } else {
+    xTaskNotifyGive(task);
+  }
+#endif
+#endif
+}
+#ifdef USE_TICKLESS_LOOP
+void Application::sleep_until_woken_(uint32_t timeout) {
+#ifdef ARDUINO_ARCH_ESP32
+  // a wake_loop() between the check and the wait leaves a pending notification, so nothing is lost
+  if (!this->wake_requested_)
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout));
+#endif
+#ifdef ARDUINO_ARCH_ESP8266
+  const uint32_t start = millis();
+  while (!this->wake_requested_ && millis() - start < timeout)
+    delay(1);
+#endif
+  if (this->wake_requested_)
+    this->loop_wakeups_++;
+}
+#endif
 void Application::reboot() {
   ESP_LOGI(TAG, "Forcing a reboot...");
   for (auto *comp : this->components_)
@@ -5,6 +5,7 @@
 #include "esphome/core/defines.h"
 #include "esphome/core/preferences.h"
 #include "esphome/core/component.h"
+#include "esphome/core/entity_index.h"
 #include "esphome/core/helpers.h"
 #include "esphome/core/scheduler.h"
 
@@ -116,6 +117,21 @@ class Application {
 
   void schedule_dump_config() { this->dump_config_at_ = 0; }
 
+  /** Wake up the main loop if it is sleeping in tickless mode, so that loop() of all components is called.
+   *
+   * Safe to call from an interrupt handler or another task. Does nothing if tickless mode is disabled.
+   */
+  void wake_loop();
+
+#ifdef USE_TICKLESS_LOOP
+  /// The number of main loop iterations that have been run.
+  uint32_t get_loop_iterations() const { return this->loop_iterations_; }
+  /// The number of main loop iterations that were skipped because no component needed polling.
+  uint32_t get_skipped_loop_iterations() const { return this->skipped_loop_iterations_; }
+  /// The number of times the main loop was woken up early by wake_loop().
+  uint32_t get_loop_wakeups() const { return this->loop_wakeups_; }
+#endif
+
   void feed_wdt();
 
   void reboot();
@@ -133,76 +149,54 @@ class Application {
 
   uint32_t get_app_state() const { return this->app_state_; }
 
+  const std::vector<Component *> &get_components() { return this->components_; }
+
 #ifdef USE_BINARY_SENSOR
   const std::vector<binary_sensor::BinarySensor *> &get_binary_sensors() { return this->binary_sensors_; }
   binary_sensor::BinarySensor *get_binary_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->binary_sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->binary_sensor_index_.find(this->binary_sensors_, key, include_internal);
   }
 #endif
 #ifdef USE_SWITCH
   const std::vector<switch_::Switch *> &get_switches() { return this->switches_; }
   switch_::Switch *get_switch_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->switches_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->switch_index_.find(this->switches_, key, include_internal);
   }
 #endif
 #ifdef USE_SENSOR
   const std::vector<sensor::Sensor *> &get_sensors() { return this->sensors_; }
   sensor::Sensor *get_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->sensor_index_.find(this->sensors_, key, include_internal);
   }
 #endif
 #ifdef USE_TEXT_SENSOR
   const std::vector<text_sensor::TextSensor *> &get_text_sensors() { return this->text_sensors_; }
   text_sensor::TextSensor *get_text_sensor_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->text_sensors_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->text_sensor_index_.find(this->text_sensors_, key, include_internal);
   }
 #endif
 #ifdef USE_FAN
   const std::vector<fan::FanState *> &get_fans() { return this->fans_; }
   fan::FanState *get_fan_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->fans_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->fan_index_.find(this->fans_, key, include_internal);
   }
 #endif
 #ifdef USE_COVER
   const std::vector<cover::Cover *> &get_covers() { return this->covers_; }
   cover::Cover *get_cover_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->covers_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->cover_index_.find(this->covers_, key, include_internal);
   }
 #endif
 #ifdef USE_LIGHT
   const std::vector<light::LightState *> &get_lights() { return this->lights_; }
   light::LightState *get_light_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->lights_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->light_index_.find(this->lights_, key, include_internal);
   }
 #endif
 #ifdef USE_CLIMATE
   const std::vector<climate::Climate *> &get_climates() { return this->climates_; }
   climate::Climate *get_climate_by_key(uint32_t key, bool include_internal = false) {
-    for (auto *obj : this->climates_)
-      if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
-        return obj;
-    return nullptr;
+    return this->climate_index_.find(this->climates_, key, include_internal);
   }
 #endif
 
@@ -215,32 +209,45 @@ class Application {
 
   void calculate_looping_components_();
 
+#ifdef USE_TICKLESS_LOOP
+  /// Sleep for at most timeout ms, returning early if wake_loop() is called.
+  void sleep_until_woken_(uint32_t timeout);
+#endif
+
   std::vector<Component *> components_{};
   std::vector<Component *> looping_components_{};
 
 #ifdef USE_BINARY_SENSOR
   std::vector<binary_sensor::BinarySensor *> binary_sensors_{};
+  EntityIndex<binary_sensor::BinarySensor> binary_sensor_index_{};
 #endif
 #ifdef USE_SWITCH
   std::vector<switch_::Switch *> switches_{};
+  EntityIndex<switch_::Switch> switch_index_{};
 #endif
 #ifdef USE_SENSOR
   std::vector<sensor::Sensor *> sensors_{};
+  EntityIndex<sensor::Sensor> sensor_index_{};
 #endif
 #ifdef USE_TEXT_SENSOR
   std::vector<text_sensor::TextSensor *> text_sensors_{};
+  EntityIndex<text_sensor::TextSensor> text_sensor_index_{};
 #endif
 #ifdef USE_FAN
   std::vector<fan::FanState *> fans_{};
+  EntityIndex<fan::FanState> fan_index_{};
 #endif
 #ifdef USE_COVER
   std::vector<cover::Cover *> covers_{};
+  EntityIndex<cover::Cover> cover_index_{};
 #endif
 #ifdef USE_CLIMATE
   std::vector<climate::Climate *> climates_{};
+  EntityIndex<climate::Climate> climate_index_{};
 #endif
 #ifdef USE_LIGHT
   std::vector<light::LightState *> lights_{};
+  EntityIndex<light::LightState> light_index_{};
 #endif
 
   std::string name_;
@@ -249,6 +256,15 @@ class Application {
   uint32_t loop_interval_{16};
   int dump_config_at_{-1};
   uint32_t app_state_{0};
+#ifdef USE_TICKLESS_LOOP
+  volatile bool wake_requested_{false};
+#ifdef ARDUINO_ARCH_ESP32
+  void *loop_task_handle_{nullptr};
+#endif
+  uint32_t loop_iterations_{0};
+  uint32_t skipped_loop_iterations_{0};
+  uint32_t loop_wakeups_{0};
+#endif
 };
 
 /// Global storage of Application pointer - only one Application can exist.
@@ -43,7 +43,7 @@ struct Color {
                                                    b((colorcode >> 0) & 0xFF),
                                                    w((colorcode >> 24) & 0xFF) {}
 
-  inline bool is_on() ALWAYS_INLINE { return this->raw_32 != 0; }
+  inline bool is_on() const ALWAYS_INLINE { return this->raw_32 != 0; }
   inline Color &operator=(const Color &rhs) ALWAYS_INLINE {
     this->r = rhs.r;
     this->g = rhs.g;
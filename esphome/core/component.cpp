@@ -77,10 +77,14 @@ void Component::call() {
       this->component_state_ |= COMPONENT_STATE_LOOP;
       this->call_loop();
       break;
-    case COMPONENT_STATE_LOOP:
+    case COMPONENT_STATE_LOOP: {
       // State loop: Call loop
+#ifdef USE_COMPONENT_PROFILER
+      TimingScope scope(this->profile_.loop);
+#endif
       this->call_loop();
       break;
+    }
     case COMPONENT_STATE_FAILED:
       // State failed: Do nothing
       break;
@@ -160,12 +164,19 @@ void PollingComponent::call_setup() {
   this->setup();
 
   // Register interval.
-  this->set_interval("update", this->get_update_interval(), [this]() { this->update(); });
+  this->set_interval("update", this->get_update_interval(), [this]() {
+#ifdef USE_COMPONENT_PROFILER
+    TimingScope scope(this->profile_.update);
+#endif
+    this->update();
+  });
 }
 
 uint32_t PollingComponent::get_update_interval() const { return this->update_interval_; }
 void PollingComponent::set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
 
+uint32_t Nameable::object_id_generation_ = 0;
+
 const std::string &Nameable::get_name() const { return this->name_; }
 void Nameable::set_name(const std::string &name) {
   this->name_ = name;
@@ -180,6 +191,7 @@ void Nameable::calc_object_id_() {
   this->object_id_ = sanitize_string_allowlist(to_lowercase_underscore(this->name_), HOSTNAME_CHARACTER_ALLOWLIST);
   // FNV-1 hash
   this->object_id_hash_ = fnv1_hash(this->object_id_);
+  object_id_generation_++;
 }
 uint32_t Nameable::get_object_id_hash() { return this->object_id_hash_; }
 
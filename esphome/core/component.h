@@ -5,6 +5,10 @@
 #include "Arduino.h"
 
 #include "esphome/core/optional.h"
+#include "esphome/core/defines.h"
+#ifdef USE_COMPONENT_PROFILER
+#include "esphome/core/profiler.h"
+#endif
 
 namespace esphome {
 
@@ -96,6 +100,17 @@ class Component {
   virtual void on_shutdown() {}
   virtual void on_safe_shutdown() {}
 
+  /** Whether loop() has to be called on every iteration of the main loop.
+   *
+   * With the tickless main loop (USE_TICKLESS_LOOP), the application sleeps until the next scheduled
+   * timeout/interval when no looping component needs polling. Components returning false here must call
+   * App.wake_loop() (which is safe from an ISR) whenever they have something to do in loop().
+   *
+   * Defaults to true. Network components (wifi, api, ota, mqtt, ...) still poll their connections and keep this
+   * default, so the loop only goes tickless in configurations without them.
+   */
+  virtual bool needs_polling() const { return true; }
+
   uint32_t get_component_state() const;
 
   /** Mark this component as failed. Any future timeouts/intervals/setup/loop will no longer be called.
@@ -126,7 +141,19 @@ class Component {
 
   void status_momentary_error(const std::string &name, uint32_t length = 5000);
 
-  bool has_overridden_loop() const;
+  /** Whether loop() has to be called at all, by default if this component overrides it.
+   *
+   * Components that only need loop() for some configurations can override this to leave the main loop alone
+   * otherwise.
+   */
+  virtual bool has_overridden_loop() const;
+
+#ifdef USE_COMPONENT_PROFILER
+  /// Set where this component comes from (its ID in the configuration), used when reporting profiling results.
+  void set_component_source(const char *source) { this->component_source_ = source; }
+  const char *get_component_source() const { return this->component_source_; }
+  ComponentProfile &get_profile() { return this->profile_; }
+#endif
 
  protected:
   virtual void call_loop();
@@ -199,6 +226,10 @@ class Component {
 
   uint32_t component_state_{0x0000};  ///< State of this component.
   float setup_priority_override_{NAN};
+#ifdef USE_COMPONENT_PROFILER
+  const char *component_source_{"<unknown>"};
+  ComponentProfile profile_;
+#endif
 };
 
 /** This class simplifies creating components that periodically check a state.
@@ -254,11 +285,16 @@ class Nameable {
   bool is_internal() const;
   void set_internal(bool internal);
 
+  /// Incremented whenever the object id of any Nameable changes, used to invalidate lookup tables.
+  static uint32_t get_object_id_generation() { return object_id_generation_; }
+
  protected:
   virtual uint32_t hash_base() = 0;
 
   void calc_object_id_();
 
+  static uint32_t object_id_generation_;
+
   std::string name_;
   std::string object_id_;
   uint32_t object_id_hash_;
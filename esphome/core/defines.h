@@ -23,3 +23,5 @@
 #define USE_TIME
 #define USE_DEEP_SLEEP
 #define USE_CAPTIVE_PORTAL
+#define USE_TICKLESS_LOOP
+#define USE_COMPONENT_PROFILER
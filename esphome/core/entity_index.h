@@ -0,0 +1,64 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include "esphome/core/component.h"
+
+namespace esphome {
+
+/** Index of entities (Nameable objects) sorted by their object id hash, used to look up entities by API key.
+ *
+ * The index is a sorted array of (key, entity) pairs, so a lookup is a binary search instead of a linear
+ * scan over all entities. It is (re-)built lazily on the first lookup after entities have been registered
+ * or renamed, in practice that's once after setup.
+ */
+template<typename T> class EntityIndex {
+ public:
+  /// Find the first entity in registration order with the given key, like a linear scan over entities would.
+  T *find(const std::vector<T *> &entities, uint32_t key, bool include_internal) {
+    if (entities.size() <= LINEAR_SCAN_THRESHOLD) {
+      // a binary search doesn't pay off for very few entities
+      for (auto *obj : entities) {
+        if (obj->get_object_id_hash() == key && (include_internal || !obj->is_internal()))
+          return obj;
+      }
+      return nullptr;
+    }
+
+    if (this->entries_.size() != entities.size() || this->generation_ != Nameable::get_object_id_generation())
+      this->build_(entities);
+
+    auto it = std::lower_bound(this->entries_.begin(), this->entries_.end(), key,
+                               [](const Entry &entry, uint32_t key) { return entry.key < key; });
+    for (; it != this->entries_.end() && it->key == key; it++) {
+      if (include_internal || !it->entity->is_internal())
+        return it->entity;
+    }
+    return nullptr;
+  }
+
+ protected:
+  static const size_t LINEAR_SCAN_THRESHOLD = 16;
+
+  struct Entry {
+    uint32_t key;
+    T *entity;
+  };
+
+  void build_(const std::vector<T *> &entities) {
+    this->entries_.clear();
+    this->entries_.reserve(entities.size());
+    for (auto *obj : entities)
+      this->entries_.push_back(Entry{obj->get_object_id_hash(), obj});
+    // stable so that entities with the same key stay in registration order
+    std::stable_sort(this->entries_.begin(), this->entries_.end(),
+                     [](const Entry &a, const Entry &b) { return a.key < b.key; });
+    this->generation_ = Nameable::get_object_id_generation();
+  }
+
+  std::vector<Entry> entries_;
+  uint32_t generation_{0};
+};
+
+}  // namespace esphome
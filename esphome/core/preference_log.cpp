@@ -0,0 +1,125 @@
+#include "esphome/core/preference_log.h"
+#include "esphome/core/log.h"
+
+#include <cstring>
+#include <memory>
+
+namespace esphome {
+
+static const char *TAG = "preference_log";
+
+bool PreferenceLog::load() {
+  bool found = false;
+  for (size_t page = 0; page < this->flash_->page_count(); page++) {
+    uint32_t header[HEADER_WORDS];
+    if (!this->flash_->read(page, 0, header, HEADER_WORDS))
+      continue;
+    // pages without a complete snapshot are ignored
+    if (header[0] != PAGE_MAGIC || header[2] != 0)
+      continue;
+    if (found && header[1] <= this->sequence_)
+      continue;
+    found = true;
+    this->page_ = page;
+    this->sequence_ = header[1];
+  }
+  if (!found) {
+    this->write_offset_ = 0;
+    return false;
+  }
+
+  const size_t page_words = this->flash_->page_words();
+  std::unique_ptr<uint32_t[]> data(new uint32_t[this->storage_words_]);
+  size_t pos = HEADER_WORDS;
+  while (pos < page_words) {
+    uint32_t header;
+    if (!this->flash_->read(this->page_, pos, &header, 1) || header == FREE)
+      break;
+    const size_t offset = header >> 16;
+    const size_t words = header & 0xFFFF;
+    uint32_t checksum;
+    if (words == 0 || offset + words > this->storage_words_ || pos + words + 2 > page_words ||
+        !this->flash_->read(this->page_, pos + 1, data.get(), words) ||
+        !this->flash_->read(this->page_, pos + 1 + words, &checksum, 1) ||
+        checksum != checksum_(header, data.get(), words)) {
+      // interrupted write, don't append after it
+      ESP_LOGW(TAG, "Damaged record at %zu in page %zu, ignoring the rest of the page", pos, this->page_);
+      pos = page_words;
+      break;
+    }
+    memcpy(this->storage_ + offset, data.get(), words * 4);
+    pos += words + 2;
+  }
+  this->write_offset_ = pos;
+  ESP_LOGV(TAG, "Loaded page %zu (sequence %u), %zu of %zu words used", this->page_, this->sequence_, pos,
+           page_words);
+  return true;
+}
+
+bool PreferenceLog::append(size_t offset, size_t words) {
+  if (words == 0 || offset + words > this->storage_words_)
+    return false;
+  if (this->write_offset_ != 0 && this->write_offset_ + words + 2 <= this->flash_->page_words())
+    return this->write_record_(offset, words);
+  // the snapshot contains the changed words as well
+  return this->compact_();
+}
+
+uint32_t PreferenceLog::checksum_(uint32_t header, const uint32_t *data, size_t words) {
+  uint32_t checksum = 2166136261UL ^ header;
+  for (size_t i = 0; i < words; i++) {
+    checksum *= 16777619UL;
+    checksum ^= data[i];
+  }
+  return checksum;
+}
+
+bool PreferenceLog::compact_() {
+  if (HEADER_WORDS + this->storage_words_ + 2 > this->flash_->page_words())
+    return false;
+
+  const size_t page = (this->page_ + 1) % this->flash_->page_count();
+  ESP_LOGV(TAG, "Compacting into page %zu", page);
+  this->write_offset_ = 0;
+  if (!this->flash_->erase(page))
+    return false;
+  this->stats_.pages_erased++;
+
+  const uint32_t header[2] = {PAGE_MAGIC, this->sequence_ + 1};
+  if (!this->flash_->write(page, 0, header, 2))
+    return false;
+  this->stats_.words_written += 2;
+  this->page_ = page;
+  this->sequence_++;
+  this->write_offset_ = HEADER_WORDS;
+  if (!this->write_record_(0, this->storage_words_))
+    return false;
+
+  // only now this page replaces the previous one
+  const uint32_t sealed = 0;
+  if (!this->flash_->write(page, 2, &sealed, 1)) {
+    this->write_offset_ = 0;
+    return false;
+  }
+  this->stats_.words_written++;
+  return true;
+}
+
+bool PreferenceLog::write_record_(size_t offset, size_t words) {
+  const size_t pos = this->write_offset_;
+  const uint32_t header = (offset << 16) | words;
+  const uint32_t checksum = checksum_(header, this->storage_ + offset, words);
+  // a failed or interrupted write is detected by the checksum when loading, but nothing can be appended after it
+  this->write_offset_ = this->flash_->page_words();
+  if (!this->flash_->write(this->page_, pos, &header, 1) ||
+      !this->flash_->write(this->page_, pos + 1, this->storage_ + offset, words) ||
+      !this->flash_->write(this->page_, pos + 1 + words, &checksum, 1))
+    return false;
+
+  this->write_offset_ = pos + words + 2;
+  this->stats_.records_written++;
+  this->stats_.words_written += words + 2;
+  return true;
+}
+
+}  // namespace esphome
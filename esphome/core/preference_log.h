@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace esphome {
+
+/** Word-addressed access to the flash pages (erase units) backing a PreferenceLog.
+ *
+ * The only implementation is the ESP8266 preference sector in preferences.cpp. The tree has no RAM-backed
+ * implementation for host tests.
+ */
+class PreferenceFlash {
+ public:
+  /// Size of a page in 32-bit words.
+  virtual size_t page_words() const = 0;
+  virtual size_t page_count() const = 0;
+  virtual bool read(size_t page, size_t offset, uint32_t *data, size_t words) = 0;
+  /// Program words that are currently erased (all bits set), bits can only be cleared.
+  virtual bool write(size_t page, size_t offset, const uint32_t *data, size_t words) = 0;
+  virtual bool erase(size_t page) = 0;
+};
+
+struct PreferenceLogStats {
+  uint32_t records_written;
+  uint32_t words_written;
+  uint32_t pages_erased;
+};
+
+/** Log-structured store for a block of preference words in flash.
+ *
+ * Instead of erasing and rewriting a whole page every time a preference changes, changed words are
+ * appended as records to the current page. Only when a page is full, a snapshot of all words is written
+ * to the next page in the ring ("compaction"), which makes the old pages obsolete. So a page is erased
+ * once per page worth of records instead of once per save.
+ *
+ * Page layout (in words): magic, sequence number, sealed marker, followed by records. The first record
+ * of every page is a snapshot of all words, the sealed marker is cleared once it's complete. A record
+ * is a header word (offset << 16 | length), the data words and a checksum. On load, the sealed page
+ * with the highest sequence number is replayed up to the first free or damaged record.
+ *
+ * Limitations:
+ * - Compaction runs synchronously in append(), so the save (or sync()) that fills a page blocks for a page
+ *   erase and the snapshot write.
+ * - With a single page, compaction erases the page that holds the current data. If power is lost before the
+ *   new snapshot is sealed, all words are lost (and the preferences fall back to their defaults). Only a ring
+ *   of two or more pages avoids this. With one page, the window happens once per page of records instead
+ *   of on every save.
+ */
+class PreferenceLog {
+ public:
+  PreferenceLog(PreferenceFlash *flash, uint32_t *storage, size_t storage_words)
+      : flash_(flash), storage_(storage), storage_words_(storage_words) {}
+
+  /// Restore the words from flash, returns false if the flash doesn't contain a log (yet).
+  bool load();
+  /// Persist storage words [offset, offset + words) which have been changed in RAM.
+  bool append(size_t offset, size_t words);
+
+  const PreferenceLogStats &get_stats() const { return this->stats_; }
+
+ protected:
+  static const uint32_t PAGE_MAGIC = 0x50524546;  // "PREF"
+  static const uint32_t FREE = 0xFFFFFFFF;
+  static const size_t HEADER_WORDS = 3;
+
+  static uint32_t checksum_(uint32_t header, const uint32_t *data, size_t words);
+  /// Erase the next page and write a snapshot of all words to it.
+  bool compact_();
+  bool write_record_(size_t offset, size_t words);
+
+  PreferenceFlash *flash_;
+  uint32_t *storage_;
+  size_t storage_words_;
+  size_t page_{0};
+  uint32_t sequence_{0};
+  /// Position of the next record in the current page, 0 if there's no usable page.
+  size_t write_offset_{0};
+  PreferenceLogStats stats_{};
+};
+
+}  // namespace esphome
@@ -3,6 +3,8 @@
 #include "esphome/core/helpers.h"
 #include "esphome/core/application.h"
 
+#include <algorithm>
+
 #ifdef ARDUINO_ARCH_ESP8266
 extern "C" {
 #include "spi_flash.h"
@@ -73,8 +75,6 @@ static inline bool esp_rtc_user_mem_read(uint32_t index, uint32_t *dest) {
   return true;
 }
 
-static bool esp8266_flash_dirty = false;
-
 static inline bool esp_rtc_user_mem_write(uint32_t index, uint32_t value) {
   if (index >= ESP_RTC_USER_MEM_SIZE_WORDS) {
     return false;
@@ -100,33 +100,55 @@ static const uint32_t get_esp8266_flash_sector() {
 }
 static const uint32_t get_esp8266_flash_address() { return get_esp8266_flash_sector() * SPI_FLASH_SEC_SIZE; }
 
-void ESPPreferences::save_esp8266_flash_() {
-  if (!esp8266_flash_dirty)
-    return;
-
-  ESP_LOGVV(TAG, "Saving preferences to flash...");
-  SpiFlashOpResult erase_res, write_res = SPI_FLASH_RESULT_OK;
-  {
+/** The sector reserved for preferences (the EEPROM sector after SPIFFS), used as a ring of a single page.
+ *
+ * The sectors around it belong to SPIFFS or the sketch and to the SDK (RF calibration, WiFi settings), so
+ * there's no second sector that is safe to use on every board. See PreferenceLog for what that means when
+ * power is lost during compaction.
+ */
+class ESP8266PreferenceFlash : public PreferenceFlash {
+ public:
+  size_t page_words() const override { return SPI_FLASH_SEC_SIZE / 4; }
+  size_t page_count() const override { return 1; }
+  bool read(size_t page, size_t offset, uint32_t *data, size_t words) override {
     InterruptLock lock;
-    erase_res = spi_flash_erase_sector(get_esp8266_flash_sector());
-    if (erase_res == SPI_FLASH_RESULT_OK) {
-      write_res = spi_flash_write(get_esp8266_flash_address(), this->flash_storage_, ESP8266_FLASH_STORAGE_SIZE * 4);
-    }
+    return spi_flash_read(this->address_(page, offset), data, words * 4) == SPI_FLASH_RESULT_OK;
   }
-  if (erase_res != SPI_FLASH_RESULT_OK) {
-    ESP_LOGV(TAG, "Erase ESP8266 flash failed!");
-    return;
+  bool write(size_t page, size_t offset, const uint32_t *data, size_t words) override {
+    InterruptLock lock;
+    return spi_flash_write(this->address_(page, offset), const_cast<uint32_t *>(data), words * 4) ==
+           SPI_FLASH_RESULT_OK;
   }
-  if (write_res != SPI_FLASH_RESULT_OK) {
-    ESP_LOGV(TAG, "Write ESP8266 flash failed!");
-    return;
+  bool erase(size_t page) override {
+    InterruptLock lock;
+    return spi_flash_erase_sector(get_esp8266_flash_sector() + page) == SPI_FLASH_RESULT_OK;
+  }
+
+ protected:
+  uint32_t address_(size_t page, size_t offset) const {
+    return get_esp8266_flash_address() + page * SPI_FLASH_SEC_SIZE + offset * 4;
   }
+};
+
+bool ESPPreferences::sync() {
+  if (this->pending_.empty())
+    return true;
 
-  esp8266_flash_dirty = false;
+  ESP_LOGVV(TAG, "Saving preferences to flash...");
+  for (auto &range : this->pending_) {
+    if (!this->flash_log_->append(range.offset, range.words)) {
+      // keep the changes pending, the next sync() tries again
+      ESP_LOGV(TAG, "Write ESP8266 flash failed!");
+      return false;
+    }
+  }
+  this->pending_.clear();
+  return true;
 }
 
 bool ESPPreferenceObject::save_internal_() {
   if (this->in_flash_) {
+    bool changed = false;
     for (uint32_t i = 0; i <= this->length_words_; i++) {
       uint32_t j = this->offset_ + i;
       if (j >= ESP8266_FLASH_STORAGE_SIZE)
@@ -134,10 +156,21 @@ bool ESPPreferenceObject::save_internal_() {
       uint32_t v = this->data_[i];
       uint32_t *ptr = &global_preferences.flash_storage_[j];
       if (*ptr != v)
-        esp8266_flash_dirty = true;
+        changed = true;
       *ptr = v;
     }
-    global_preferences.save_esp8266_flash_();
+    if (!changed)
+      return true;
+
+    auto &pending = global_preferences.pending_;
+    const ESPPreferences::PendingRange range{static_cast<uint16_t>(this->offset_),
+                                             static_cast<uint16_t>(this->length_words_ + 1)};
+    if (std::find_if(pending.begin(), pending.end(), [&range](const ESPPreferences::PendingRange &other) {
+          return other.offset == range.offset;
+        }) == pending.end())
+      pending.push_back(range);
+    if (!global_preferences.defer_writes_)
+      global_preferences.sync();
     return true;
   }
 
@@ -174,9 +207,12 @@ ESPPreferences::ESPPreferences()
 
 void ESPPreferences::begin() {
   this->flash_storage_ = new uint32_t[ESP8266_FLASH_STORAGE_SIZE];
+  this->flash_log_ = new PreferenceLog(new ESP8266PreferenceFlash(), this->flash_storage_, ESP8266_FLASH_STORAGE_SIZE);
   ESP_LOGVV(TAG, "Loading preferences from flash...");
 
-  {
+  if (!this->flash_log_->load()) {
+    // Written by an older version, which stored the words at the start of the sector. This
+    // is converted to the log format on the first save.
     InterruptLock lock;
     spi_flash_read(get_esp8266_flash_address(), this->flash_storage_, ESP8266_FLASH_STORAGE_SIZE * 4);
   }
@@ -227,21 +263,38 @@ bool ESPPreferences::is_prevent_write() { return this->prevent_write_; }
 #endif
 
 #ifdef ARDUINO_ARCH_ESP32
+static bool nvs_write_blob(uint32_t handle, uint32_t key, const uint32_t *data, uint32_t len) {
+  char key_str[32];
+  sprintf(key_str, "%u", key);
+  esp_err_t err = nvs_set_blob(handle, key_str, data, len);
+  if (err) {
+    ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", key_str, len, esp_err_to_name(err));
+    return false;
+  }
+  return true;
+}
 bool ESPPreferenceObject::save_internal_() {
   if (global_preferences.nvs_handle_ == 0)
     return false;
 
-  char key[32];
-  sprintf(key, "%u", this->offset_);
   uint32_t len = (this->length_words_ + 1) * 4;
-  esp_err_t err = nvs_set_blob(global_preferences.nvs_handle_, key, this->data_, len);
-  if (err) {
-    ESP_LOGV(TAG, "nvs_set_blob('%s', len=%u) failed: %s", key, len, esp_err_to_name(err));
-    return false;
+  if (global_preferences.defer_writes_) {
+    auto &pending = global_preferences.pending_;
+    auto it = std::find_if(pending.begin(), pending.end(),
+                           [this](const ESPPreferences::PendingSave &save) { return save.key == this->offset_; });
+    if (it == pending.end()) {
+      pending.push_back(ESPPreferences::PendingSave{static_cast<uint32_t>(this->offset_), {}});
+      it = pending.end() - 1;
+    }
+    it->data.assign(this->data_, this->data_ + this->length_words_ + 1);
+    return true;
   }
-  err = nvs_commit(global_preferences.nvs_handle_);
+
+  if (!nvs_write_blob(global_preferences.nvs_handle_, this->offset_, this->data_, len))
+    return false;
+  esp_err_t err = nvs_commit(global_preferences.nvs_handle_);
   if (err) {
-    ESP_LOGV(TAG, "nvs_commit('%s', len=%u) failed: %s", key, len, esp_err_to_name(err));
+    ESP_LOGV(TAG, "nvs_commit('%u', len=%u) failed: %s", this->offset_, len, esp_err_to_name(err));
     return false;
   }
   return true;
@@ -250,9 +303,19 @@ bool ESPPreferenceObject::load_internal_() {
   if (global_preferences.nvs_handle_ == 0)
     return false;
 
+  uint32_t len = (this->length_words_ + 1) * 4;
+  for (auto &save : global_preferences.pending_) {
+    if (save.key == this->offset_) {
+      // not written yet
+      if (save.data.size() * 4 != len)
+        return false;
+      memcpy(this->data_, save.data.data(), len);
+      return true;
+    }
+  }
+
   char key[32];
   sprintf(key, "%u", this->offset_);
-  uint32_t len = (this->length_words_ + 1) * 4;
 
   uint32_t actual_len;
   esp_err_t err = nvs_get_blob(global_preferences.nvs_handle_, key, nullptr, &actual_len);
@@ -271,6 +334,24 @@ bool ESPPreferenceObject::load_internal_() {
   }
   return true;
 }
+bool ESPPreferences::sync() {
+  if (this->pending_.empty() || this->nvs_handle_ == 0)
+    return true;
+
+  ESP_LOGVV(TAG, "Saving %u preferences to NVS...", this->pending_.size());
+  for (auto &save : this->pending_) {
+    if (!nvs_write_blob(this->nvs_handle_, save.key, save.data.data(), save.data.size() * 4))
+      return false;
+  }
+  // one commit for all changes
+  esp_err_t err = nvs_commit(this->nvs_handle_);
+  if (err) {
+    ESP_LOGV(TAG, "nvs_commit failed: %s", esp_err_to_name(err));
+    return false;
+  }
+  this->pending_.clear();
+  return true;
+}
 ESPPreferences::ESPPreferences() : current_offset_(0) {}
 void ESPPreferences::begin() {
   auto ns = truncate_string(App.get_name(), 15);
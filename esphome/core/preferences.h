@@ -1,9 +1,11 @@
 #pragma once
 
 #include <string>
+#include <vector>
 
 #include "esphome/core/esphal.h"
 #include "esphome/core/defines.h"
+#include "esphome/core/preference_log.h"
 
 namespace esphome {
 
@@ -56,6 +58,16 @@ class ESPPreferences {
   ESPPreferenceObject make_preference(size_t length, uint32_t type, bool in_flash = DEFAULT_IN_FLASH);
   template<typename T> ESPPreferenceObject make_preference(uint32_t type, bool in_flash = DEFAULT_IN_FLASH);
 
+  /** Only write changed preferences to flash when sync() is called instead of on every save.
+   *
+   * Repeated saves of the same preference in between result in a single flash write.
+   */
+  void set_defer_writes(bool defer_writes) { this->defer_writes_ = defer_writes; }
+  /// Write all pending preference changes to flash.
+  bool sync();
+  /// Number of preferences with changes that haven't been written to flash yet.
+  size_t get_pending_count() const { return this->pending_.size(); }
+
 #ifdef ARDUINO_ARCH_ESP8266
   /** On the ESP8266, we can't override the first 128 bytes during OTA uploads
    * as the eboot parameters are stored there. Writing there during an OTA upload
@@ -66,20 +78,34 @@ class ESPPreferences {
    */
   void prevent_write(bool prevent);
   bool is_prevent_write();
+  /// Write statistics of the log-structured flash storage.
+  const PreferenceLogStats &get_flash_stats() const { return this->flash_log_->get_stats(); }
 #endif
 
  protected:
   friend ESPPreferenceObject;
 
   uint32_t current_offset_;
+  bool defer_writes_{false};
 #ifdef ARDUINO_ARCH_ESP32
   uint32_t nvs_handle_;
+  struct PendingSave {
+    uint32_t key;
+    std::vector<uint32_t> data;
+  };
+  std::vector<PendingSave> pending_;
 #endif
 #ifdef ARDUINO_ARCH_ESP8266
-  void save_esp8266_flash_();
   bool prevent_write_{false};
   uint32_t *flash_storage_;
   uint32_t current_flash_offset_;
+  PreferenceLog *flash_log_{nullptr};
+  /// Ranges of flash_storage_ words that have been changed since the last sync().
+  struct PendingRange {
+    uint16_t offset;
+    uint16_t words;
+  };
+  std::vector<PendingRange> pending_;
 #endif
 };
 
@@ -0,0 +1,61 @@
+#include "esphome/core/profiler.h"
+#include <algorithm>
+#include <cmath>
+
+namespace esphome {
+
+void TimingStats::record(uint32_t duration_us) {
+  this->count_++;
+  this->total_ += duration_us;
+  if (duration_us < this->min_)
+    this->min_ = duration_us;
+  if (duration_us > this->max_)
+    this->max_ = duration_us;
+
+  uint8_t bucket = 0;
+  if (duration_us >= 16) {
+    bucket = (31 - __builtin_clz(duration_us)) - 3;
+    if (bucket >= BUCKETS)
+      bucket = BUCKETS - 1;
+  }
+  if (this->histogram_[bucket] == UINT16_MAX) {
+    // halve everything, keeps the shape of the distribution
+    for (auto &count : this->histogram_)
+      count /= 2;
+  }
+  this->histogram_[bucket]++;
+}
+void TimingStats::reset() {
+  this->count_ = 0;
+  this->min_ = UINT32_MAX;
+  this->max_ = 0;
+  this->total_ = 0;
+  for (auto &count : this->histogram_)
+    count = 0;
+}
+uint32_t TimingStats::get_average() const {
+  if (this->count_ == 0)
+    return 0;
+  return this->total_ / this->count_;
+}
+uint32_t TimingStats::get_percentile(float percentile) const {
+  uint32_t histogram_total = 0;
+  for (auto count : this->histogram_)
+    histogram_total += count;
+  if (histogram_total == 0)
+    return 0;
+
+  // nearest-rank method
+  const uint32_t target = std::max<uint32_t>(1, ceilf(histogram_total * (percentile / 100.0f)));
+  uint32_t seen = 0;
+  for (uint8_t bucket = 0; bucket < BUCKETS; bucket++) {
+    seen += this->histogram_[bucket];
+    if (seen >= target) {
+      const uint32_t upper = (1UL << (bucket + 4)) - 1;
+      return std::min(upper, this->max_);
+    }
+  }
+  return this->max_;
+}
+
+}  // namespace esphome
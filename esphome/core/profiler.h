@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include "Arduino.h"
+
+namespace esphome {
+
+/** Execution time statistics with a fixed memory footprint.
+ *
+ * Besides count/min/max/average, durations are sorted into a logarithmic histogram
+ * so that percentiles can be estimated without storing individual samples.
+ */
+class TimingStats {
+ public:
+  /// Number of histogram buckets, bucket i (i > 0) holds durations in [2^(i+3), 2^(i+4)) µs.
+  static const uint8_t BUCKETS = 16;
+
+  void record(uint32_t duration_us);
+  void reset();
+
+  uint32_t get_count() const { return this->count_; }
+  uint32_t get_min() const { return this->count_ == 0 ? 0 : this->min_; }
+  uint32_t get_max() const { return this->max_; }
+  uint32_t get_average() const;
+  /** Estimate the given percentile (0-100) of all recorded durations in µs.
+   *
+   * This is the upper bound of the histogram bucket the percentile falls into, limited by the maximum.
+   */
+  uint32_t get_percentile(float percentile) const;
+
+ protected:
+  uint32_t count_{0};
+  uint32_t min_{UINT32_MAX};
+  uint32_t max_{0};
+  uint64_t total_{0};
+  uint16_t histogram_[BUCKETS]{};
+};
+
+/// Timing statistics of one component, see USE_COMPONENT_PROFILER.
+struct ComponentProfile {
+  /// Time spent in loop().
+  TimingStats loop;
+  /// Time spent in update() of PollingComponents.
+  TimingStats update;
+  /// Time spent in timeouts/intervals of this component (including update()).
+  TimingStats scheduler;
+
+  void reset() {
+    this->loop.reset();
+    this->update.reset();
+    this->scheduler.reset();
+  }
+};
+
+/// Records the time between construction and destruction into the given statistics.
+class TimingScope {
+ public:
+  explicit TimingScope(TimingStats &stats) : stats_(stats), start_(micros()) {}
+  ~TimingScope() { this->stats_.record(micros() - this->start_); }
+
+ protected:
+  TimingStats &stats_;
+  uint32_t start_;
+};
+
+}  // namespace esphome
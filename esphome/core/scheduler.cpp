@@ -8,14 +8,15 @@ namespace esphome {
 static const char *TAG = "scheduler";
 
 static const uint32_t SCHEDULER_DONT_RUN = 4294967295UL;
-static const uint32_t MAX_LOGICALLY_DELETED_ITEMS = 10;
+/// Number of items allocated at once when the item pool runs dry.
+static const uint8_t SCHEDULER_POOL_BLOCK_SIZE = 8;
 
 // Uncomment to debug scheduler
 // #define ESPHOME_DEBUG_SCHEDULER
 
 void HOT Scheduler::set_timeout(Component *component, const std::string &name, uint32_t timeout,
                                 std::function<void()> &&func) {
-  const uint32_t now = this->millis_();
+  const uint64_t now = this->millis_();
 
   if (!name.empty())
     this->cancel_timeout(component, name);
@@ -25,23 +26,24 @@ void HOT Scheduler::set_timeout(Component *component, const std::string &name, u
 
   ESP_LOGVV(TAG, "set_timeout(name='%s', timeout=%u)", name.c_str(), timeout);
 
-  auto item = make_unique<SchedulerItem>();
+  auto *item = this->alloc_item_();
   item->component = component;
-  item->name = name;
+  item->named = !name.empty();
+  item->name_hash = item->named ? fnv1_hash(name) : 0;
   item->type = SchedulerItem::TIMEOUT;
-  item->timeout = timeout;
-  item->last_execution = now;
-  item->last_execution_major = this->millis_major_;
+  item->interval = timeout;
+  item->next_execution = now + timeout;
   item->f = std::move(func);
-  item->remove = false;
-  this->push_(std::move(item));
+  if (item->named)
+    this->index_add_(item);
+  this->push_(item);
 }
 bool HOT Scheduler::cancel_timeout(Component *component, const std::string &name) {
   return this->cancel_item_(component, name, SchedulerItem::TIMEOUT);
 }
 void HOT Scheduler::set_interval(Component *component, const std::string &name, uint32_t interval,
                                  std::function<void()> &&func) {
-  const uint32_t now = this->millis_();
+  const uint64_t now = this->millis_();
 
   if (!name.empty())
     this->cancel_interval(component, name);
@@ -56,216 +58,338 @@ void HOT Scheduler::set_interval(Component *component, const std::string &name,
 
   ESP_LOGVV(TAG, "set_interval(name='%s', interval=%u, offset=%u)", name.c_str(), interval, offset);
 
-  auto item = make_unique<SchedulerItem>();
+  auto *item = this->alloc_item_();
   item->component = component;
-  item->name = name;
+  item->named = !name.empty();
+  item->name_hash = item->named ? fnv1_hash(name) : 0;
   item->type = SchedulerItem::INTERVAL;
   item->interval = interval;
-  item->last_execution = now - offset - interval;
-  item->last_execution_major = this->millis_major_;
-  if (item->last_execution > now)
-    item->last_execution_major--;
+  // first execution happens right away, the offset only shifts the phase of later executions
+  item->next_execution = now > offset ? now - offset : 0;
   item->f = std::move(func);
-  item->remove = false;
-  this->push_(std::move(item));
+  if (item->named)
+    this->index_add_(item);
+  this->push_(item);
 }
 bool HOT Scheduler::cancel_interval(Component *component, const std::string &name) {
   return this->cancel_item_(component, name, SchedulerItem::INTERVAL);
 }
 optional<uint32_t> HOT Scheduler::next_schedule_in() {
-  if (this->empty_())
+  this->process_to_add();
+  if (!this->ready_.empty())
+    return 0;
+
+  const uint64_t next_time = this->next_event_tick_();
+  if (next_time == UINT64_MAX)
     return {};
-  auto &item = this->items_[0];
-  const uint32_t now = this->millis_();
-  uint32_t next_time = item->last_execution + item->interval;
-  if (next_time < now)
+
+  const uint64_t now = this->millis_();
+  if (next_time <= now)
     return 0;
-  return next_time - now;
+  return std::min<uint64_t>(next_time - now, SCHEDULER_DONT_RUN - 1);
 }
 void ICACHE_RAM_ATTR HOT Scheduler::call() {
-  const uint32_t now = this->millis_();
+  const uint64_t now = this->millis_();
   this->process_to_add();
 
 #ifdef ESPHOME_DEBUG_SCHEDULER
-  static uint32_t last_print = 0;
+  static uint64_t last_print = 0;
 
   if (now - last_print > 2000) {
     last_print = now;
-    std::vector<std::unique_ptr<SchedulerItem>> old_items;
-    ESP_LOGVV(TAG, "Items: count=%u, now=%u", this->items_.size(), now);
-    while (!this->empty_()) {
-      auto item = std::move(this->items_[0]);
-      const char *type = item->type == SchedulerItem::INTERVAL ? "interval" : "timeout";
-      ESP_LOGVV(TAG, "  %s '%s' interval=%u last_execution=%u (%u) next=%u (%u)", type, item->name.c_str(),
-                item->interval, item->last_execution, item->last_execution_major, item->next_execution(),
-                item->next_execution_major());
-
-      this->pop_raw_();
-      old_items.push_back(std::move(item));
-    }
-    ESP_LOGVV(TAG, "\n");
-    this->items_ = std::move(old_items);
+    ESP_LOGVV(TAG, "Items: used=%u pool=%u, now=%u tick=%u", this->pool_used_, this->pool_size_, uint32_t(now),
+              uint32_t(this->current_tick_));
+    for (uint8_t level = 0; level < LEVELS; level++)
+      ESP_LOGVV(TAG, "  Level %u: occupied=0x%08X", level, this->occupied_[level]);
   }
 #endif  // ESPHOME_DEBUG_SCHEDULER
 
-  auto to_remove_was = to_remove_;
-  auto items_was = items_.size();
-  // If we have too many items to remove
-  if (to_remove_ > MAX_LOGICALLY_DELETED_ITEMS) {
-    std::vector<std::unique_ptr<SchedulerItem>> valid_items;
-    while (!this->empty_()) {
-      auto item = std::move(this->items_[0]);
-      this->pop_raw_();
-      valid_items.push_back(std::move(item));
-    }
-    this->items_ = std::move(valid_items);
-
-    // The following should not happen unless I'm missing something
-    if (to_remove_ != 0) {
-      ESP_LOGW(TAG, "to_remove_ was %u now: %u items where %zu now %zu. Please report this", to_remove_was, to_remove_,
-               items_was, items_.size());
-      to_remove_ = 0;
-    }
+  // Items that were already due when they were added (defer() and friends)
+  if (!this->ready_.empty()) {
+    ItemList due = this->ready_;
+    this->ready_.head = nullptr;
+    this->run_list_(due, now);
   }
 
-  while (!this->empty_()) {
-    // use scoping to indicate visibility of `item` variable
-    {
-      // Don't copy-by value yet
-      auto &item = this->items_[0];
-      if ((now - item->last_execution) < item->interval)
-        // Not reached timeout yet, done for this call
-        break;
-      uint8_t major = item->next_execution_major();
-      if (this->millis_major_ - major > 1)
-        break;
-
-      // Don't run on failed components
-      if (item->component != nullptr && item->component->is_failed()) {
-        this->pop_raw_();
-        continue;
+  while (this->current_tick_ <= now) {
+    const uint32_t index = this->current_tick_ & LEVEL_MASK;
+    if (index == 0) {
+      // Wrapped around on level 0, pull the items of the next slot of each coarser level down.
+      // Go from the top so that items cascade through several levels in one go.
+      const uint8_t top_shift = LEVEL_BITS * LEVELS;
+      if ((this->current_tick_ & ((1ULL << top_shift) - 1)) == 0) {
+        ItemList far = this->overflow_;
+        this->overflow_.head = nullptr;
+        while (SchedulerItem *item = far.pop_front())
+          this->wheel_insert_(item);
+      }
+      for (uint8_t level = LEVELS - 1; level > 0; level--) {
+        if ((this->current_tick_ & ((1ULL << (LEVEL_BITS * level)) - 1)) == 0)
+          this->cascade_(level);
       }
-
-#ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
-      const char *type = item->type == SchedulerItem::INTERVAL ? "interval" : "timeout";
-      ESP_LOGVV(TAG, "Running %s '%s' with interval=%u last_execution=%u (now=%u)", type, item->name.c_str(),
-                item->interval, item->last_execution, now);
-#endif
-
-      // Warning: During f(), a lot of stuff can happen, including:
-      //  - timeouts/intervals get added, potentially invalidating vector pointers
-      //  - timeouts/intervals get cancelled
-      item->f();
     }
 
-    {
-      // new scope, item from before might have been moved in the vector
-      auto item = std::move(this->items_[0]);
-
-      // Only pop after function call, this ensures we were reachable
-      // during the function call and know if we were cancelled.
-      this->pop_raw_();
-
-      if (item->remove) {
-        // We were removed/cancelled in the function call, stop
-        to_remove_--;
-        continue;
-      }
+    if (this->occupied_[0] & (1UL << index)) {
+      ItemList due = this->slots_[0][index];
+      this->slots_[0][index].head = nullptr;
+      this->occupied_[0] &= ~(1UL << index);
+      this->current_tick_++;
+      this->run_list_(due, now);
+      continue;
+    }
 
-      if (item->type == SchedulerItem::INTERVAL) {
-        if (item->interval != 0) {
-          const uint32_t before = item->last_execution;
-          const uint32_t amount = (now - item->last_execution) / item->interval;
-          item->last_execution += amount * item->interval;
-          if (item->last_execution < before)
-            item->last_execution_major++;
-        }
-        this->push_(std::move(item));
-      }
+    // Nothing in this slot, skip ahead to the next tick at which there's something to run or cascade
+    const uint64_t next_tick = std::max(this->next_event_tick_(), this->current_tick_ + 1);
+    if (next_tick > now) {
+      this->current_tick_ = now + 1;
+      break;
     }
+    this->current_tick_ = next_tick;
   }
 
   this->process_to_add();
 }
+uint64_t HOT Scheduler::next_event_tick_() {
+  for (uint8_t level = 0; level < LEVELS; level++) {
+    const uint8_t shift = LEVEL_BITS * level;
+    const uint32_t digit = (this->current_tick_ >> shift) & LEVEL_MASK;
+    const uint32_t bits = this->occupied_[level] & (~0UL << digit);
+    if (bits == 0)
+      continue;
+    // Start of the first occupied slot. That is exact for level 0 and a lower bound for the
+    // coarser levels, which is where the items get cascaded down.
+    const uint64_t base = (this->current_tick_ >> (shift + LEVEL_BITS)) << (shift + LEVEL_BITS);
+    return std::max(base | (uint64_t(__builtin_ctz(bits)) << shift), this->current_tick_);
+  }
+  if (!this->overflow_.empty()) {
+    // next wrap-around of the top level (which may be the current tick)
+    const uint64_t mask = (1ULL << (LEVEL_BITS * LEVELS)) - 1;
+    return (this->current_tick_ + mask) & ~mask;
+  }
+  return UINT64_MAX;
+}
 void HOT Scheduler::process_to_add() {
-  for (auto &it : this->to_add_) {
-    if (it->remove) {
+  while (SchedulerItem *item = this->to_add_.pop_front())
+    this->wheel_insert_(item);
+}
+void HOT Scheduler::run_list_(ItemList &list, uint64_t now) {
+  // Mark everything first so that cancelling any of these items from a callback is deferred to here
+  for (SchedulerItem *item = list.head; item != nullptr; item = item->next)
+    item->state = SchedulerItem::DUE;
+
+  while (SchedulerItem *item = list.pop_front()) {
+    // Don't run on failed components
+    if (item->remove || (item->component != nullptr && item->component->is_failed())) {
+      this->free_item_(item);
+      continue;
+    }
+
+#ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
+    const char *type = item->type == SchedulerItem::INTERVAL ? "interval" : "timeout";
+    ESP_LOGVV(TAG, "Running %s with interval=%u next_execution=%u (now=%u)", type, item->interval,
+              uint32_t(item->next_execution), uint32_t(now));
+#endif
+
+    // Warning: During f(), a lot of stuff can happen, including:
+    //  - timeouts/intervals get added
+    //  - timeouts/intervals get cancelled, including this one and the others in this list
+#ifdef USE_COMPONENT_PROFILER
+    const uint32_t start = micros();
+#endif
+    item->f();
+#ifdef USE_COMPONENT_PROFILER
+    if (item->component != nullptr)
+      item->component->get_profile().scheduler.record(micros() - start);
+#endif
+
+    if (item->remove || item->type != SchedulerItem::INTERVAL) {
+      this->free_item_(item);
       continue;
     }
 
-    this->items_.push_back(std::move(it));
-    std::push_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
+    if (item->interval != 0) {
+      // skip executions that were missed because the loop was blocked
+      const uint64_t amount = (now - item->next_execution) / item->interval + 1;
+      item->next_execution += amount * item->interval;
+    }
+    this->push_(item);
   }
-  this->to_add_.clear();
 }
-void HOT Scheduler::cleanup_() {
-  while (!this->items_.empty()) {
-    auto &item = this->items_[0];
-    if (!item->remove)
-      return;
-
-    to_remove_--;
-    this->pop_raw_();
+void HOT Scheduler::push_(Scheduler::SchedulerItem *item) {
+  item->state = SchedulerItem::PENDING;
+  this->to_add_.push_back(item);
+}
+void HOT Scheduler::wheel_insert_(Scheduler::SchedulerItem *item) {
+  if (item->next_execution < this->current_tick_) {
+    item->state = SchedulerItem::READY;
+    this->ready_.push_back(item);
+    return;
+  }
+
+  // The level is decided by the most significant bit in which the execution time differs from the current tick
+  const uint64_t diff = item->next_execution ^ this->current_tick_;
+  if ((diff >> (LEVEL_BITS * LEVELS)) != 0) {
+    item->state = SchedulerItem::FAR_FUTURE;
+    this->overflow_.push_back(item);
+    return;
   }
+  uint8_t level = 0;
+  while ((diff >> (LEVEL_BITS * (level + 1))) != 0)
+    level++;
+
+  item->state = SchedulerItem::WHEEL;
+  item->level = level;
+  item->slot = (item->next_execution >> (LEVEL_BITS * level)) & LEVEL_MASK;
+  this->slots_[level][item->slot].push_back(item);
+  this->occupied_[level] |= 1UL << item->slot;
+}
+void HOT Scheduler::wheel_remove_(Scheduler::SchedulerItem *item) {
+  ItemList &list = this->slots_[item->level][item->slot];
+  list.unlink(item);
+  if (list.empty())
+    this->occupied_[item->level] &= ~(1UL << item->slot);
 }
-void HOT Scheduler::pop_raw_() {
-  std::pop_heap(this->items_.begin(), this->items_.end(), SchedulerItem::cmp);
-  this->items_.pop_back();
+void HOT Scheduler::cascade_(uint8_t level) {
+  const uint8_t slot = (this->current_tick_ >> (LEVEL_BITS * level)) & LEVEL_MASK;
+  ItemList list = this->slots_[level][slot];
+  this->slots_[level][slot].head = nullptr;
+  this->occupied_[level] &= ~(1UL << slot);
+  while (SchedulerItem *item = list.pop_front())
+    this->wheel_insert_(item);
 }
-void HOT Scheduler::push_(std::unique_ptr<Scheduler::SchedulerItem> item) { this->to_add_.push_back(std::move(item)); }
 bool HOT Scheduler::cancel_item_(Component *component, const std::string &name, Scheduler::SchedulerItem::Type type) {
+  // unnamed items can't be cancelled and are therefore not indexed
+  if (name.empty())
+    return false;
+
+  const uint32_t name_hash = fnv1_hash(name);
   bool ret = false;
-  for (auto &it : this->items_)
-    if (it->component == component && it->name == name && it->type == type && !it->remove) {
-      to_remove_++;
-      it->remove = true;
-      ret = true;
-    }
-  for (auto &it : this->to_add_)
-    if (it->component == component && it->name == name && it->type == type) {
-      it->remove = true;
+  SchedulerItem *item = this->index_[index_bucket_(component, name_hash)];
+  while (item != nullptr) {
+    SchedulerItem *next = item->index_next;
+    if (item->component == component && item->name_hash == name_hash && item->type == type && !item->remove) {
       ret = true;
+      switch (item->state) {
+        case SchedulerItem::PENDING:
+          this->to_add_.unlink(item);
+          this->free_item_(item);
+          break;
+        case SchedulerItem::READY:
+          this->ready_.unlink(item);
+          this->free_item_(item);
+          break;
+        case SchedulerItem::WHEEL:
+          this->wheel_remove_(item);
+          this->free_item_(item);
+          break;
+        case SchedulerItem::FAR_FUTURE:
+          this->overflow_.unlink(item);
+          this->free_item_(item);
+          break;
+        default:
+          // currently being run by call(), which frees it afterwards
+          item->remove = true;
+          break;
+      }
     }
+    item = next;
+  }
 
   return ret;
 }
-uint32_t Scheduler::millis_() {
+Scheduler::SchedulerItem *HOT Scheduler::alloc_item_() {
+  if (this->free_items_ == nullptr) {
+    auto *block = new SchedulerItem[SCHEDULER_POOL_BLOCK_SIZE];
+    for (uint8_t i = 0; i < SCHEDULER_POOL_BLOCK_SIZE; i++) {
+      block[i].state = SchedulerItem::FREE;
+      block[i].next = this->free_items_;
+      this->free_items_ = &block[i];
+    }
+    this->pool_size_ += SCHEDULER_POOL_BLOCK_SIZE;
+  }
+
+  SchedulerItem *item = this->free_items_;
+  this->free_items_ = item->next;
+  this->pool_used_++;
+  item->prev = nullptr;
+  item->next = nullptr;
+  item->index_next = nullptr;
+  item->remove = false;
+  return item;
+}
+void HOT Scheduler::free_item_(Scheduler::SchedulerItem *item) {
+  if (item->named)
+    this->index_remove_(item);
+  // release anything captured by the callback
+  item->f = nullptr;
+  item->state = SchedulerItem::FREE;
+  item->next = this->free_items_;
+  this->free_items_ = item;
+  this->pool_used_--;
+}
+uint8_t Scheduler::index_bucket_(Component *component, uint32_t name_hash) {
+  return ((reinterpret_cast<uintptr_t>(component) >> 2) ^ name_hash) % INDEX_BUCKETS;
+}
+void HOT Scheduler::index_add_(Scheduler::SchedulerItem *item) {
+  SchedulerItem *&head = this->index_[index_bucket_(item->component, item->name_hash)];
+  item->index_next = head;
+  head = item;
+}
+void HOT Scheduler::index_remove_(Scheduler::SchedulerItem *item) {
+  SchedulerItem **it = &this->index_[index_bucket_(item->component, item->name_hash)];
+  while (*it != nullptr) {
+    if (*it == item) {
+      *it = item->index_next;
+      break;
+    }
+    it = &(*it)->index_next;
+  }
+  item->index_next = nullptr;
+}
+uint64_t Scheduler::millis_() {
   const uint32_t now = millis();
   if (now < this->last_millis_) {
     ESP_LOGD(TAG, "Incrementing scheduler major");
     this->millis_major_++;
   }
   this->last_millis_ = now;
-  return now;
+  return (uint64_t(this->millis_major_) << 32) | now;
 }
 
-bool HOT Scheduler::SchedulerItem::cmp(const std::unique_ptr<SchedulerItem> &a,
-                                       const std::unique_ptr<SchedulerItem> &b) {
-  // min-heap
-  // return true if *a* will happen after *b*
-  uint32_t a_next_exec = a->next_execution();
-  uint8_t a_next_exec_major = a->next_execution_major();
-  uint32_t b_next_exec = b->next_execution();
-  uint8_t b_next_exec_major = b->next_execution_major();
-
-  if (a_next_exec_major != b_next_exec_major) {
-    // The "major" calculation is quite complicated.
-    // Basically, we need to check if the major value lies in the future or
-    //
-
-    // Here are some cases to think about:
-    // Format: a_major,b_major -> expected result (a-b, b-a)
-    // a=255,b=0 -> false (255, 1)
-    // a=0,b=1 -> false   (255, 1)
-    // a=1,b=0 -> true    (1, 255)
-    // a=0,b=255 -> true  (1, 255)
-
-    uint8_t diff1 = a_next_exec_major - b_next_exec_major;
-    uint8_t diff2 = b_next_exec_major - a_next_exec_major;
-    return diff1 < diff2;
+void HOT Scheduler::ItemList::push_back(Scheduler::SchedulerItem *item) {
+  item->next = nullptr;
+  if (this->head == nullptr) {
+    item->prev = item;
+    this->head = item;
+    return;
   }
-
-  return a_next_exec > b_next_exec;
+  SchedulerItem *tail = this->head->prev;
+  tail->next = item;
+  item->prev = tail;
+  this->head->prev = item;
+}
+void HOT Scheduler::ItemList::unlink(Scheduler::SchedulerItem *item) {
+  if (item == this->head) {
+    this->head = item->next;
+    if (this->head != nullptr)
+      this->head->prev = item->prev;
+  } else {
+    item->prev->next = item->next;
+    if (item->next != nullptr) {
+      item->next->prev = item->prev;
+    } else {
+      // removed the tail
+      this->head->prev = item->prev;
+    }
+  }
+  item->prev = nullptr;
+  item->next = nullptr;
+}
+Scheduler::SchedulerItem *HOT Scheduler::ItemList::pop_front() {
+  SchedulerItem *item = this->head;
+  if (item != nullptr)
+    this->unlink(item);
+  return item;
 }
 
 }  // namespace esphome
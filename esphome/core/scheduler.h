@@ -8,6 +8,13 @@ namespace esphome {
 
 class Component;
 
+/** Timeout/interval scheduler backed by a hierarchical timer wheel.
+ *
+ * Items are taken from a pool that only ever grows (in blocks of SCHEDULER_POOL_BLOCK_SIZE) and are
+ * recycled through a free list, so scheduling a timeout in steady state never touches the heap
+ * (apart from what std::function needs for large captures). Named items are identified by the
+ * FNV-1 hash of their name and indexed in a small hash table, so inserting and cancelling are O(1).
+ */
 class Scheduler {
  public:
   void set_timeout(Component *component, const std::string &name, uint32_t timeout, std::function<void()> &&func);
@@ -22,46 +29,77 @@ class Scheduler {
   void process_to_add();
 
  protected:
+  /// Number of bits of the tick consumed by each wheel level.
+  static const uint8_t LEVEL_BITS = 5;
+  static const uint8_t LEVEL_SLOTS = 1 << LEVEL_BITS;
+  static const uint32_t LEVEL_MASK = LEVEL_SLOTS - 1;
+  /// Number of wheel levels, the wheel covers 2^(LEVEL_BITS * LEVELS) ms (~17 minutes).
+  static const uint8_t LEVELS = 4;
+  static const uint8_t INDEX_BUCKETS = 32;
+
   struct SchedulerItem {
     Component *component;
-    std::string name;
-    enum Type { TIMEOUT, INTERVAL } type;
-    union {
-      uint32_t interval;
-      uint32_t timeout;
-    };
-    uint32_t last_execution;
-    std::function<void()> f;
+    uint32_t name_hash;
+    bool named;
+    enum Type : uint8_t { TIMEOUT, INTERVAL } type;
+    /// Where this item currently lives, decides how it is unlinked on cancel.
+    enum State : uint8_t { FREE, PENDING, READY, WHEEL, FAR_FUTURE, DUE } state;
     bool remove;
-    uint8_t last_execution_major;
+    uint8_t level;
+    uint8_t slot;
+    uint32_t interval;
+    /// Absolute time (in ms since boot, not wrapping) this item should run at.
+    uint64_t next_execution;
+    std::function<void()> f;
+
+    // Intrusive doubly-linked list, the head's prev pointer refers to the tail.
+    SchedulerItem *prev;
+    SchedulerItem *next;
+    // Singly-linked chain in the name hash index.
+    SchedulerItem *index_next;
+  };
 
-    inline uint32_t next_execution() { return this->last_execution + this->timeout; }
-    inline uint8_t next_execution_major() {
-      uint32_t next_exec = this->next_execution();
-      uint8_t next_exec_major = this->last_execution_major;
-      if (next_exec < this->last_execution)
-        next_exec_major++;
-      return next_exec_major;
-    }
+  /// Intrusive list of scheduler items with O(1) append and unlink.
+  struct ItemList {
+    SchedulerItem *head{nullptr};
 
-    static bool cmp(const std::unique_ptr<SchedulerItem> &a, const std::unique_ptr<SchedulerItem> &b);
+    bool empty() const { return this->head == nullptr; }
+    void push_back(SchedulerItem *item);
+    void unlink(SchedulerItem *item);
+    SchedulerItem *pop_front();
   };
 
-  uint32_t millis_();
-  void cleanup_();
-  void pop_raw_();
-  void push_(std::unique_ptr<SchedulerItem> item);
+  uint64_t millis_();
+  SchedulerItem *alloc_item_();
+  void free_item_(SchedulerItem *item);
+  void index_add_(SchedulerItem *item);
+  void index_remove_(SchedulerItem *item);
+  static uint8_t index_bucket_(Component *component, uint32_t name_hash);
+  void wheel_insert_(SchedulerItem *item);
+  void wheel_remove_(SchedulerItem *item);
+  void cascade_(uint8_t level);
+  /// The first tick (>= current_tick_) at which items have to be run or cascaded, UINT64_MAX if there are none.
+  uint64_t next_event_tick_();
+  void run_list_(ItemList &list, uint64_t now);
+  void push_(SchedulerItem *item);
   bool cancel_item_(Component *component, const std::string &name, SchedulerItem::Type type);
-  bool empty_() {
-    this->cleanup_();
-    return this->items_.empty();
-  }
 
-  std::vector<std::unique_ptr<SchedulerItem>> items_;
-  std::vector<std::unique_ptr<SchedulerItem>> to_add_;
+  ItemList slots_[LEVELS][LEVEL_SLOTS];
+  /// Bitmap of non-empty slots for each level.
+  uint32_t occupied_[LEVELS]{};
+  /// Items further in the future than the wheel covers, re-examined every time the top level wraps.
+  ItemList overflow_;
+  /// Items that were already due when they were inserted, run at the beginning of the next call().
+  ItemList ready_;
+  ItemList to_add_;
+  SchedulerItem *index_[INDEX_BUCKETS]{};
+  SchedulerItem *free_items_{nullptr};
+  /// All ticks before this one have been processed.
+  uint64_t current_tick_{0};
   uint32_t last_millis_{0};
-  uint8_t millis_major_{0};
-  uint32_t to_remove_{0};
+  uint32_t millis_major_{0};
+  uint32_t pool_size_{0};
+  uint32_t pool_used_{0};
 };
 
 }  // namespace esphome
@@ -46,6 +46,7 @@ LoopTrigger = cg.esphome_ns.class_(
 VERSION_REGEX = re.compile(r"^[0-9]+\.[0-9]+\.[0-9]+(?:[ab]\d+)?$")
 
 CONF_NAME_ADD_MAC_SUFFIX = "name_add_mac_suffix"
+CONF_TICKLESS_LOOP = "tickless_loop"
 
 
 def validate_board(value):
@@ -176,6 +177,9 @@ CONFIG_SCHEMA = cv.Schema(
         cv.Optional(CONF_INCLUDES, default=[]): cv.ensure_list(valid_include),
         cv.Optional(CONF_LIBRARIES, default=[]): cv.ensure_list(cv.string_strict),
         cv.Optional(CONF_NAME_ADD_MAC_SUFFIX, default=False): cv.boolean,
+        # Only takes effect while no looping component needs polling, network
+        # components (wifi, api, ota, mqtt, ...) always do.
+        cv.Optional(CONF_TICKLESS_LOOP, default=False): cv.boolean,
         cv.Optional("esphome_core_version"): cv.invalid(
             "The esphome_core_version option has been "
             "removed in 1.13 - the esphome core source "
@@ -326,6 +330,8 @@ def to_code(config):
     cg.add_build_flag("-Wno-sign-compare")
     if config.get(CONF_ESP8266_RESTORE_FROM_FLASH, False):
         cg.add_define("USE_ESP8266_PREFERENCES_FLASH")
+    if config[CONF_TICKLESS_LOOP]:
+        cg.add_define("USE_TICKLESS_LOOP")
 
     if config[CONF_INCLUDES]:
         CORE.add_job(add_includes, config[CONF_INCLUDES])
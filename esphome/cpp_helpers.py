@@ -56,6 +56,8 @@ def register_component(var, config):
         add(var.set_setup_priority(config[CONF_SETUP_PRIORITY]))
     if CONF_UPDATE_INTERVAL in config:
         add(var.set_update_interval(config[CONF_UPDATE_INTERVAL]))
+    if "profiler" in CORE.loaded_integrations:
+        add(var.set_component_source(id_))
     add(App.register_component(var))
     yield var
 
@@ -2,6 +2,7 @@ import logging
 import os
 import re
 
+from esphome import binary_log
 from esphome.config import iter_components
 from esphome.const import (
     CONF_BOARD_FLASH_MODE,
@@ -444,6 +445,11 @@ def write_cpp(code_s):
     full_file += code_format[2]
     write_file_if_changed(path, full_file)
 
+    if any(define.name == "USE_BINARY_LOGGING" for define in CORE.defines):
+        binary_log.write_string_table()
+    else:
+        binary_log.remove_format_ids()
+
 
 def clean_build():
     import shutil
@@ -171,6 +171,31 @@ class TypeInfo:
 
     encode_func = None
 
+    @property
+    def calculate_size_content(self):
+        return self.get_size_calculation(f"this->{self.field_name}")
+
+    def get_size_calculation(self, name, force=False):
+        force_str = "true" if force else "false"
+        value = self.size_value(name)
+        return f"ProtoSize::{self.size_func}(total_size, {self.field_id_size}, {value}, {force_str});"
+
+    def size_value(self, name):
+        return name
+
+    @property
+    def field_id_size(self):
+        # size of the field tag varint, known at generation time
+        tag = (self.number << 3) | self.wire_type
+        size = 1
+        while tag > 0x7F:
+            tag >>= 7
+            size += 1
+        return size
+
+    wire_type = None
+    size_func = None
+
     @property
     def dump_content(self):
         o = f'out.append("  {self.name}: ");\n'
@@ -198,6 +223,11 @@ class DoubleType(TypeInfo):
     default_value = "0.0"
     decode_64bit = "value.as_double()"
     encode_func = "encode_double"
+    wire_type = 1
+    size_func = "add_fixed_field<8>"
+
+    def size_value(self, name):
+        return f"{name} != 0.0"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%g", {name});\n'
@@ -211,6 +241,11 @@ class FloatType(TypeInfo):
     default_value = "0.0f"
     decode_32bit = "value.as_float()"
     encode_func = "encode_float"
+    wire_type = 5
+    size_func = "add_fixed_field<4>"
+
+    def size_value(self, name):
+        return f"{name} != 0.0f"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%g", {name});\n'
@@ -224,6 +259,8 @@ class Int64Type(TypeInfo):
     default_value = "0"
     decode_varint = "value.as_int64()"
     encode_func = "encode_int64"
+    wire_type = 0
+    size_func = "add_int64_field"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%ll", {name});\n'
@@ -237,6 +274,8 @@ class UInt64Type(TypeInfo):
     default_value = "0"
     decode_varint = "value.as_uint64()"
     encode_func = "encode_uint64"
+    wire_type = 0
+    size_func = "add_uint64_field"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%ull", {name});\n'
@@ -250,6 +289,8 @@ class Int32Type(TypeInfo):
     default_value = "0"
     decode_varint = "value.as_int32()"
     encode_func = "encode_int32"
+    wire_type = 0
+    size_func = "add_int32_field"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%d", {name});\n'
@@ -263,6 +304,11 @@ class Fixed64Type(TypeInfo):
     default_value = "0"
     decode_64bit = "value.as_fixed64()"
     encode_func = "encode_fixed64"
+    wire_type = 1
+    size_func = "add_fixed_field<8>"
+
+    def size_value(self, name):
+        return f"{name} != 0"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%ull", {name});\n'
@@ -276,6 +322,11 @@ class Fixed32Type(TypeInfo):
     default_value = "0"
     decode_32bit = "value.as_fixed32()"
     encode_func = "encode_fixed32"
+    wire_type = 5
+    size_func = "add_fixed_field<4>"
+
+    def size_value(self, name):
+        return f"{name} != 0"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%u", {name});\n'
@@ -289,6 +340,8 @@ class BoolType(TypeInfo):
     default_value = "false"
     decode_varint = "value.as_bool()"
     encode_func = "encode_bool"
+    wire_type = 0
+    size_func = "add_bool_field"
 
     def dump(self, name):
         o = f"out.append(YESNO({name}));"
@@ -303,6 +356,8 @@ class StringType(TypeInfo):
     const_reference_type = "const std::string &"
     decode_length = "value.as_string()"
     encode_func = "encode_string"
+    wire_type = 2
+    size_func = "add_string_field"
 
     def dump(self, name):
         o = f'out.append("\'").append({name}).append("\'");'
@@ -333,6 +388,9 @@ class MessageType(TypeInfo):
     def decode_length(self):
         return f"value.as_message<{self.cpp_type}>()"
 
+    wire_type = 2
+    size_func = "add_message_field"
+
     def dump(self, name):
         o = f"{name}.dump_to(out);"
         return o
@@ -346,6 +404,8 @@ class BytesType(TypeInfo):
     const_reference_type = "const std::string &"
     decode_length = "value.as_string()"
     encode_func = "encode_string"
+    wire_type = 2
+    size_func = "add_string_field"
 
     def dump(self, name):
         o = f'out.append("\'").append({name}).append("\'");'
@@ -358,6 +418,8 @@ class UInt32Type(TypeInfo):
     default_value = "0"
     decode_varint = "value.as_uint32()"
     encode_func = "encode_uint32"
+    wire_type = 0
+    size_func = "add_uint32_field"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%u", {name});\n'
@@ -381,6 +443,9 @@ class EnumType(TypeInfo):
     def encode_func(self):
         return f"encode_enum<{self.cpp_type}>"
 
+    wire_type = 0
+    size_func = "add_enum_field"
+
     def dump(self, name):
         o = f"out.append(proto_enum_to_string<{self.cpp_type}>({name}));"
         return o
@@ -392,6 +457,11 @@ class SFixed32Type(TypeInfo):
     default_value = "0"
     decode_32bit = "value.as_sfixed32()"
     encode_func = "encode_sfixed32"
+    wire_type = 5
+    size_func = "add_fixed_field<4>"
+
+    def size_value(self, name):
+        return f"{name} != 0"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%d", {name});\n'
@@ -405,6 +475,11 @@ class SFixed64Type(TypeInfo):
     default_value = "0"
     decode_64bit = "value.as_sfixed64()"
     encode_func = "encode_sfixed64"
+    wire_type = 1
+    size_func = "add_fixed_field<8>"
+
+    def size_value(self, name):
+        return f"{name} != 0"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%ll", {name});\n'
@@ -418,6 +493,8 @@ class SInt32Type(TypeInfo):
     default_value = "0"
     decode_varint = "value.as_sint32()"
     encode_func = "encode_sint32"
+    wire_type = 0
+    size_func = "add_sint32_field"
 
     def dump(self, name):
         o = f'sprintf(buffer, "%d", {name});\n'
@@ -431,6 +508,8 @@ class SInt64Type(TypeInfo):
     default_value = "0"
     decode_varint = "value.as_sint64()"
     encode_func = "encode_sin64"
+    wire_type = 0
+    size_func = "add_sint64_field"
 
     def dump(self):
         o = f'sprintf(buffer, "%ll", {name});\n'
@@ -519,6 +598,13 @@ class RepeatedTypeInfo(TypeInfo):
           buffer.{self._ti.encode_func}({self.number}, it, true);
         }}"""
 
+    @property
+    def calculate_size_content(self):
+        o = f'for (const auto {"" if self._ti_is_bool else "&"}it : this->{self.field_name}) {{\n'
+        o += f"  {self._ti.get_size_calculation('it', True)}\n"
+        o += f"}}"
+        return o
+
     @property
     def dump_content(self):
         o = f'for (const auto {"" if self._ti_is_bool else "&"}it : this->{self.field_name}) {{\n'
@@ -556,6 +642,7 @@ def build_message_type(desc):
     decode_32bit = []
     decode_64bit = []
     encode = []
+    calculate_size = []
     dump = []
 
     for field in desc.field:
@@ -566,6 +653,7 @@ def build_message_type(desc):
         protected_content.extend(ti.protected_content)
         public_content.extend(ti.public_content)
         encode.append(ti.encode_content)
+        calculate_size.append(ti.calculate_size_content)
 
         if ti.decode_varint_content:
             decode_varint.append(ti.decode_varint_content)
@@ -627,6 +715,13 @@ def build_message_type(desc):
     prot = "void encode(ProtoWriteBuffer buffer) const override;"
     public_content.append(prot)
 
+    o = f"void {desc.name}::calculate_size(uint32_t &total_size) const {{\n"
+    o += indent("\n".join(calculate_size)) + "\n"
+    o += "}\n"
+    cpp += o
+    prot = "void calculate_size(uint32_t &total_size) const override;"
+    public_content.append(prot)
+
     o = f"void {desc.name}::dump_to(std::string &out) const {{\n"
     if dump:
         o += f"  char buffer[64];\n"
@@ -0,0 +1,108 @@
+import pytest
+
+from esphome import binary_log
+
+
+def test_fnv1_hash():
+    # must match binary_log_format_id() on the device
+    assert binary_log.fnv1_hash(b"Setting up %s...") == 0xD1E6198C
+    assert binary_log.fnv1_hash(b"") == 2166136261
+
+
+@pytest.mark.parametrize(
+    "literal, expected",
+    (
+        ("foo", b"foo"),
+        (r"a\tb\n", b"a\tb\n"),
+        (r"\"quoted\" \\", b'"quoted" \\'),
+        (r"\x41\101\0", b"AA\x00"),
+        ("°C", "°C".encode("utf-8")),
+    ),
+)
+def test_unescape_c_string(literal, expected):
+    assert binary_log.unescape_c_string(literal) == expected
+
+
+def test_extract_format_strings():
+    text = """
+    ESP_LOGD(TAG, "Setting up %s...", name);
+    ESP_LOGCONFIG(TAG, "  Value: %d "
+                       "continued", value);
+    ESP_LOGW(TAG, "No arguments");
+    ESP_LOGV(TAG, "Uses %" PRIu32 " macros", value);
+    ESP_LOGI(TAG, format, value);
+    """
+
+    actual = binary_log.extract_format_strings(text)
+
+    assert actual == [b"Setting up %s...", b"  Value: %d continued", b"No arguments"]
+
+
+def _varint(value):
+    ret = bytearray()
+    while value > 0x7F:
+        ret.append((value & 0x7F) | 0x80)
+        value >>= 7
+    ret.append(value)
+    return bytes(ret)
+
+
+@pytest.mark.parametrize(
+    "fmt, args, expected",
+    (
+        # encoded by encode_binary_log() on the device, without the format ID
+        ("Setting up %s...", "2a0457694669", "Setting up WiFi..."),
+        (
+            "  Value: %d (%u) 0x%08X %o %c",
+            "2aff880f80d0acf30eeffd02085a",
+            "  Value: -123456 (4000000000) 0x0000BEEF 10 Z",
+        ),
+        (
+            "%.2f%% %5.1f %e %g",
+            "2ae3a5ab41000050c000509a4417b7d138",
+            "21.46%  -3.2 1.234500e+03 0.0001",
+        ),
+        ("%*d|%-*d|", "2a0c54080e", "    42|7   |"),
+        # message cut off on the device
+        ("Setting up %s...", "2a04576946", "Setting up <truncated>"),
+    ),
+)
+def test_format_message(fmt, args, expected):
+    format_id = binary_log.fnv1_hash(fmt.encode("utf-8"))
+    decoder = binary_log.BinaryLogDecoder({format_id: fmt})
+
+    line, actual = decoder.format_message(_varint(format_id) + bytes.fromhex(args))
+
+    assert line == 42
+    assert actual == expected
+
+
+def test_format_message__unknown_format():
+    decoder = binary_log.BinaryLogDecoder({})
+
+    _, actual = decoder.format_message(bytes([0x01, 0x2A]))
+
+    assert "unknown log format 00000001" in actual
+
+
+def test_decode():
+    decoder = binary_log.BinaryLogDecoder({1: "Hello %s"})
+
+    actual = decoder.decode(5, "main", bytes([0x01, 0x07, 0x05]) + b"world")
+
+    assert actual == "\033[0;36m[D][main:007]: Hello world\033[0m"
+
+
+def test_generate_format_ids_cpp():
+    actual = binary_log.generate_format_ids_cpp({0xD1E6198C: b"b", 0x10: b"a"})
+
+    # sorted for the binary search on the device
+    assert "BINARY_LOG_FORMAT_IDS[] PROGMEM = {0x00000010, 0xD1E6198C};" in actual
+    assert "BINARY_LOG_FORMAT_COUNT = 2;" in actual
+
+
+def test_generate_format_ids_cpp__empty():
+    actual = binary_log.generate_format_ids_cpp({})
+
+    assert "BINARY_LOG_FORMAT_IDS[] PROGMEM = {0};" in actual
+    assert "BINARY_LOG_FORMAT_COUNT = 0;" in actual
@@ -0,0 +1,67 @@
+import pytest
+
+from esphome.components import image
+
+
+def decompress_rle(data, size):
+    # same as RunLengthDecoder on the device
+    out = []
+    i = 0
+    while i < len(data):
+        control = data[i]
+        i += 1
+        if control & 0x80:
+            out += data[i : i + size] * (control - 126)
+            i += size
+        else:
+            count = (control + 1) * size
+            out += data[i : i + count]
+            i += count
+    return out
+
+
+@pytest.mark.parametrize(
+    "data, size, expected",
+    (
+        # literal run of the maximum length
+        (list(range(128)), 1, [127] + list(range(128))),
+        # one element more starts a second literal run
+        (list(range(129)), 1, [127] + list(range(128)) + [0, 128]),
+        # repeat run of the maximum length
+        ([7] * 129, 1, [255, 7]),
+        ([7] * 130, 1, [255, 7, 0, 7]),
+        # a single byte is only worth a repeat run from 3 on
+        ([1, 1, 2, 2, 2], 1, [1, 1, 1, 129, 2]),
+        ([1, 2, 1, 2, 3, 4, 3, 4], 2, [128, 1, 2, 128, 3, 4]),
+        ([1, 2, 3, 4, 5, 6], 3, [1, 1, 2, 3, 4, 5, 6]),
+        ([1, 2, 3] * 129, 3, [255, 1, 2, 3]),
+        ([], 1, []),
+    ),
+)
+def test_compress_rle(data, size, expected):
+    assert image.compress_rle(data, size) == expected
+
+
+@pytest.mark.parametrize("size", (1, 2, 3))
+@pytest.mark.parametrize(
+    "elements",
+    (
+        list(range(128)),
+        list(range(129)),
+        list(range(300)),
+        [5] * 129,
+        [5] * 130,
+        [5] * 300,
+        [0, 0] + list(range(128)) + [1] * 2 + [2] * 129 + [3],
+        [i // 3 for i in range(200)],
+    ),
+)
+def test_compress_rle__round_trip(elements, size):
+    # build elements of the given size from the element values
+    data = []
+    for element in elements:
+        data += [(element + i * 37) & 0xFF for i in range(size)]
+
+    compressed = image.compress_rle(data, size)
+
+    assert decompress_rle(compressed, size) == data